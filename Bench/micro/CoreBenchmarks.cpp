@@ -0,0 +1,163 @@
+#include "MicroBench.h"
+
+#include <GLFW/glfw3.h>
+
+#include <Utils/Easing.h>
+
+namespace Bench::Micro
+{
+    // Dispatches a key event past arg handlers that all listen for a different event type, the usual case for most handlers
+    static void BM_EventDispatch(State& state)
+    {
+        auto& eventManager = pxl::Application::Get().GetEventManager();
+
+        std::vector<pxl::UserEventHandler<pxl::MouseScrollEvent>> handlers;
+        for (int64_t i = 0; i < state.GetArg(); i++)
+        {
+            auto& handler = handlers.emplace_back(std::make_shared<pxl::EventHandler<pxl::MouseScrollEvent>>([](pxl::MouseScrollEvent& e) {}));
+            eventManager->RegisterHandler(handler);
+        }
+
+        auto send = eventManager->GetEventSendCallback();
+        pxl::KeyDownEvent event(nullptr, pxl::KeyCode::Space, 0);
+
+        // Dispatch once untimed so the handlers left expired by the previous run are erased
+        send(event);
+
+        for (auto _ : state)
+            send(event);
+    }
+    PXL_MICROBENCH(BM_EventDispatch)->Arg(1)->Arg(16)->Arg(128);
+
+    // Input needs a window, so a hidden one without a renderer is created the first time this runs
+    static std::shared_ptr<pxl::Window> GetInputWindow()
+    {
+        static std::shared_ptr<pxl::Window> s_Window = nullptr;
+        static bool s_Attempted = false;
+
+        if (s_Attempted)
+            return s_Window;
+
+        s_Attempted = true;
+
+        // GLFW can't initialize without a display, e.g. on CI without xvfb
+        if (!glfwInit())
+            return nullptr;
+
+        pxl::WindowSpecs specs = {};
+        specs.Title = "pxl_microbench";
+        specs.RendererAPI = pxl::RendererAPIType::None;
+        specs.Visible = false;
+
+        s_Window = pxl::Window::Create(specs);
+
+        if (!s_Window)
+            return nullptr;
+
+        pxl::Input::Init(s_Window);
+
+        // Press a handful of keys through the window's real key callback so the lookups find populated input state
+        auto keyCallback = glfwSetKeyCallback(s_Window->GetNativeWindow(), nullptr);
+        glfwSetKeyCallback(s_Window->GetNativeWindow(), keyCallback);
+
+        if (!keyCallback)
+            return s_Window;
+
+        for (auto key : { pxl::KeyCode::W, pxl::KeyCode::A, pxl::KeyCode::S, pxl::KeyCode::D, pxl::KeyCode::Space, pxl::KeyCode::LeftShift })
+            keyCallback(s_Window->GetNativeWindow(), static_cast<int>(key), 0, GLFW_PRESS, 0);
+
+        return s_Window;
+    }
+
+    static void BM_InputIsKeyPressed(State& state)
+    {
+        if (!GetInputWindow())
+        {
+            state.Skip("No window could be created, run under a display or xvfb");
+            return;
+        }
+
+        // Arg 1 looks up a pressed key, 0 one that has never been pressed
+        auto key = state.GetArg() ? pxl::KeyCode::Space : pxl::KeyCode::F12;
+
+        for (auto _ : state)
+            DoNotOptimize(pxl::Input::IsKeyPressed(key));
+    }
+    PXL_MICROBENCH(BM_InputIsKeyPressed)->Arg(0)->Arg(1);
+
+    static void BM_EasingDirect(State& state)
+    {
+        double t = 0.0;
+
+        for (auto _ : state)
+        {
+            DoNotOptimize(pxl::Easing::InOutCubic(t));
+            t = t < 1.0 ? t + 0.001 : 0.0;
+        }
+    }
+    PXL_MICROBENCH(BM_EasingDirect);
+
+    // How animations call easings, through the std::function looked up by Ease
+    static void BM_EasingFunctionLookup(State& state)
+    {
+        double t = 0.0;
+
+        for (auto _ : state)
+        {
+            DoNotOptimize(pxl::Easing::GetEasingFunction(pxl::Ease::OutBounce)(t));
+            t = t < 1.0 ? t + 0.001 : 0.0;
+        }
+    }
+    PXL_MICROBENCH(BM_EasingFunctionLookup);
+
+    // Copies an arg x arg RGBA image
+    static void BM_ImageCopy(State& state)
+    {
+        auto size = static_cast<uint32_t>(state.GetArg());
+        pxl::Image image(std::vector<uint8_t>(size * size * 4, 0x7F), { size, size }, pxl::ImageFormat::RGBA8);
+
+        for (auto _ : state)
+        {
+            pxl::Image copy = image;
+            DoNotOptimize(copy.Buffer.data());
+        }
+    }
+    PXL_MICROBENCH(BM_ImageCopy)->Arg(64)->Arg(512)->Arg(2048);
+
+    // Constructs an arg x arg RGBA image from a pixel buffer, the way loaded and generated images are made
+    static void BM_ImageFromPixels(State& state)
+    {
+        auto size = static_cast<uint32_t>(state.GetArg());
+        std::vector<uint8_t> pixels(size * size * 4, 0x7F);
+
+        for (auto _ : state)
+        {
+            pxl::Image image(pixels, { size, size }, pxl::ImageFormat::RGBA8);
+            DoNotOptimize(image.Buffer.data());
+        }
+    }
+    PXL_MICROBENCH(BM_ImageFromPixels)->Arg(64)->Arg(512)->Arg(2048);
+
+    // The cost of a built-in profiler scope, arg 0 outside a capture and arg 1 while one records it. The target is under 50 ns a scope
+    static void BM_ProfileScope(State& state)
+    {
+        bool capturing = state.GetArg() != 0;
+
+        if (capturing)
+        {
+            pxl::Profiler::SetOutputDirectory(std::filesystem::temp_directory_path() / "pxl_microbench");
+            pxl::Profiler::BeginCapture();
+        }
+
+        for (auto _ : state)
+        {
+            pxl::ProfileScope scope("BM_ProfileScope");
+            DoNotOptimize(scope);
+        }
+
+        // Exporting isn't part of a scope's cost, and the loop has already stopped the timer
+        if (capturing)
+            pxl::Profiler::EndCapture();
+    }
+    PXL_MICROBENCH(BM_ProfileScope)->Arg(0)->Arg(1);
+}
\ No newline at end of file
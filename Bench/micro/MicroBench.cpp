@@ -0,0 +1,234 @@
+#include "MicroBench.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+
+// ---------------------------------------------------------------------------
+// Allocation counting
+// NOTE: Replacing these replaces them for the whole executable, including pxl.
+// The array and nothrow forms forward to these by default.
+// Profiling builds already replace them to report allocations to Tracy, so allocations aren't counted there.
+// ---------------------------------------------------------------------------
+
+static std::atomic<uint64_t> s_AllocationCount = 0;
+
+#ifndef PXL_ENABLE_PROFILING
+void* operator new(std::size_t size)
+{
+    s_AllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+#endif
+
+namespace Bench::Micro
+{
+    struct Result
+    {
+        std::string Name;
+        std::optional<int64_t> Arg;
+        uint64_t Iterations = 0;
+        double NanosecondsPerOp = 0.0;
+        double AllocationsPerOp = 0.0;
+        std::string SkipReason;
+    };
+
+    struct Options
+    {
+        std::string Filter;
+        double MinTime = 0.25; // Seconds each benchmark runs for at least
+        std::optional<std::filesystem::path> OutputPath;
+    };
+
+    // The only application object, which the event manager and input need to exist
+    class MicroBenchApplication : public pxl::Application
+    {
+    };
+
+    static std::vector<std::unique_ptr<Benchmark>>& GetBenchmarks()
+    {
+        static std::vector<std::unique_ptr<Benchmark>> s_Benchmarks;
+        return s_Benchmarks;
+    }
+
+    uint64_t GetAllocationCount()
+    {
+        return s_AllocationCount.load(std::memory_order_relaxed);
+    }
+
+    Benchmark* Register(const std::string& name, void (*function)(State&))
+    {
+        return GetBenchmarks().emplace_back(std::make_unique<Benchmark>(name, function)).get();
+    }
+
+    // Grows the iteration count until one run takes at least the min time, like Google Benchmark does
+    static Result RunBenchmark(const Benchmark& benchmark, std::optional<int64_t> arg, double minTime)
+    {
+        Result result;
+        result.Name = benchmark.GetName();
+        result.Arg = arg;
+
+        // One untimed iteration first so lazy setup and first-touch allocations aren't counted
+        State warmup(1, arg.value_or(0));
+        benchmark.Run(warmup);
+
+        if (warmup.IsSkipped())
+        {
+            result.SkipReason = warmup.GetSkipReason();
+            return result;
+        }
+
+        uint64_t iterations = 1;
+
+        while (true)
+        {
+            State state(iterations, arg.value_or(0));
+            benchmark.Run(state);
+
+            double seconds = std::chrono::duration<double>(state.GetElapsed()).count();
+
+            if (seconds >= minTime || iterations >= 1'000'000'000)
+            {
+                result.Iterations = iterations;
+                result.NanosecondsPerOp = seconds * 1e9 / static_cast<double>(iterations);
+                result.AllocationsPerOp = static_cast<double>(state.GetAllocations()) / static_cast<double>(iterations);
+                return result;
+            }
+
+            // Aim a little past the min time so the next run is likely the last
+            double multiplier = seconds > 0.0 ? minTime * 1.4 / seconds : 10.0;
+            iterations = static_cast<uint64_t>(static_cast<double>(iterations) * std::clamp(multiplier, 2.0, 10.0));
+        }
+    }
+
+    static std::string GetDisplayName(const Result& result)
+    {
+        return result.Arg ? std::format("{}/{}", result.Name, *result.Arg) : result.Name;
+    }
+
+    static bool WriteJSON(const std::vector<Result>& results, const std::filesystem::path& path)
+    {
+        std::string json = "[";
+
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const auto& result = results[i];
+
+            json += std::format(R"({}{{"name":"{}","iterations":{},"ns_per_op":{:.3f},"allocs_per_op":{:.3f},"skipped":{}}})",
+                i > 0 ? "," : "", GetDisplayName(result), result.Iterations, result.NanosecondsPerOp, result.AllocationsPerOp, !result.SkipReason.empty());
+        }
+
+        json += "]\n";
+
+        std::ofstream file(path, std::ios::trunc);
+
+        if (!file.is_open())
+            return false;
+
+        file << json;
+        return true;
+    }
+
+    static int Run(const Options& options)
+    {
+        std::vector<Result> results;
+
+#ifdef PXL_ENABLE_PROFILING
+        std::printf("Allocations aren't counted in profiling builds, allocs/op will be 0\n\n");
+#endif
+
+        std::printf("%-48s %14s %14s %14s\n", "Benchmark", "Iterations", "ns/op", "allocs/op");
+        std::printf("%s\n", std::string(93, '-').c_str());
+
+        for (const auto& benchmark : GetBenchmarks())
+        {
+            if (!options.Filter.empty() && benchmark->GetName().find(options.Filter) == std::string::npos)
+                continue;
+
+            std::vector<std::optional<int64_t>> args;
+            for (auto arg : benchmark->GetArgs())
+                args.push_back(arg);
+
+            if (args.empty())
+                args.push_back(std::nullopt);
+
+            for (auto arg : args)
+            {
+                auto result = RunBenchmark(*benchmark, arg, options.MinTime);
+                auto name = GetDisplayName(result);
+
+                if (!result.SkipReason.empty())
+                    std::printf("%-48s SKIPPED: %s\n", name.c_str(), result.SkipReason.c_str());
+                else
+                    std::printf("%-48s %14llu %14.2f %14.2f\n", name.c_str(), static_cast<unsigned long long>(result.Iterations), result.NanosecondsPerOp, result.AllocationsPerOp);
+
+                results.push_back(result);
+            }
+        }
+
+        if (options.OutputPath && !WriteJSON(results, *options.OutputPath))
+        {
+            std::printf("Failed to write results to '%s'\n", options.OutputPath->string().c_str());
+            return 1;
+        }
+
+        return 0;
+    }
+}
+
+// pxl_microbench times the framework's per-frame CPU code in isolation.
+//
+// Usage: pxl_microbench [--filter substring] [--min-time seconds] [--output results.json]
+int main(int argc, char* argv[])
+{
+    Bench::Micro::Options options;
+
+    // NOTE: Purposefully skips the first argument (the program's name/path)
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--filter" && hasValue)
+        {
+            options.Filter = argv[++i];
+        }
+        else if (arg == "--min-time" && hasValue)
+        {
+            options.MinTime = std::max(std::strtod(argv[++i], nullptr), 0.001);
+        }
+        else if (arg == "--output" && hasValue)
+        {
+            options.OutputPath = argv[++i];
+        }
+        else
+        {
+            std::printf("Usage: pxl_microbench [--filter substring] [--min-time seconds] [--output results.json]\n");
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    Bench::Micro::MicroBenchApplication app;
+
+    int exitCode = Bench::Micro::Run(options);
+
+    app.Close();
+
+    return exitCode;
+}
\ No newline at end of file
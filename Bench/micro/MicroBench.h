@@ -0,0 +1,147 @@
+#pragma once
+
+#include <pxl/pxl.h>
+
+// A small Google Benchmark-style harness for the framework's CPU hot paths.
+//
+//     static void BM_Something(Bench::Micro::State& state)
+//     {
+//         // Setup isn't timed
+//         for (auto _ : state)
+//             Bench::Micro::DoNotOptimize(Something(state.GetArg()));
+//     }
+//     PXL_MICROBENCH(BM_Something)->Arg(1)->Arg(64);
+//
+// Each benchmark reports nanoseconds and heap allocations per iteration.
+// Allocations are counted by replacing the global operator new, so they include any made by the framework (except in profiling builds, where Tracy replaces it).
+
+#define PXL_MICROBENCH_CONCAT_IMPL(a, b) a##b
+#define PXL_MICROBENCH_CONCAT(a, b) PXL_MICROBENCH_CONCAT_IMPL(a, b)
+
+#define PXL_MICROBENCH(function) \
+    static Bench::Micro::Benchmark* PXL_MICROBENCH_CONCAT(s_Benchmark, __LINE__) = Bench::Micro::Register(#function, function)
+
+namespace Bench::Micro
+{
+    // Total heap allocations made by the process so far
+    uint64_t GetAllocationCount();
+
+    // Stops the compiler from optimizing away a value that is otherwise unused
+    template<typename T>
+    inline void DoNotOptimize(const T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        // MSVC doesn't support inline asm on x64, so escape the value's address through a volatile store instead
+        static const void* volatile s_Sink = nullptr;
+        s_Sink = &value;
+#endif
+    }
+
+    class State
+    {
+    public:
+        State(uint64_t iterations, int64_t arg)
+            : m_Iterations(iterations), m_Arg(arg)
+        {
+        }
+
+        struct Iterator
+        {
+            State* Owner = nullptr;
+            uint64_t Remaining = 0;
+
+            bool operator!=(const Iterator&)
+            {
+                if (Remaining != 0)
+                    return true;
+
+                Owner->Stop();
+                return false;
+            }
+
+            Iterator& operator++()
+            {
+                Remaining--;
+                return *this;
+            }
+
+            int operator*() const { return 0; }
+        };
+
+        // Timing starts when the loop does, so setup before it isn't measured
+        Iterator begin()
+        {
+            m_StartAllocations = GetAllocationCount();
+            m_StartTime = std::chrono::steady_clock::now();
+            return { this, m_Skipped ? 0 : m_Iterations };
+        }
+
+        Iterator end() { return { this, 0 }; }
+
+        // Skips the benchmark when something it needs isn't available, call it before the loop
+        void Skip(const std::string& reason)
+        {
+            m_Skipped = true;
+            m_SkipReason = reason;
+        }
+
+        bool IsSkipped() const { return m_Skipped; }
+        const std::string& GetSkipReason() const { return m_SkipReason; }
+
+        int64_t GetArg() const { return m_Arg; }
+        uint64_t GetIterations() const { return m_Iterations; }
+
+        std::chrono::nanoseconds GetElapsed() const { return m_Elapsed; }
+        uint64_t GetAllocations() const { return m_Allocations; }
+
+    private:
+        void Stop()
+        {
+            m_Elapsed = std::chrono::steady_clock::now() - m_StartTime;
+            m_Allocations = GetAllocationCount() - m_StartAllocations;
+        }
+
+    private:
+        uint64_t m_Iterations = 0;
+        int64_t m_Arg = 0;
+
+        std::chrono::steady_clock::time_point m_StartTime;
+        uint64_t m_StartAllocations = 0;
+
+        std::chrono::nanoseconds m_Elapsed = std::chrono::nanoseconds::zero();
+        uint64_t m_Allocations = 0;
+
+        bool m_Skipped = false;
+        std::string m_SkipReason;
+    };
+
+    class Benchmark
+    {
+    public:
+        Benchmark(const std::string& name, void (*function)(State&))
+            : m_Name(name), m_Function(function)
+        {
+        }
+
+        // Runs the benchmark once per argument, which is read with State::GetArg()
+        Benchmark* Arg(int64_t arg)
+        {
+            m_Args.push_back(arg);
+            return this;
+        }
+
+        const std::string& GetName() const { return m_Name; }
+        const std::vector<int64_t>& GetArgs() const { return m_Args; }
+
+        void Run(State& state) const { m_Function(state); }
+
+    private:
+        std::string m_Name;
+        void (*m_Function)(State&) = nullptr;
+        std::vector<int64_t> m_Args;
+    };
+
+    Benchmark* Register(const std::string& name, void (*function)(State&));
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#include "MicroBench.h"
+
+#include <Renderer/TextureUnits.h>
+
+namespace Bench::Micro
+{
+    // Stands in for a GPU texture, texture units only compare pointers
+    class NullTexture : public pxl::Texture
+    {
+    public:
+        virtual void Bind(uint32_t unit) override {}
+        virtual void Unbind() override {}
+
+        virtual void SetData(const void* data) override {}
+
+        virtual const pxl::ImageMetadata& GetMetadata() const override { return m_Metadata; }
+
+    private:
+        pxl::ImageMetadata m_Metadata = {};
+    };
+
+    // Called once for every quad, cube and line drawn
+    static void BM_CalculateTransform(State& state)
+    {
+        glm::vec3 position = { 1.0f, 2.0f, 3.0f };
+        glm::vec3 rotation = { 15.0f, 30.0f, 45.0f };
+        glm::vec3 scale = { 2.0f, 2.0f, 1.0f };
+
+        for (auto _ : state)
+        {
+            DoNotOptimize(pxl::Renderer::CalculateTransform(position, rotation, scale));
+            rotation.y += 1.0f;
+        }
+    }
+    PXL_MICROBENCH(BM_CalculateTransform);
+
+    static void BM_QuadDefaultVerticesWithOrigin(State& state)
+    {
+        auto origin = static_cast<pxl::Origin2D>(state.GetArg());
+
+        for (auto _ : state)
+            DoNotOptimize(pxl::Quad::GetDefaultVerticesWithOrigin(origin));
+    }
+    PXL_MICROBENCH(BM_QuadDefaultVerticesWithOrigin)->Arg(static_cast<int64_t>(pxl::Origin2D::Center))->Arg(static_cast<int64_t>(pxl::Origin2D::BottomRight));
+
+    // The body of Renderer::GetTextureIndex, cycling through arg distinct textures within a full set of units
+    static void BM_GetTextureIndex(State& state)
+    {
+        constexpr uint32_t k_UnitCount = 32;
+
+        std::vector<std::shared_ptr<pxl::Texture>> textures;
+        for (int64_t i = 0; i < state.GetArg(); i++)
+            textures.push_back(std::make_shared<NullTexture>());
+
+        pxl::TextureUnits units;
+        units.Resize(k_UnitCount);
+
+        size_t next = 0;
+
+        for (auto _ : state)
+        {
+            DoNotOptimize(units.GetIndex(textures[next]));
+
+            next = next + 1 < textures.size() ? next + 1 : 0;
+        }
+    }
+    PXL_MICROBENCH(BM_GetTextureIndex)->Arg(1)->Arg(8)->Arg(32);
+
+    static void BM_BufferLayoutConstruction(State& state)
+    {
+        for (auto _ : state)
+            DoNotOptimize(pxl::QuadVertex::GetLayout());
+    }
+    PXL_MICROBENCH(BM_BufferLayoutConstruction);
+
+    static void BM_BufferLayoutCopy(State& state)
+    {
+        auto layout = pxl::QuadVertex::GetLayout();
+
+        for (auto _ : state)
+        {
+            pxl::BufferLayout copy = layout;
+            DoNotOptimize(copy);
+        }
+    }
+    PXL_MICROBENCH(BM_BufferLayoutCopy);
+}
\ No newline at end of file
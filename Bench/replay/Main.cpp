@@ -0,0 +1,119 @@
+#include "ReplayApplication.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+// pxl_replay plays a render capture (see pxl::RenderCapture) back through a renderer backend and writes the frame timings as JSON.
+//
+// Usage: pxl_replay <capture.pxrc> [--api OpenGL|Vulkan|Null] [--loops N] [--warmup N] [--size WIDTHxHEIGHT]
+//                   [--parallel-recording] [--software] [--output results.json]
+//
+// Captures can be made by any application with pxl::RenderCapture::Begin(), or with pxl_bench --capture.
+
+static void PrintUsage()
+{
+    std::printf("Usage: pxl_replay <capture.pxrc> [--api OpenGL|Vulkan|Null] [--loops N] [--warmup N] [--size WIDTHxHEIGHT]\n"
+                "                  [--parallel-recording] [--software] [--output results.json]\n");
+}
+
+static void UseSoftwareRenderers()
+{
+#ifdef _WIN32
+    _putenv_s("LIBGL_ALWAYS_SOFTWARE", "1");
+    _putenv_s("VK_LOADER_DRIVERS_SELECT", "*lvp*");
+#else
+    setenv("LIBGL_ALWAYS_SOFTWARE", "1", 1);
+    setenv("VK_LOADER_DRIVERS_SELECT", "*lvp*", 1);
+#endif
+}
+
+int main(int argc, char* argv[])
+{
+    PXL_INIT_LOGGING;
+
+    Replay::ReplayOptions options;
+
+    // NOTE: Purposefully skips the first argument (the program's name/path)
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--api" && hasValue)
+        {
+            std::string value = argv[++i];
+
+            if (value == "OpenGL")
+                options.RendererAPI = pxl::RendererAPIType::OpenGL;
+            else if (value == "Vulkan")
+                options.RendererAPI = pxl::RendererAPIType::Vulkan;
+            else if (value == "Null")
+                options.RendererAPI = pxl::RendererAPIType::Null;
+            else
+            {
+                PrintUsage();
+                return 1;
+            }
+        }
+        else if (arg == "--loops" && hasValue)
+        {
+            options.Loops = std::max(static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10)), 1u);
+        }
+        else if (arg == "--warmup" && hasValue)
+        {
+            options.WarmupLoops = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (arg == "--size" && hasValue)
+        {
+            uint32_t width = 0, height = 0;
+
+            if (std::sscanf(argv[++i], "%ux%u", &width, &height) != 2 || width == 0 || height == 0)
+            {
+                PrintUsage();
+                return 1;
+            }
+
+            options.Size = { width, height };
+        }
+        else if (arg == "--output" && hasValue)
+        {
+            options.OutputPath = argv[++i];
+        }
+        else if (arg == "--parallel-recording")
+        {
+            options.ParallelRecording = true;
+        }
+        else if (arg == "--software")
+        {
+            UseSoftwareRenderers();
+        }
+        else if (!arg.starts_with("--") && options.CapturePath.empty())
+        {
+            options.CapturePath = arg;
+        }
+        else
+        {
+            PrintUsage();
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    if (options.CapturePath.empty())
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    auto capture = pxl::RenderCapture::Load(options.CapturePath);
+
+    if (!capture || capture->Frames.empty())
+    {
+        std::printf("'%s' has no frames to replay\n", options.CapturePath.string().c_str());
+        return 1;
+    }
+
+    Replay::ReplayApplication app(options, std::make_shared<pxl::RenderCaptureFile>(std::move(capture.value())));
+    app.Run();
+
+    return app.Succeeded() ? 0 : 1;
+}
\ No newline at end of file
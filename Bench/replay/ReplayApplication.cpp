@@ -0,0 +1,136 @@
+#include "ReplayApplication.h"
+
+#include <fstream>
+#include <iostream>
+
+namespace Replay
+{
+    static std::string ToJSON(const pxl::FrameTimeSummary& summary)
+    {
+        if (summary.SampleCount == 0)
+            return "null";
+
+        return std::format(R"({{"mean":{:.4f},"p50":{:.4f},"p95":{:.4f},"p99":{:.4f},"max":{:.4f},"one_percent_low":{:.4f},"stutters":{}}})",
+            summary.Mean, summary.P50, summary.P95, summary.P99, summary.Max, summary.OnePercentLow, summary.StutterCount);
+    }
+
+    ReplayApplication::ReplayApplication(const ReplayOptions& options, const std::shared_ptr<pxl::RenderCaptureFile>& capture)
+        : m_Options(options), m_Capture(capture)
+    {
+        m_WarmupFrames = static_cast<uint64_t>(m_Options.WarmupLoops) * m_Capture->Frames.size();
+        m_MeasuredFrames = static_cast<uint64_t>(m_Options.Loops) * m_Capture->Frames.size();
+
+        m_CPUFrameTimes = pxl::FrameTimeHistory(m_MeasuredFrames);
+        m_GPUFrameTimes = pxl::FrameTimeHistory(m_MeasuredFrames);
+
+        pxl::WindowSpecs specs = {};
+        specs.Title = "pxl_replay";
+        specs.Size = m_Options.Size;
+        specs.RendererAPI = m_Options.RendererAPI.value_or(m_Capture->API);
+        specs.Visible = false;
+
+        m_Window = pxl::Window::Create(specs);
+
+        pxl::Renderer::Init(m_Window);
+        pxl::Renderer::SetParallelRecording(m_Options.ParallelRecording);
+
+        // Measure how fast the backend can go, not the display
+        m_Window->GetGraphicsContext()->SetVSync(false);
+        SetFramerateMode(pxl::FramerateMode::Unlimited);
+
+        // Captured flushes carry their own camera matrices, but the renderer still expects every target to have a camera
+        m_Camera = pxl::Camera::CreateOrthographic({
+            .AspectRatio = m_Window->GetAspectRatio(),
+        });
+        pxl::Renderer::SetCameraAll(m_Camera);
+
+        m_Replayer = std::make_unique<pxl::RenderCaptureReplayer>(m_Capture);
+
+        APP_LOG_INFO("Replaying {} captured frames on {} ({} warmup loops, {} measured loops)", m_Replayer->GetFrameCount(),
+            pxl::EnumStringHelper::ToString(specs.RendererAPI), m_Options.WarmupLoops, m_Options.Loops);
+    }
+
+    void ReplayApplication::OnUpdate([[maybe_unused]] float dt)
+    {
+        PXL_PROFILE_SCOPE;
+
+        // The stats read here describe the previous frame, which was the last warmup frame on the first measured frame
+        if (m_FramesRendered > m_WarmupFrames)
+            SampleFrame();
+
+        if (m_SampledFrames == m_MeasuredFrames)
+        {
+            m_Succeeded = WriteResults();
+            Close();
+            return;
+        }
+
+        m_Replayer->PrepareFrame(m_FrameIndex);
+    }
+
+    void ReplayApplication::OnRender()
+    {
+        PXL_PROFILE_SCOPE;
+
+        // Frames where the pipelines are still compiling don't draw anything, so don't count them
+        if (!pxl::Renderer::ArePipelinesReady())
+            return;
+
+        m_Replayer->ReplayFrame(m_FrameIndex);
+
+        m_FrameIndex = (m_FrameIndex + 1) % m_Replayer->GetFrameCount();
+        m_FramesRendered++;
+    }
+
+    void ReplayApplication::SampleFrame()
+    {
+        const auto& stats = pxl::Renderer::GetLastFrameStats();
+
+        m_CPUFrameTimes.Add(pxl::Renderer::GetFrameTimeMS());
+
+        // GPU results lag a few frames behind, so the same timings are reported until the next frame's are read back
+        if (stats.GPUTimingSequence != m_LastGPUTimingSequence)
+        {
+            m_GPUFrameTimes.Add(stats.GPUTime);
+            m_LastGPUTimingSequence = stats.GPUTimingSequence;
+        }
+
+        m_DrawCalls += stats.DrawCalls;
+        m_SampledFrames++;
+    }
+
+    bool ReplayApplication::WriteResults()
+    {
+        auto cpuFrameTime = m_CPUFrameTimes.GetSummary();
+
+        std::string json = std::format(R"({{"capture":"{}","renderer_api":"{}","width":{},"height":{},"captured_frames":{},"loops":{},"warmup_loops":{},"parallel_recording":{},)",
+            m_Options.CapturePath.filename().string(), pxl::EnumStringHelper::ToString(pxl::Renderer::GetCurrentAPI()), m_Options.Size.Width, m_Options.Size.Height,
+            m_Capture->Frames.size(), m_Options.Loops, m_Options.WarmupLoops, m_Options.ParallelRecording);
+
+        json += std::format(R"("frames":{},"cpu_frame_time_ms":{},"gpu_frame_time_ms":{},"draw_calls":{:.2f}}})",
+            m_SampledFrames, ToJSON(cpuFrameTime), ToJSON(m_GPUFrameTimes.GetSummary()), m_DrawCalls / std::max<double>(m_SampledFrames, 1.0));
+
+        json += "\n";
+
+        APP_LOG_INFO("Finished replay: {:.3f}ms mean, {:.3f}ms p99", cpuFrameTime.Mean, cpuFrameTime.P99);
+
+        if (!m_Options.OutputPath)
+        {
+            std::cout << json;
+            return true;
+        }
+
+        std::ofstream file(*m_Options.OutputPath, std::ios::trunc);
+
+        if (!file.is_open())
+        {
+            APP_LOG_ERROR("Failed to write replay results to '{}'", m_Options.OutputPath->string());
+            return false;
+        }
+
+        file << json;
+
+        APP_LOG_INFO("Replay results written to '{}'", m_Options.OutputPath->string());
+        return true;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <pxl/pxl.h>
+
+namespace Replay
+{
+    struct ReplayOptions
+    {
+        std::filesystem::path CapturePath;
+        std::optional<pxl::RendererAPIType> RendererAPI; // Defaults to the API the capture was made with
+        uint32_t Loops = 10;      // Times the capture is played through while measuring
+        uint32_t WarmupLoops = 1; // Times the capture is played through before measuring
+        pxl::Size2D Size = { 1280, 720 };
+        bool ParallelRecording = false;
+        std::optional<std::filesystem::path> OutputPath; // Results are printed to stdout if not set
+    };
+
+    /// @brief Replays a render capture as fast as possible in a hidden window, then writes the frame timings as JSON and closes.
+    /// Only the renderer's backend runs, so the timings compare backends on exactly the same command stream
+    class ReplayApplication : public pxl::Application
+    {
+    public:
+        ReplayApplication(const ReplayOptions& options, const std::shared_ptr<pxl::RenderCaptureFile>& capture);
+
+        virtual void OnUpdate(float dt) override;
+        virtual void OnRender() override;
+
+        bool Succeeded() const { return m_Succeeded; }
+
+    private:
+        void SampleFrame();
+        bool WriteResults();
+
+    private:
+        ReplayOptions m_Options;
+
+        std::shared_ptr<pxl::Window> m_Window = nullptr;
+        std::shared_ptr<pxl::Camera> m_Camera = nullptr;
+
+        std::shared_ptr<pxl::RenderCaptureFile> m_Capture = nullptr;
+        std::unique_ptr<pxl::RenderCaptureReplayer> m_Replayer = nullptr;
+
+        size_t m_FrameIndex = 0;
+        uint64_t m_FramesRendered = 0;
+        uint64_t m_WarmupFrames = 0;
+        uint64_t m_MeasuredFrames = 0;
+
+        pxl::FrameTimeHistory m_CPUFrameTimes;
+        pxl::FrameTimeHistory m_GPUFrameTimes;
+        uint64_t m_LastGPUTimingSequence = 0; // GPU timings are only sampled when a new frame's have been read back
+        double m_DrawCalls = 0.0;
+        uint64_t m_SampledFrames = 0;
+
+        bool m_Succeeded = false;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,242 @@
+#include "BenchApplication.h"
+
+#include <fstream>
+#include <iostream>
+
+#include <Utils/Hash.h>
+
+#include "Scenes/CubesScene.h"
+#include "Scenes/LinesScene.h"
+#include "Scenes/MeshScene.h"
+#include "Scenes/QuadsScene.h"
+
+namespace Bench
+{
+    // Scenes always advance by the same step, so frame N looks the same no matter how long frame N-1 took
+    static constexpr float k_FixedStep = 1.0f / 60.0f;
+
+    static std::string ToJSON(const pxl::FrameTimeSummary& summary)
+    {
+        if (summary.SampleCount == 0)
+            return "null";
+
+        return std::format(R"({{"mean":{:.4f},"p50":{:.4f},"p95":{:.4f},"p99":{:.4f},"max":{:.4f},"one_percent_low":{:.4f},"stutters":{}}})",
+            summary.Mean, summary.P50, summary.P95, summary.P99, summary.Max, summary.OnePercentLow, summary.StutterCount);
+    }
+
+    static std::string ToJSON(const std::array<double, pxl::k_GPUTimerSectionCount>& sectionTimes)
+    {
+        std::string json = "{";
+
+        for (size_t i = 0; i < sectionTimes.size(); i++)
+        {
+            auto name = pxl::EnumStringHelper::ToString(static_cast<pxl::GPUTimerSection>(i));
+            json += std::format(R"({}"{}":{:.4f})", i > 0 ? "," : "", name, sectionTimes[i]);
+        }
+
+        return json + "}";
+    }
+
+    BenchApplication::BenchApplication(const BenchOptions& options)
+        : m_Options(options), m_CPUFrameTimes(options.Frames), m_GPUFrameTimes(options.Frames)
+    {
+        if (m_Options.Headless)
+        {
+            pxl::Renderer::Init(m_Options.RendererAPI, { .Size = m_Options.Size });
+        }
+        else
+        {
+            pxl::WindowSpecs specs = {};
+            specs.Title = "pxl_bench";
+            specs.Size = m_Options.Size;
+            specs.RendererAPI = m_Options.RendererAPI;
+            specs.Visible = false;
+
+            m_Window = pxl::Window::Create(specs);
+
+            pxl::Renderer::Init(m_Window);
+        }
+
+        pxl::Renderer::SetParallelRecording(m_Options.ParallelRecording);
+
+        // Measure how fast the renderer can go, not the display
+        pxl::Renderer::GetGraphicsContext()->SetVSync(false);
+        SetFramerateMode(pxl::FramerateMode::Unlimited);
+
+        if (m_Options.CapturePath)
+            pxl::RenderCapture::Begin(*m_Options.CapturePath);
+
+        StartScene(0);
+    }
+
+    void BenchApplication::OnUpdate(float dt)
+    {
+        PXL_PROFILE_SCOPE;
+
+        if (!m_Scene)
+            return;
+
+        // The stats read here describe the previous frame, which was the last warmup frame on the first measured frame
+        if (m_FrameInScene > m_Options.WarmupFrames)
+            SampleFrame();
+
+        if (m_SampledFrames == m_Options.Frames)
+        {
+            FinishScene();
+
+            if (m_SceneIndex + 1 < m_Options.Scenes.size())
+            {
+                StartScene(m_SceneIndex + 1);
+            }
+            else
+            {
+                pxl::RenderCapture::End();
+
+                m_Succeeded = WriteResults();
+                Close();
+                return;
+            }
+        }
+
+        m_Scene->OnUpdate(k_FixedStep);
+
+        // Frames where the pipelines are still compiling don't draw anything, so don't count them as warmup
+        if (pxl::Renderer::ArePipelinesReady())
+            m_FrameInScene++;
+    }
+
+    void BenchApplication::OnRender()
+    {
+        PXL_PROFILE_SCOPE;
+
+        if (m_Scene)
+            m_Scene->OnRender();
+    }
+
+    std::unique_ptr<Scene> BenchApplication::CreateScene(const std::string& name)
+    {
+        if (name == "Quads")
+            return std::make_unique<QuadsScene>();
+        else if (name == "Cubes")
+            return std::make_unique<CubesScene>();
+        else if (name == "Lines")
+            return std::make_unique<LinesScene>();
+        else if (name == "Meshes")
+            return std::make_unique<MeshScene>();
+
+        return nullptr;
+    }
+
+    void BenchApplication::StartScene(size_t index)
+    {
+        m_SceneIndex = index;
+        m_FrameInScene = 0;
+        m_SampledFrames = 0;
+
+        m_CPUFrameTimes.Clear();
+        m_GPUFrameTimes.Clear();
+
+        m_Scene = CreateScene(m_Options.Scenes[index]);
+        PXL_ASSERT_MSG(m_Scene, "Unknown benchmark scene '{}'", m_Options.Scenes[index]);
+
+        m_Current = {};
+        m_Current.Name = m_Scene->GetName();
+
+        auto size = m_Window ? m_Window->GetSize() : m_Options.Size;
+
+        // Each scene gets its own seed so adding or reordering scenes doesn't change the others
+        m_Scene->OnStart(size, m_Options.Seed + static_cast<uint32_t>(pxl::Hash::FNV1a(m_Current.Name) & 0xFFFF));
+
+        APP_LOG_INFO("Running benchmark scene '{}' ({} warmup frames, {} measured frames)", m_Current.Name, m_Options.WarmupFrames, m_Options.Frames);
+    }
+
+    void BenchApplication::SampleFrame()
+    {
+        const auto& stats = pxl::Renderer::GetLastFrameStats();
+
+        m_CPUFrameTimes.Add(pxl::Renderer::GetFrameTimeMS());
+
+        // GPU results lag a few frames behind, so the same timings are reported until the next frame's are read back
+        if (stats.GPUTimingSequence != m_LastGPUTimingSequence)
+        {
+            m_GPUFrameTimes.Add(stats.GPUTime);
+            m_LastGPUTimingSequence = stats.GPUTimingSequence;
+        }
+
+        auto triangles = stats.QuadIndexCount / 3 + stats.CubeIndexCount / 3 + stats.MeshIndexCount / 3;
+        auto vertices = stats.QuadVertexCount + stats.CubeVertexCount + stats.LineVertexCount + stats.MeshVertexCount;
+
+        m_Current.DrawCalls += stats.DrawCalls;
+        m_Current.Vertices += vertices;
+        m_Current.Triangles += triangles;
+
+        for (size_t i = 0; i < pxl::k_GPUTimerSectionCount; i++)
+        {
+            m_Current.CPUSectionTimes[i] += stats.CPUSectionTimes[i];
+            m_Current.GPUSectionTimes[i] += stats.GPUSectionTimes[i];
+        }
+
+        m_SampledFrames++;
+    }
+
+    void BenchApplication::FinishScene()
+    {
+        double frames = std::max<double>(m_SampledFrames, 1.0);
+
+        m_Current.Frames = m_SampledFrames;
+        m_Current.CPUFrameTime = m_CPUFrameTimes.GetSummary();
+        m_Current.GPUFrameTime = m_GPUFrameTimes.GetSummary();
+        m_Current.DrawCalls /= frames;
+        m_Current.Vertices /= frames;
+        m_Current.Triangles /= frames;
+
+        for (size_t i = 0; i < pxl::k_GPUTimerSectionCount; i++)
+        {
+            m_Current.CPUSectionTimes[i] /= frames;
+            m_Current.GPUSectionTimes[i] /= frames;
+        }
+
+        APP_LOG_INFO("Finished benchmark scene '{}': {:.3f}ms mean, {:.3f}ms p99", m_Current.Name, m_Current.CPUFrameTime.Mean, m_Current.CPUFrameTime.P99);
+
+        m_Scene->OnStop();
+        m_Scene = nullptr;
+
+        m_Results.push_back(m_Current);
+    }
+
+    bool BenchApplication::WriteResults()
+    {
+        std::string json = std::format(R"({{"renderer_api":"{}","width":{},"height":{},"seed":{},"warmup_frames":{},"parallel_recording":{},"scenes":[)",
+            pxl::EnumStringHelper::ToString(m_Options.RendererAPI), m_Options.Size.Width, m_Options.Size.Height, m_Options.Seed, m_Options.WarmupFrames, m_Options.ParallelRecording);
+
+        for (size_t i = 0; i < m_Results.size(); i++)
+        {
+            const auto& result = m_Results[i];
+
+            json += std::format(R"({}{{"name":"{}","frames":{},"cpu_frame_time_ms":{},"gpu_frame_time_ms":{},"draw_calls":{:.2f},"vertices":{:.2f},"triangles":{:.2f},"cpu_section_ms":{},"gpu_section_ms":{}}})",
+                i > 0 ? "," : "", result.Name, result.Frames, ToJSON(result.CPUFrameTime), ToJSON(result.GPUFrameTime), result.DrawCalls, result.Vertices, result.Triangles,
+                ToJSON(result.CPUSectionTimes), ToJSON(result.GPUSectionTimes));
+        }
+
+        json += "]}\n";
+
+        if (!m_Options.OutputPath)
+        {
+            std::cout << json;
+            return true;
+        }
+
+        std::ofstream file(*m_Options.OutputPath, std::ios::trunc);
+
+        if (!file.is_open())
+        {
+            APP_LOG_ERROR("Failed to write benchmark results to '{}'", m_Options.OutputPath->string());
+            return false;
+        }
+
+        file << json;
+
+        APP_LOG_INFO("Benchmark results written to '{}'", m_Options.OutputPath->string());
+        return true;
+    }
+}
\ No newline at end of file
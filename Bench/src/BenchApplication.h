@@ -0,0 +1,76 @@
+#pragma once
+
+#include <pxl/pxl.h>
+
+#include "Scenes/Scene.h"
+
+namespace Bench
+{
+    struct BenchOptions
+    {
+        pxl::RendererAPIType RendererAPI = pxl::RendererAPIType::OpenGL;
+        std::vector<std::string> Scenes = { "Quads", "Cubes", "Lines", "Meshes" };
+        uint32_t Frames = 600;      // Frames measured per scene
+        uint32_t WarmupFrames = 60; // Frames rendered before measuring, so pipelines, caches and clocks settle
+        uint32_t Seed = 1;
+        pxl::Size2D Size = { 1280, 720 };
+        bool ParallelRecording = false;
+        bool Headless = false; // Draws into an offscreen framebuffer instead of a hidden window, so no display is needed
+        std::optional<std::filesystem::path> OutputPath; // Results are printed to stdout if not set
+        std::optional<std::filesystem::path> CapturePath; // Writes a render capture of every frame for pxl_replay if set
+    };
+
+    // Averages over the measured frames of one scene
+    struct SceneResult
+    {
+        std::string Name;
+        uint32_t Frames = 0;
+        pxl::FrameTimeSummary CPUFrameTime;
+        pxl::FrameTimeSummary GPUFrameTime;
+        double DrawCalls = 0.0;
+        double Vertices = 0.0;
+        double Triangles = 0.0;
+        std::array<double, pxl::k_GPUTimerSectionCount> CPUSectionTimes = {};
+        std::array<double, pxl::k_GPUTimerSectionCount> GPUSectionTimes = {};
+    };
+
+    /// @brief Runs each scene for a fixed number of frames offscreen (or in a hidden window), then writes the results as JSON and closes.
+    /// Scenes are updated with a fixed step so the rendered frames don't depend on how fast the host is
+    class BenchApplication : public pxl::Application
+    {
+    public:
+        BenchApplication(const BenchOptions& options);
+
+        virtual void OnUpdate(float dt) override;
+        virtual void OnRender() override;
+
+        bool Succeeded() const { return m_Succeeded; }
+
+        static std::unique_ptr<Scene> CreateScene(const std::string& name);
+
+    private:
+        void StartScene(size_t index);
+        void SampleFrame();
+        void FinishScene();
+        bool WriteResults();
+
+    private:
+        BenchOptions m_Options;
+
+        std::shared_ptr<pxl::Window> m_Window = nullptr; // Only created if not headless
+
+        std::unique_ptr<Scene> m_Scene = nullptr;
+        size_t m_SceneIndex = 0;
+        uint32_t m_FrameInScene = 0;
+        uint32_t m_SampledFrames = 0;
+
+        // Accumulated over the measured frames of the current scene
+        pxl::FrameTimeHistory m_CPUFrameTimes;
+        pxl::FrameTimeHistory m_GPUFrameTimes;
+        uint64_t m_LastGPUTimingSequence = 0; // GPU timings are only sampled when a new frame's have been read back
+        SceneResult m_Current;
+
+        std::vector<SceneResult> m_Results;
+        bool m_Succeeded = false;
+    };
+}
\ No newline at end of file
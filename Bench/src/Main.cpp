@@ -0,0 +1,146 @@
+#include "BenchApplication.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+// pxl_bench renders scripted scenes for a fixed number of frames and writes the timings as JSON.
+//
+// Usage: pxl_bench [--api OpenGL|Vulkan|Null] [--scene Quads|Cubes|Lines|Meshes|All] [--frames N] [--warmup N]
+//                  [--seed N] [--size WIDTHxHEIGHT] [--parallel-recording] [--software] [--output results.json]
+//                  [--capture capture.pxrc] [--window]
+//
+// On GPU-less hosts, run it with --software, which selects Mesa's llvmpipe for OpenGL and lavapipe for Vulkan.
+// Frames are drawn into an offscreen framebuffer with --software or when there's no display to open a window on,
+// otherwise (or with --window) they're drawn into a hidden window.
+
+static void PrintUsage()
+{
+    std::printf("Usage: pxl_bench [--api OpenGL|Vulkan|Null] [--scene Quads|Cubes|Lines|Meshes|All] [--frames N] [--warmup N]\n"
+                "                 [--seed N] [--size WIDTHxHEIGHT] [--parallel-recording] [--software] [--output results.json]\n"
+                "                 [--capture capture.pxrc] [--window]\n");
+}
+
+static void UseSoftwareRenderers()
+{
+#ifdef _WIN32
+    _putenv_s("LIBGL_ALWAYS_SOFTWARE", "1");
+    _putenv_s("VK_LOADER_DRIVERS_SELECT", "*lvp*");
+#else
+    setenv("LIBGL_ALWAYS_SOFTWARE", "1", 1);
+    setenv("VK_LOADER_DRIVERS_SELECT", "*lvp*", 1);
+#endif
+}
+
+static bool HasDisplay()
+{
+#ifdef _WIN32
+    return true;
+#else
+    return std::getenv("DISPLAY") || std::getenv("WAYLAND_DISPLAY");
+#endif
+}
+
+int main(int argc, char* argv[])
+{
+    PXL_INIT_LOGGING;
+
+    Bench::BenchOptions options;
+    bool software = false;
+    bool forceWindow = false;
+
+    // NOTE: Purposefully skips the first argument (the program's name/path)
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--api" && hasValue)
+        {
+            std::string value = argv[++i];
+
+            if (value == "OpenGL")
+                options.RendererAPI = pxl::RendererAPIType::OpenGL;
+            else if (value == "Vulkan")
+                options.RendererAPI = pxl::RendererAPIType::Vulkan;
+            else if (value == "Null")
+                options.RendererAPI = pxl::RendererAPIType::Null;
+            else
+            {
+                PrintUsage();
+                return 1;
+            }
+        }
+        else if (arg == "--scene" && hasValue)
+        {
+            std::string value = argv[++i];
+
+            if (value != "All")
+            {
+                if (!Bench::BenchApplication::CreateScene(value))
+                {
+                    std::printf("Unknown scene '%s'\n", value.c_str());
+                    return 1;
+                }
+
+                options.Scenes = { value };
+            }
+        }
+        else if (arg == "--frames" && hasValue)
+        {
+            options.Frames = std::max(static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10)), 1u);
+        }
+        else if (arg == "--warmup" && hasValue)
+        {
+            options.WarmupFrames = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (arg == "--seed" && hasValue)
+        {
+            options.Seed = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (arg == "--size" && hasValue)
+        {
+            uint32_t width = 0, height = 0;
+
+            if (std::sscanf(argv[++i], "%ux%u", &width, &height) != 2 || width == 0 || height == 0)
+            {
+                PrintUsage();
+                return 1;
+            }
+
+            options.Size = { width, height };
+        }
+        else if (arg == "--output" && hasValue)
+        {
+            options.OutputPath = argv[++i];
+        }
+        else if (arg == "--capture" && hasValue)
+        {
+            options.CapturePath = argv[++i];
+        }
+        else if (arg == "--parallel-recording")
+        {
+            options.ParallelRecording = true;
+        }
+        else if (arg == "--software")
+        {
+            UseSoftwareRenderers();
+            software = true;
+        }
+        else if (arg == "--window")
+        {
+            forceWindow = true;
+        }
+        else
+        {
+            PrintUsage();
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    options.Headless = !forceWindow && (software || !HasDisplay());
+
+    Bench::BenchApplication app(options);
+    app.Run();
+
+    return app.Succeeded() ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include "CubesScene.h"
+
+namespace Bench
+{
+    static constexpr int32_t k_GridSize = 16;      // Dynamic cubes per axis
+    static constexpr int32_t k_FloorSize = 32;     // Static cubes per axis
+    static constexpr float k_CubeSpacing = 2.0f;
+
+    void CubesScene::OnStart(const pxl::Size2D& size, uint32_t seed)
+    {
+        m_Camera = pxl::Camera::CreatePerspective({
+            .FOV = 45.0f,
+            .AspectRatio = GetAspectRatio(size),
+            .NearClip = 0.1f,
+            .FarClip = 1000.0f,
+        });
+
+        m_Camera->SetPosition({ 0.0f, 8.0f, 60.0f });
+
+        pxl::Renderer::SetCamera(pxl::RendererGeometryTarget::Cube, m_Camera);
+        pxl::Renderer::SetClearColour({ 0.5f, 0.3f, 0.6f, 1.0f });
+
+        Random random(seed);
+
+        float floorOffset = (k_FloorSize - 1) * k_CubeSpacing / 2.0f;
+        for (int32_t x = 0; x < k_FloorSize; x++)
+        {
+            for (int32_t z = 0; z < k_FloorSize; z++)
+            {
+                glm::vec3 position = { x * k_CubeSpacing - floorOffset, -20.0f, z * k_CubeSpacing - floorOffset };
+                pxl::Renderer::AddStaticCube(position, glm::vec3(0.0f), glm::vec3(1.5f), random.Colour());
+            }
+        }
+
+        pxl::Renderer::StaticGeometryReady();
+
+        float gridOffset = (k_GridSize - 1) * k_CubeSpacing / 2.0f;
+        m_Cubes.reserve(k_GridSize * k_GridSize * k_GridSize);
+
+        for (int32_t x = 0; x < k_GridSize; x++)
+        {
+            for (int32_t y = 0; y < k_GridSize; y++)
+            {
+                for (int32_t z = 0; z < k_GridSize; z++)
+                {
+                    pxl::Cube cube;
+                    cube.Position = glm::vec3(x, y, z) * k_CubeSpacing - glm::vec3(gridOffset);
+                    cube.Rotation = random.Vec3(0.0f, 360.0f);
+                    cube.Colour = random.Colour();
+                    m_Cubes.push_back(cube);
+                }
+            }
+        }
+    }
+
+    void CubesScene::OnUpdate(float step)
+    {
+        for (auto& cube : m_Cubes)
+            cube.Rotation = glm::mod(cube.Rotation + glm::vec3(60.0f * step), glm::vec3(360.0f));
+    }
+
+    void CubesScene::OnRender()
+    {
+        for (const auto& cube : m_Cubes)
+            pxl::Renderer::AddCube(cube);
+    }
+
+    void CubesScene::OnStop()
+    {
+        pxl::Renderer::ResetStaticGeometry(pxl::RendererGeometryTarget::Cube);
+    }
+}
\ No newline at end of file
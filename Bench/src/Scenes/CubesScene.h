@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Scene.h"
+
+namespace Bench
+{
+    // Scripted version of TestApp's CubesTest: a rotating grid of dynamic cubes above a floor of static cubes
+    class CubesScene : public Scene
+    {
+    public:
+        virtual void OnStart(const pxl::Size2D& size, uint32_t seed) override;
+        virtual void OnUpdate(float step) override;
+        virtual void OnRender() override;
+        virtual void OnStop() override;
+
+        virtual std::string GetName() const override { return "Cubes"; }
+
+    private:
+        std::shared_ptr<pxl::PerspectiveCamera> m_Camera = nullptr;
+        std::vector<pxl::Cube> m_Cubes;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+#include "LinesScene.h"
+
+namespace Bench
+{
+    static constexpr uint32_t k_LineCount = 20000;
+
+    void LinesScene::OnStart(const pxl::Size2D& size, uint32_t seed)
+    {
+        m_Camera = pxl::Camera::CreatePerspective({
+            .FOV = 45.0f,
+            .AspectRatio = GetAspectRatio(size),
+            .NearClip = 0.01f,
+            .FarClip = 1000.0f,
+        });
+
+        m_Camera->SetPosition({ 0.0f, 0.0f, 30.0f });
+
+        pxl::Renderer::SetCamera(pxl::RendererGeometryTarget::Line, m_Camera);
+        pxl::Renderer::SetClearColour({ 0.078f, 0.094f, 0.109f, 1.0f });
+
+        Random random(seed);
+
+        m_Lines.resize(k_LineCount);
+
+        for (auto& line : m_Lines)
+        {
+            line.StartPosition = random.Vec3(-10.0f, 10.0f);
+            line.EndPosition = line.StartPosition + random.Vec3(-2.0f, 2.0f);
+            line.Rotation = glm::vec3(0.0f);
+            line.Colour = random.Colour();
+        }
+    }
+
+    void LinesScene::OnUpdate(float step)
+    {
+        for (auto& line : m_Lines)
+            line.Rotation.y = std::fmod(line.Rotation.y + 45.0f * step, 360.0f);
+    }
+
+    void LinesScene::OnRender()
+    {
+        for (const auto& line : m_Lines)
+            pxl::Renderer::AddLine(line);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Scene.h"
+
+namespace Bench
+{
+    // Scripted version of TestApp's LinesTest: a cloud of rotating lines
+    class LinesScene : public Scene
+    {
+    public:
+        virtual void OnStart(const pxl::Size2D& size, uint32_t seed) override;
+        virtual void OnUpdate(float step) override;
+        virtual void OnRender() override;
+
+        virtual std::string GetName() const override { return "Lines"; }
+
+    private:
+        std::shared_ptr<pxl::PerspectiveCamera> m_Camera = nullptr;
+        std::vector<pxl::Line> m_Lines;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include "MeshScene.h"
+
+#include <glm/gtc/constants.hpp>
+
+namespace Bench
+{
+    static constexpr int32_t k_GridSize = 10; // Meshes per axis
+    static constexpr uint32_t k_SphereSegments = 48;
+    static constexpr uint32_t k_SphereRings = 24;
+
+    static std::shared_ptr<pxl::Mesh> CreateSphere(Random& random)
+    {
+        auto mesh = std::make_shared<pxl::Mesh>((k_SphereSegments + 1) * (k_SphereRings + 1), k_SphereSegments * k_SphereRings * 6);
+
+        for (uint32_t ring = 0; ring <= k_SphereRings; ring++)
+        {
+            float phi = glm::pi<float>() * static_cast<float>(ring) / k_SphereRings;
+
+            for (uint32_t segment = 0; segment <= k_SphereSegments; segment++)
+            {
+                float theta = glm::two_pi<float>() * static_cast<float>(segment) / k_SphereSegments;
+
+                pxl::MeshVertex vertex;
+                vertex.Position = { std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta) };
+                vertex.Colour = random.Colour();
+                mesh->Vertices.push_back(vertex);
+            }
+        }
+
+        for (uint32_t ring = 0; ring < k_SphereRings; ring++)
+        {
+            for (uint32_t segment = 0; segment < k_SphereSegments; segment++)
+            {
+                uint32_t current = ring * (k_SphereSegments + 1) + segment;
+                uint32_t below = current + k_SphereSegments + 1;
+
+                mesh->Indices.insert(mesh->Indices.end(), { current, below, current + 1, current + 1, below, below + 1 });
+            }
+        }
+
+        return mesh;
+    }
+
+    void MeshScene::OnStart(const pxl::Size2D& size, uint32_t seed)
+    {
+        m_Camera = pxl::Camera::CreatePerspective({
+            .FOV = 60.0f,
+            .AspectRatio = GetAspectRatio(size),
+            .NearClip = 0.01f,
+            .FarClip = 1000.0f,
+        });
+
+        m_Camera->SetPosition({ 0.0f, 0.0f, 30.0f });
+
+        // NOTE: Meshes are drawn with the quad camera
+        pxl::Renderer::SetCamera(pxl::RendererGeometryTarget::Quad, m_Camera);
+        pxl::Renderer::SetClearColour({ 0.2f, 0.2f, 0.2f, 1.0f });
+
+        Random random(seed);
+
+        m_Mesh = CreateSphere(random);
+
+        float offset = (k_GridSize - 1) * 2.5f / 2.0f;
+        for (int32_t x = 0; x < k_GridSize; x++)
+        {
+            for (int32_t y = 0; y < k_GridSize; y++)
+            {
+                m_Positions.push_back({ x * 2.5f - offset, y * 2.5f - offset, 0.0f });
+                m_Rotations.push_back(random.Vec3(0.0f, 360.0f));
+            }
+        }
+    }
+
+    void MeshScene::OnUpdate(float step)
+    {
+        for (auto& rotation : m_Rotations)
+            rotation.y = std::fmod(rotation.y + 30.0f * step, 360.0f);
+    }
+
+    void MeshScene::OnRender()
+    {
+        for (size_t i = 0; i < m_Positions.size(); i++)
+            pxl::Renderer::DrawMesh(m_Mesh, m_Positions[i], m_Rotations[i], glm::vec3(1.0f));
+    }
+
+    void MeshScene::OnStop()
+    {
+        m_Positions.clear();
+        m_Rotations.clear();
+    }
+}
\ No newline at end of file
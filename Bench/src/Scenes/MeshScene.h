@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Scene.h"
+
+namespace Bench
+{
+    // Scripted version of TestApp's ModelViewer: a grid of rotating meshes.
+    // The mesh is generated rather than loaded so the scene doesn't depend on assets or the model importer
+    class MeshScene : public Scene
+    {
+    public:
+        virtual void OnStart(const pxl::Size2D& size, uint32_t seed) override;
+        virtual void OnUpdate(float step) override;
+        virtual void OnRender() override;
+        virtual void OnStop() override;
+
+        virtual std::string GetName() const override { return "Meshes"; }
+
+    private:
+        std::shared_ptr<pxl::PerspectiveCamera> m_Camera = nullptr;
+        std::shared_ptr<pxl::Mesh> m_Mesh = nullptr;
+        std::vector<glm::vec3> m_Positions;
+        std::vector<glm::vec3> m_Rotations;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+#include "QuadsScene.h"
+
+namespace Bench
+{
+    static constexpr uint32_t k_DynamicQuadCount = 10000;
+    static constexpr uint32_t k_StaticQuadCount = 2000;
+
+    void QuadsScene::OnStart(const pxl::Size2D& size, uint32_t seed)
+    {
+        auto width = static_cast<float>(size.Width);
+        auto height = static_cast<float>(size.Height);
+
+        m_Camera = pxl::Camera::CreateOrthographic({
+            .NearClip = -10.0f,
+            .FarClip = 10.0f,
+            .Left = 0.0f,
+            .Right = width,
+            .Bottom = 0.0f,
+            .Top = height,
+            .UseAspectRatio = false,
+        });
+
+        pxl::Renderer::SetCamera(pxl::RendererGeometryTarget::Quad, m_Camera);
+        pxl::Renderer::SetClearColour({ 0.078f, 0.094f, 0.109f, 1.0f });
+
+        Random random(seed);
+
+        for (uint32_t i = 0; i < k_StaticQuadCount; i++)
+        {
+            glm::vec3 position = { random.Float(0.0f, width), random.Float(0.0f, height), -1.0f };
+            glm::vec2 scale = glm::vec2(random.Float(8.0f, 48.0f));
+            pxl::Renderer::AddStaticQuad(position, glm::vec3(0.0f), scale, random.Colour());
+        }
+
+        pxl::Renderer::StaticGeometryReady();
+
+        m_Quads.resize(k_DynamicQuadCount);
+
+        for (auto& quad : m_Quads)
+        {
+            quad.Position = { random.Float(0.0f, width), random.Float(0.0f, height), 0.0f };
+            quad.Rotation = { 0.0f, 0.0f, random.Float(0.0f, 360.0f) };
+            quad.Size = glm::vec2(random.Float(4.0f, 32.0f));
+            quad.Colour = random.Colour();
+        }
+    }
+
+    void QuadsScene::OnUpdate(float step)
+    {
+        for (size_t i = 0; i < m_Quads.size(); i++)
+        {
+            float direction = i % 2 == 0 ? 1.0f : -1.0f;
+            m_Quads[i].Rotation.z = std::fmod(m_Quads[i].Rotation.z + 90.0f * direction * step, 360.0f);
+        }
+    }
+
+    void QuadsScene::OnRender()
+    {
+        for (const auto& quad : m_Quads)
+            pxl::Renderer::AddQuad(quad);
+    }
+
+    void QuadsScene::OnStop()
+    {
+        pxl::Renderer::ResetStaticGeometry(pxl::RendererGeometryTarget::Quad);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Scene.h"
+
+namespace Bench
+{
+    // Scripted version of TestApp's QuadsTest: many rotating dynamic quads over a layer of static quads
+    class QuadsScene : public Scene
+    {
+    public:
+        virtual void OnStart(const pxl::Size2D& size, uint32_t seed) override;
+        virtual void OnUpdate(float step) override;
+        virtual void OnRender() override;
+        virtual void OnStop() override;
+
+        virtual std::string GetName() const override { return "Quads"; }
+
+    private:
+        std::shared_ptr<pxl::OrthographicCamera> m_Camera = nullptr;
+        std::vector<pxl::Quad> m_Quads;
+    };
+}
\ No newline at end of file
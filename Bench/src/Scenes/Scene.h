@@ -0,0 +1,51 @@
+#pragma once
+
+#include <pxl/pxl.h>
+
+#include <random>
+
+namespace Bench
+{
+    // Seeded random numbers that are identical on every platform.
+    // std::mt19937's output is fully specified by the standard, unlike the std distributions, so values are scaled here instead
+    class Random
+    {
+    public:
+        explicit Random(uint32_t seed)
+            : m_Engine(seed)
+        {
+        }
+
+        float Float(float min, float max)
+        {
+            return min + (static_cast<float>(m_Engine()) / static_cast<float>(std::mt19937::max())) * (max - min);
+        }
+
+        glm::vec3 Vec3(float min, float max) { return { Float(min, max), Float(min, max), Float(min, max) }; }
+        glm::vec4 Colour() { return { Float(0.0f, 1.0f), Float(0.0f, 1.0f), Float(0.0f, 1.0f), 1.0f }; }
+
+    private:
+        std::mt19937 m_Engine;
+    };
+
+    inline float GetAspectRatio(const pxl::Size2D& size)
+    {
+        return static_cast<float>(size.Width) / static_cast<float>(size.Height);
+    }
+
+    /// @brief A scripted scene for the benchmark runner. Scenes must only depend on the seed and the fixed update step,
+    /// never on real time or input, so every run draws exactly the same frames
+    class Scene
+    {
+    public:
+        virtual ~Scene() = default;
+
+        // The size is that of the window or offscreen framebuffer being drawn to
+        virtual void OnStart(const pxl::Size2D& size, uint32_t seed) = 0;
+        virtual void OnUpdate(float step) {}
+        virtual void OnRender() = 0;
+        virtual void OnStop() {}
+
+        virtual std::string GetName() const = 0;
+    };
+}
\ No newline at end of file
@@ -27,24 +27,26 @@ namespace TestApp
         ImGui::SetNextWindowSize(ImVec2(250.0f, 300.0f), ImGuiCond_Once);
         ImGui::Begin("TestApp Renderer Stats");
 
-        static float elapsed = 0.0f;
-        static float fps = 0.0f;
-        if (elapsed > 30.0f)
-        {
-            fps = rendererStats.FPS;
-            elapsed = 0.0f;
-        }
-
-        elapsed += rendererStats.FrameTime;
+        auto frameTimes = pxl::Renderer::GetFrameTimeSummary();
 
-        ImGui::Text("FPS: %.0f", std::round(fps));
+        ImGui::Text("FPS: %.0f", rendererStats.AverageFrameTime > 0.0f ? std::round(1000.0f / rendererStats.AverageFrameTime) : 0.0f);
         ImGui::Text("Frame Time (MS): %.3f", rendererStats.FrameTime);
+        ImGui::Text("- p50/p95/p99: %.2f / %.2f / %.2f", frameTimes.P50, frameTimes.P95, frameTimes.P99);
+        ImGui::Text("- 1%% Low FPS: %.0f", frameTimes.GetOnePercentLowFPS());
+        ImGui::Text("- Stutters: %u", rendererStats.StutterCount);
         ImGui::Text("Draw Calls: %u", rendererStats.DrawCalls);
         ImGui::Text("Texture Binds: %u", rendererStats.TextureBinds);
         ImGui::Text("Total Triangle Count: %u", rendererStats.GetTotalTriangleCount());
         ImGui::Text("Total Vertex Count: %u", rendererStats.GetTotalVertexCount());
         ImGui::Text("Total Index Count: %u", rendererStats.GetTotalIndexCount());
 
+        ImGui::Text("GPU Time (MS): %.3f", rendererStats.GPUTime);
+        for (size_t i = 0; i < pxl::k_GPUTimerSectionCount; i++)
+        {
+            auto section = static_cast<pxl::GPUTimerSection>(i);
+            ImGui::Text("- %s: %.3f", pxl::EnumStringHelper::ToString(section).c_str(), rendererStats.GetGPUSectionTime(section));
+        }
+
         static bool enableVSync = pxl::Renderer::GetGraphicsContext()->GetVSync();
         if (ImGui::Checkbox("Enable VSync", &enableVSync))
             pxl::Renderer::GetGraphicsContext()->SetVSync(enableVSync);
@@ -8,6 +8,7 @@
 #include "../src/Core/Config.h"
 #include "../src/Core/Image.h"
 #include "../src/Core/Input.h"
+#include "../src/Core/JobSystem.h"
 #include "../src/Core/KeyCodes.h"
 #include "../src/Core/Logging/ApplicationLog.h"
 #include "../src/Core/MouseCodes.h"
@@ -26,11 +27,17 @@
 // Renderer
 #include "../src/Renderer/BufferLayout.h"
 #include "../src/Renderer/Camera.h"
+#include "../src/Renderer/FrameReadback.h"
+#include "../src/Renderer/FrameRecorder.h"
+#include "../src/Renderer/Framebuffer.h"
 #include "../src/Renderer/GraphicsContext.h"
+#include "../src/Renderer/Null/NullCommandRecorder.h"
 #include "../src/Renderer/OrthographicCamera.h"
 #include "../src/Renderer/PerspectiveCamera.h"
 #include "../src/Renderer/Pipeline.h"
 #include "../src/Renderer/Primitives/Quad.h"
+#include "../src/Renderer/RenderCapture.h"
+#include "../src/Renderer/RenderThread.h"
 #include "../src/Renderer/Renderer.h"
 #include "../src/Renderer/RendererAPIType.h"
 #include "../src/Renderer/RendererData.h"
@@ -57,6 +64,7 @@
 // Utils
 #include "../src/Utils/EnumStringHelper.h"
 #include "../src/Utils/FileSystem.h"
+#include "../src/Utils/ImageEncoder.h"
 #include "../src/Utils/Random.h"
 
 #ifdef PXL_ENABLE_MODULE_DISCORD
@@ -3,10 +3,11 @@
 #include "Config.h"
 #include "Debug/GUI/GUI.h"
 #include "Input.h"
+#include "JobSystem.h"
 #include "Platform.h"
 #include "Renderer/Camera.h"
+#include "Renderer/RenderThread.h"
 #include "Renderer/Renderer.h"
-#include "Stopwatch.h"
 #include "Window.h"
 
 using namespace std::literals;
@@ -24,9 +25,15 @@ namespace pxl
 
         PXL_INIT_LOGGING;
 
+        PXL_PROFILE_THREAD("Main Thread");
+
         FrameworkConfig::Init();
 
-        m_EventManager = std::make_unique<EventManager>();
+        JobSystem::Init(FrameworkConfig::GetSettings().JobWorkerCount);
+
+        m_EventManager = std::make_unique<EventManager>(FrameworkConfig::GetSettings().PostedEventCapacity);
+
+        m_LastFrameStartTime = std::chrono::steady_clock::now();
     }
 
     Application::~Application()
@@ -38,33 +45,64 @@ namespace pxl
 
     void Application::Run()
     {
+        const auto& settings = FrameworkConfig::GetSettings();
+        auto latencySettings = LatencySettings::FromMode(settings.LatencyModeSetting, settings.FramesInFlight);
+
         while (m_Running)
         {
             PXL_PROFILE_SCOPE;
             m_FrameStartTime = std::chrono::steady_clock::now();
 
-            float time = static_cast<float>(Platform::GetTime());
-            float deltaTime = time - m_LastFrameTime;
-            m_LastFrameTime = time;
+            auto frameDuration = m_FrameStartTime - m_LastFrameStartTime;
+            m_LastFrameStartTime = m_FrameStartTime;
+
+            float deltaTime = static_cast<float>(std::chrono::duration<double>(frameDuration).count());
+
+            // Waiting here rather than after acquiring the next image means input is sampled as late as possible,
+            // trading throughput for latency. The render thread already paces itself, so don't wait on it
+            if (latencySettings.WaitForPreviousFrame && Renderer::IsInitialized() && !RenderThread::IsRunning())
+                Renderer::GetGraphicsContext()->WaitForPreviousFrame();
 
             Window::ProcessEvents();
             m_EventManager->ProcessQueue();
 
+            auto inputTimestamp = std::chrono::steady_clock::now();
+
+            JobSystem::RunMainThreadJobs();
+
             if (!m_Minimized && m_Running)
             {
+                if (m_FixedTimestep > 0ns)
+                    RunFixedUpdates(frameDuration);
+
                 OnUpdate(deltaTime);
 
                 if (Renderer::IsInitialized())
                 {
                     Camera::UpdateAll();
-                    Renderer::Begin();
-                    OnRender();
-                    Renderer::End();
+
+                    if (RenderThread::IsRunning())
+                    {
+                        // OnRender only records here, the render thread draws and presents the packet while the next frame is simulated
+                        auto& packet = RenderThread::AcquirePacket();
+                        packet.InputTimestamp = inputTimestamp;
+                        OnRender(m_InterpolationAlpha);
+                        RenderThread::SubmitPacket();
+                    }
+                    else
+                    {
+                        Renderer::Begin();
+                        OnRender(m_InterpolationAlpha);
+                        Renderer::End();
+                    }
                 }
             }
 
             Window::UpdateAll();
 
+            if (!m_Minimized && Renderer::IsInitialized() && !RenderThread::IsRunning())
+                Renderer::RecordInputLatency(inputTimestamp);
+
             // Limit the frame rate if necessary
             if (m_FramerateMode != FramerateMode::Unlimited)
                 LimitFPS();
@@ -85,13 +123,21 @@ namespace pxl
 
         PXL_LOG_INFO(LogArea::Core, "Application closing...");
 
+        // Save any capture that's still running rather than losing it
+        if (Profiler::IsCapturing())
+            Profiler::EndCapture();
+
         OnClose();
 
+        // Finish any in-flight frame packets before the systems they use are shut down
+        RenderThread::Stop();
+
         FrameworkConfig::Shutdown();
         GUI::Shutdown();
         Renderer::Shutdown();
         Input::Shutdown();
         Window::Shutdown();
+        JobSystem::Shutdown();
     }
 
     void Application::SetFramerateMode(FramerateMode mode)
@@ -112,28 +158,53 @@ namespace pxl
         m_FramerateMode = mode;
     }
 
+    void Application::SetFixedTimestep(double seconds)
+    {
+        m_FixedTimestep = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(std::max(seconds, 0.0)));
+        m_FixedAccumulator = 0ns;
+        m_InterpolationAlpha = 1.0f;
+    }
+
+    void Application::RunFixedUpdates(std::chrono::steady_clock::duration frameDuration)
+    {
+        PXL_PROFILE_SCOPE;
+
+        // Time is accumulated in integer nanoseconds so steps never drift from rounding
+        m_FixedAccumulator += std::chrono::duration_cast<std::chrono::nanoseconds>(frameDuration);
+
+        float step = static_cast<float>(std::chrono::duration<double>(m_FixedTimestep).count());
+        uint32_t steps = 0;
+
+        while (m_FixedAccumulator >= m_FixedTimestep)
+        {
+            if (steps == m_MaxFixedStepsPerFrame)
+            {
+                // Drop the time we couldn't simulate rather than falling further behind every frame
+                m_DroppedFixedStepCount += m_FixedAccumulator / m_FixedTimestep;
+                m_FixedAccumulator %= m_FixedTimestep;
+                break;
+            }
+
+            OnFixedUpdate(step);
+
+            m_FixedAccumulator -= m_FixedTimestep;
+            m_FixedTickCount++;
+            steps++;
+        }
+
+        m_InterpolationAlpha = static_cast<float>(static_cast<double>(m_FixedAccumulator.count()) / static_cast<double>(m_FixedTimestep.count()));
+    }
+
     void Application::LimitFPS()
     {
-        auto frameTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_FrameStartTime);
         uint32_t limit = 0;
 
-        // TODO: use a function to return a suitable limit, and skip the next steps if its 0 (unlimited)
         if (m_FramerateMode == FramerateMode::Custom)
             limit = m_CustomFPSLimit;
         else if (m_FramerateMode == FramerateMode::GSYNC)
             limit = m_GsyncFPSLimit;
 
-        auto us = std::chrono::microseconds(1s) / limit;
-        auto overhead = us - frameTime;
-
-        if (overhead > 0us)
-        {
-            // TODO: Stopwatch uses high resolution clock, which can go backwards, and therefore breaks if the time is changed on the OS
-            // To fix, this should be using a steady clock stopwatch variant
-            Stopwatch wait;
-            while (wait.GetElapsedMicroSec() < overhead.count())
-            {
-            }
-        }
+        m_FramePacer.SetTargetFrameRate(limit);
+        m_FramePacer.Wait();
     }
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Events/EventManager.h"
+#include "FramePacer.h"
 
 namespace pxl
 {
@@ -34,6 +35,13 @@ namespace pxl
         // Override these methods in a derived class to add custom logic
         virtual void OnUpdate(float dt) {}
         virtual void OnRender() {}
+
+        // Called zero or more times per frame with a constant step when a fixed timestep is set, before OnUpdate
+        virtual void OnFixedUpdate(float step) {}
+
+        // Override this instead of OnRender() to interpolate between the last two fixed updates.
+        // Alpha is how far the current time is between the previous fixed update and the next one (0 to 1)
+        virtual void OnRender(float alpha) { OnRender(); }
         virtual void OnGUIRender() {} // This function only gets called if ImGui is initialized
         virtual void OnClose() {}
         virtual void OnEvent(const Event& e) {}
@@ -46,6 +54,25 @@ namespace pxl
         FramerateMode GetFramerateMode() const { return m_FramerateMode; }
         void SetFramerateMode(FramerateMode mode);
 
+        // Pacing error and CPU time saved while the frame rate is limited
+        const FramePacerStats& GetFramePacerStats() const { return m_FramePacer.GetStats(); }
+
+        // Runs OnFixedUpdate at the given interval in seconds, 0 disables fixed updates
+        void SetFixedTimestep(double seconds);
+        double GetFixedTimestep() const { return std::chrono::duration<double>(m_FixedTimestep).count(); }
+
+        // Caps how many fixed updates can run in one frame, so a slow frame can't make the next one slower
+        void SetMaxFixedStepsPerFrame(uint32_t steps) { m_MaxFixedStepsPerFrame = steps; }
+        uint32_t GetMaxFixedStepsPerFrame() const { return m_MaxFixedStepsPerFrame; }
+
+        // The number of fixed updates run since the application started
+        uint64_t GetFixedTickCount() const { return m_FixedTickCount; }
+
+        // The number of fixed updates skipped because a frame hit the max fixed steps
+        uint64_t GetDroppedFixedStepCount() const { return m_DroppedFixedStepCount; }
+
+        float GetInterpolationAlpha() const { return m_InterpolationAlpha; }
+
         const std::unique_ptr<EventManager>& GetEventManager() const { return m_EventManager; }
 
         static Application& Get()
@@ -57,16 +84,26 @@ namespace pxl
         static bool Exists() { return s_Instance; }
 
     private:
+        void RunFixedUpdates(std::chrono::steady_clock::duration frameDuration);
         void LimitFPS();
 
     private:
         bool m_Running = true;
         bool m_Minimized = false;
-        float m_LastFrameTime = 0.0f;
+        std::chrono::steady_clock::time_point m_LastFrameStartTime;
         std::chrono::steady_clock::time_point m_FrameStartTime;
         uint32_t m_CustomFPSLimit = 60; // TODO: make constant with config.h
         uint32_t m_GsyncFPSLimit = 0;
         FramerateMode m_FramerateMode = FramerateMode::Unlimited;
+        FramePacer m_FramePacer;
+
+        // Fixed Timestep
+        std::chrono::nanoseconds m_FixedTimestep = std::chrono::nanoseconds::zero();
+        std::chrono::nanoseconds m_FixedAccumulator = std::chrono::nanoseconds::zero();
+        uint32_t m_MaxFixedStepsPerFrame = 8;
+        uint64_t m_FixedTickCount = 0;
+        uint64_t m_DroppedFixedStepCount = 0;
+        float m_InterpolationAlpha = 1.0f;
 
         std::unique_ptr<EventManager> m_EventManager = nullptr;
 
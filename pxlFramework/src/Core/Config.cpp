@@ -42,6 +42,8 @@ namespace pxl
                 s_Settings.RendererAPI = RendererAPIType::OpenGL;
             else if (rendererAPI == "Vulkan")
                 s_Settings.RendererAPI = RendererAPIType::Vulkan;
+            else if (rendererAPI == "Null")
+                s_Settings.RendererAPI = RendererAPIType::Null;
         }
 
         // Window Mode
@@ -87,6 +89,30 @@ namespace pxl
         // Custom FPS Cap
         if (config["CustomFPSCap"].IsDefined())
             s_Settings.CustomFramerateCap = config["CustomFPSCap"].as<uint32_t>();
+
+        // Latency Mode
+        if (config["LatencyMode"].IsDefined())
+        {
+            auto latencyMode = config["LatencyMode"].as<std::string>();
+            if (latencyMode == "Default")
+                s_Settings.LatencyModeSetting = LatencyMode::Default;
+            else if (latencyMode == "Low")
+                s_Settings.LatencyModeSetting = LatencyMode::Low;
+            else if (latencyMode == "Minimum")
+                s_Settings.LatencyModeSetting = LatencyMode::Minimum;
+        }
+
+        // Frames In Flight
+        if (config["FramesInFlight"].IsDefined())
+            s_Settings.FramesInFlight = config["FramesInFlight"].as<uint32_t>();
+
+        // Job Worker Count
+        if (config["JobWorkerCount"].IsDefined())
+            s_Settings.JobWorkerCount = config["JobWorkerCount"].as<uint32_t>();
+
+        // Posted Event Capacity
+        if (config["PostedEventCapacity"].IsDefined())
+            s_Settings.PostedEventCapacity = config["PostedEventCapacity"].as<uint32_t>();
     }
 
     void FrameworkConfig::SaveToFile()
@@ -102,6 +128,10 @@ namespace pxl
         saveNode["FullscreenRefreshRate"] = s_Settings.FullscreenRefreshRate;
         saveNode["FullscreenMonitor"] = s_Settings.MonitorIndex;
         saveNode["CustomFPSCap"] = s_Settings.CustomFramerateCap;
+        saveNode["LatencyMode"] = EnumStringHelper::ToString(s_Settings.LatencyModeSetting);
+        saveNode["FramesInFlight"] = s_Settings.FramesInFlight;
+        saveNode["JobWorkerCount"] = s_Settings.JobWorkerCount;
+        saveNode["PostedEventCapacity"] = s_Settings.PostedEventCapacity;
 
         if (std::filesystem::exists(CONFIG_FILE_NAME_STRING))
             std::filesystem::remove(CONFIG_FILE_NAME_STRING);
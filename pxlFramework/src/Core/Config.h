@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Application.h"
+#include "Renderer/LatencyMode.h"
 #include "Renderer/Renderer.h"
 #include "Renderer/RendererAPIType.h"
 #include "Size.h"
@@ -22,6 +23,16 @@ namespace pxl
         RendererAPIType RendererAPI = RendererAPIType::OpenGL;
         FramerateMode FramerateCapMode = FramerateMode::Unlimited; // FPS cap will likely be implemented in window class
         uint32_t CustomFramerateCap = 60;
+
+        // Latency settings
+        LatencyMode LatencyModeSetting = LatencyMode::Default;
+        uint32_t FramesInFlight = 0; // 1-3, or 0 to use the latency mode's default
+
+        // Job system settings
+        uint32_t JobWorkerCount = 0; // 0 uses one worker per core, minus the main thread
+
+        // Event settings
+        uint32_t PostedEventCapacity = 1024; // Events other threads can post between frames before the overflow policy applies
     };
 
     class FrameworkConfig
@@ -42,6 +53,10 @@ namespace pxl
         // Do not include the 'FrameworkConfig.yaml' file name
         static void SetDirectory(const std::filesystem::path& path) { s_ConfigDirectory = path; }
 
+        // The directory used for on-disk caches (pipelines, shader binaries). Relative paths are resolved from the config directory
+        static std::filesystem::path GetCacheDirectory() { return s_ConfigDirectory / s_CacheDirectory; }
+        static void SetCacheDirectory(const std::filesystem::path& path) { s_CacheDirectory = path; }
+
     private:
         friend class Application;
         static void Init();
@@ -51,6 +66,7 @@ namespace pxl
         static inline FrameworkSettings s_Settings = {};
 
         static inline std::filesystem::path s_ConfigDirectory;
+        static inline std::filesystem::path s_CacheDirectory = "cache";
 
         // Auto-load the config file on application start
         static inline bool s_AutoLoad = true;
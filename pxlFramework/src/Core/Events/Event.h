@@ -1,6 +1,7 @@
 #pragma once
 
 #include "EventType.h"
+#include "Utils/Hash.h"
 
 namespace pxl
 {
@@ -20,9 +21,17 @@ namespace pxl
         void Handled() { m_Handled = true; }
         bool IsHandled() { return m_Handled; }
 
+        // Queued events with the same non-zero key can be merged into one, see EventManager::SetCoalescing(). Usually the event type and its source
+        virtual uint64_t GetCoalesceKey() const { return 0; }
+
+        // Merges a newer event with the same coalesce key into this one
+        virtual void Coalesce([[maybe_unused]] const Event& newer) {}
+
     protected:
         virtual std::string DataToString() const = 0;
 
+        uint64_t MakeCoalesceKey(const void* source) const { return Hash::FNV1aValue(source, Hash::FNV1aValue(m_Type)); }
+
     protected:
         bool m_Handled = false;
         EventType m_Type = EventType::Unknown;
@@ -0,0 +1,56 @@
+#pragma once
+
+namespace pxl
+{
+    /// @brief Hands out memory for queued events from large blocks which are all released at once by Reset().
+    /// The blocks are kept, so once they've grown to fit a frame's worth of events queueing an event doesn't allocate
+    class EventArena
+    {
+    public:
+        void* Allocate(size_t size, size_t alignment)
+        {
+            PXL_ASSERT_MSG(alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "Events can't be aligned to more than operator new aligns to");
+
+            while (m_BlockIndex < m_Blocks.size())
+            {
+                auto& block = m_Blocks[m_BlockIndex];
+                auto offset = (m_Offset + alignment - 1) & ~(alignment - 1);
+
+                if (offset + size <= block.Size)
+                {
+                    m_Offset = offset + size;
+                    return block.Data.get() + offset;
+                }
+
+                m_BlockIndex++;
+                m_Offset = 0;
+            }
+
+            auto blockSize = std::max(size, k_BlockSize);
+            m_Blocks.push_back({ std::make_unique<std::byte[]>(blockSize), blockSize });
+            m_Offset = size;
+
+            return m_Blocks.back().Data.get();
+        }
+
+        // Everything allocated must already be destroyed
+        void Reset()
+        {
+            m_BlockIndex = 0;
+            m_Offset = 0;
+        }
+
+    private:
+        struct Block
+        {
+            std::unique_ptr<std::byte[]> Data;
+            size_t Size = 0;
+        };
+
+        static constexpr size_t k_BlockSize = 64 * 1024;
+
+        std::vector<Block> m_Blocks;
+        size_t m_BlockIndex = 0;
+        size_t m_Offset = 0;
+    };
+}
\ No newline at end of file
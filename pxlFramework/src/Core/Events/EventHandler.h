@@ -41,6 +41,8 @@ namespace pxl
                 m_UserCallback(static_cast<EventT&>(e));
         }
 
+        virtual EventType GetEventType() const override { return EventT::GetStaticType(); }
+
     private:
         std::function<void(EventT& e)> m_UserCallback = nullptr;
     };
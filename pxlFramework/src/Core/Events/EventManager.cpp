@@ -5,6 +5,16 @@
 
 namespace pxl
 {
+    EventManager::EventManager(uint32_t postedEventCapacity)
+        : m_PostedEvents(postedEventCapacity)
+    {
+    }
+
+    EventManager::~EventManager()
+    {
+        ClearQueue();
+    }
+
     std::function<void(Event&)> EventManager::GetEventSendCallback()
     {
         return [this](Event& e)
@@ -17,23 +27,41 @@ namespace pxl
     {
         return [this](std::unique_ptr<Event> e)
         {
-            m_EventQueue.push_back(std::move(e));
+            if (m_PostedEvents.Post(m_PostOverflowPolicy.load(std::memory_order_relaxed), std::move(e)))
+                m_PostedCount.fetch_add(1, std::memory_order_relaxed);
         };
     }
 
     void EventManager::RegisterHandler(const std::shared_ptr<IEventHandler>& handler)
     {
-        m_Handlers.emplace_back(handler);
+        auto type = handler->GetEventType();
+
+        if (type == EventType::Unknown)
+            m_AllEventHandlers.Handlers.emplace_back(handler);
+        else
+            m_Handlers[type].Handlers.emplace_back(handler);
     }
 
     void EventManager::ProcessQueue()
     {
         PXL_PROFILE_SCOPE;
 
-        for (auto& event : m_EventQueue)
-            HandleEvent(*event);
+        // Events posted from other threads were posted before this frame's input was queued
+        ProcessPostedEvents();
 
-        m_EventQueue.clear();
+        // Events queued by handlers can't be merged into events that may have already been dispatched
+        m_CoalesceTargets.clear();
+        m_ProcessingQueue = true;
+
+        // Handlers may queue more events while the queue is being processed, so don't hold onto references into it
+        for (size_t i = 0; i < m_EventQueue.size(); i++)
+            HandleEvent(*m_EventQueue[i]);
+
+        m_ProcessingQueue = false;
+        ClearQueue();
+
+        if (m_HasExpiredHandlers)
+            RemoveExpiredHandlers();
     }
 
     void EventManager::HandleEvent(Event& e)
@@ -49,20 +77,143 @@ namespace pxl
         // TODO: Handle events for UI layers
 
         // Handle events for event handlers
-        for (int i = 0; i < m_Handlers.size(); i++)
+        auto it = m_Handlers.find(e.GetType());
+
+        if (it != m_Handlers.end() && DispatchToHandlers(it->second, e))
+            return;
+
+        DispatchToHandlers(m_AllEventHandlers, e);
+    }
+
+    bool EventManager::DispatchToHandlers(HandlerList& list, Event& e)
+    {
+        // Handlers may register other handlers, which only receive the next event. Expired handlers are left in place
+        // until the queue has been processed, so nothing is erased from under an event that's still being handled
+        auto count = list.Handlers.size();
+
+        for (size_t i = 0; i < count; i++)
         {
-            auto& handler = m_Handlers.at(i);
+            auto handler = list.Handlers[i].lock();
 
-            if (handler.expired())
+            if (!handler)
             {
-                m_Handlers.erase(m_Handlers.begin() + i);
+                list.HasExpired = true;
+                m_HasExpiredHandlers = true;
                 continue;
             }
 
-            handler.lock()->OnEvent(e);
+            handler->OnEvent(e);
 
             if (e.IsHandled())
+                return true;
+        }
+
+        return false;
+    }
+
+    void EventManager::RemoveExpiredHandlers()
+    {
+        PXL_PROFILE_SCOPE;
+
+        auto removeExpired = [](HandlerList& list)
+        {
+            if (!list.HasExpired)
                 return;
+
+            std::erase_if(list.Handlers, [](const std::weak_ptr<IEventHandler>& handler) { return handler.expired(); });
+            list.HasExpired = false;
+        };
+
+        for (auto& [type, list] : m_Handlers)
+            removeExpired(list);
+
+        removeExpired(m_AllEventHandlers);
+
+        m_HasExpiredHandlers = false;
+    }
+
+    void EventManager::SetCoalescing(EventType type, bool enabled)
+    {
+        if (enabled)
+            m_CoalescedTypes.insert(type);
+        else
+            m_CoalescedTypes.erase(type);
+    }
+
+    bool EventManager::TryCoalesce(const Event& e)
+    {
+        if (m_ProcessingQueue)
+            return false;
+
+        uint64_t key = IsCoalescing(e.GetType()) ? e.GetCoalesceKey() : 0;
+
+        // Anything that isn't coalesced has to stay in order with the events around it
+        if (key == 0)
+        {
+            m_CoalesceTargets.clear();
+            return false;
         }
+
+        for (const auto& [targetKey, index] : m_CoalesceTargets)
+        {
+            if (targetKey != key)
+                continue;
+
+            m_EventQueue[index]->Coalesce(e);
+            m_CoalescedCount++;
+            return true;
+        }
+
+        // The event is about to be queued at the end
+        m_CoalesceTargets.emplace_back(key, m_EventQueue.size());
+        return false;
+    }
+
+    PostedEventStats EventManager::GetPostedEventStats() const
+    {
+        auto stats = m_PostedStats;
+        stats.Posted = m_PostedCount.load(std::memory_order_relaxed);
+        stats.Dropped = m_PostedEvents.GetDroppedCount();
+
+        return stats;
+    }
+
+    void EventManager::ProcessPostedEvents()
+    {
+        PXL_PROFILE_SCOPE;
+
+        auto now = std::chrono::steady_clock::now();
+        float maxLatency = 0.0f;
+
+        auto count = m_PostedEvents.Drain([&](Event& e, std::chrono::steady_clock::time_point postTime)
+        {
+            // Measured up to the start of the drain, so time spent in other handlers isn't counted
+            auto latency = std::chrono::duration<float, std::milli>(now - postTime).count();
+            latency = std::max(latency, 0.0f);
+            maxLatency = std::max(maxLatency, latency);
+
+            // Same smoothing as the renderer's input latency
+            m_PostedStats.AverageLatency = m_PostedStats.Dispatched == 0 ? latency : m_PostedStats.AverageLatency + (latency - m_PostedStats.AverageLatency) * 0.1f;
+            m_PostedStats.Dispatched++;
+
+            HandleEvent(e);
+        });
+
+        if (count == 0)
+            return;
+
+        m_PostedStats.LastFrameMaxLatency = maxLatency;
+        m_PostedStats.MaxLatency = std::max(m_PostedStats.MaxLatency, maxLatency);
+    }
+
+    void EventManager::ClearQueue()
+    {
+        for (auto event : m_EventQueue)
+            event->~Event();
+
+        // Keeps its capacity, like the storage
+        m_EventQueue.clear();
+        m_CoalesceTargets.clear();
+        m_EventStorage.Reset();
     }
 }
\ No newline at end of file
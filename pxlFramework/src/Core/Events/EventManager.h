@@ -1,16 +1,79 @@
 #pragma once
 
+#include <unordered_set>
+
 #include "Event.h"
+#include "EventArena.h"
 #include "IEventHandler.h"
+#include "PostedEventQueue.h"
 
 namespace pxl
 {
+    struct PostedEventStats
+    {
+        uint64_t Posted = 0;
+        uint64_t Dropped = 0; // The queue was full and the overflow policy was Drop
+        uint64_t Dispatched = 0;
+
+        // Time from an event being posted to being dispatched on the main thread, in ms
+        float LastFrameMaxLatency = 0.0f; // The longest in the last frame that had posted events
+        float AverageLatency = 0.0f;      // Rolling mean
+        float MaxLatency = 0.0f;
+    };
+
     class EventManager
     {
     public:
+        // The posted event capacity is how many events other threads can post between frames
+        EventManager(uint32_t postedEventCapacity = 1024);
+        ~EventManager();
+
         std::function<void(Event&)> GetEventSendCallback();
+
+        // The callback is thread-safe, it posts the event
         std::function<void(std::unique_ptr<Event> e)> GetEventQueueCallback();
 
+        // Constructs the event straight into the queue's storage, which is reused every frame so queueing doesn't allocate.
+        // If its type is coalesced, it's merged into the queued event from the same source instead.
+        // NOTE: Main thread only, use PostEvent() from other threads
+        template<typename EventT, typename... Args>
+        void QueueEvent(Args&&... args)
+        {
+            EventT event(std::forward<Args>(args)...);
+
+            if (TryCoalesce(event))
+                return;
+
+            void* memory = m_EventStorage.Allocate(sizeof(EventT), alignof(EventT));
+            m_EventQueue.push_back(new (memory) EventT(std::move(event)));
+        }
+
+        /// @brief Sets whether queued events of this type are merged per source within a frame. Only consecutive events are merged,
+        /// an event of any type that isn't coalesced (eg. a mouse button press) keeps the events on either side of it apart.
+        /// Mouse moves, gamepad axis changes and window resizes are coalesced by default
+        void SetCoalescing(EventType type, bool enabled);
+        bool IsCoalescing(EventType type) const { return m_CoalescedTypes.contains(type); }
+
+        // Events merged into one already queued, since the application started
+        uint64_t GetCoalescedEventCount() const { return m_CoalescedCount; }
+
+        // Queues an event from any thread without locking. It's dispatched on the main thread the next time the queue is processed.
+        // Returns false if the queue was full and the event was dropped
+        template<typename EventT, typename... Args>
+        bool PostEvent(Args&&... args)
+        {
+            if (!m_PostedEvents.Post<EventT>(m_PostOverflowPolicy.load(std::memory_order_relaxed), std::forward<Args>(args)...))
+                return false;
+
+            m_PostedCount.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        void SetPostOverflowPolicy(EventOverflowPolicy policy) { m_PostOverflowPolicy.store(policy, std::memory_order_relaxed); }
+
+        // Only safe to read on the main thread
+        PostedEventStats GetPostedEventStats() const;
+
         void RegisterHandler(const std::shared_ptr<IEventHandler>& handler);
 
     private:
@@ -20,8 +83,41 @@ namespace pxl
         void HandleEvent(Event& e);
 
     private:
-        std::vector<std::unique_ptr<Event>> m_EventQueue;
+        struct HandlerList
+        {
+            std::vector<std::weak_ptr<IEventHandler>> Handlers;
+            bool HasExpired = false;
+        };
+
+        // Returns true if a handler handled the event
+        bool DispatchToHandlers(HandlerList& list, Event& e);
+
+        // Removes the expired handlers found while dispatching, once per frame rather than one at a time
+        void RemoveExpiredHandlers();
+
+        // Returns true if the event was merged into one already queued
+        bool TryCoalesce(const Event& e);
+
+        void ProcessPostedEvents();
+        void ClearQueue();
+
+    private:
+        std::vector<Event*> m_EventQueue; // Constructed in m_EventStorage
+        EventArena m_EventStorage;
+        bool m_ProcessingQueue = false;
+
+        std::unordered_set<EventType> m_CoalescedTypes = { EventType::MouseMove, EventType::GamepadAxisChange, EventType::WindowResize };
+        std::vector<std::pair<uint64_t, size_t>> m_CoalesceTargets; // Coalesce key, index in the queue. Only a handful are queued at once
+        uint64_t m_CoalescedCount = 0;
+
+        PostedEventQueue m_PostedEvents;
+        std::atomic<EventOverflowPolicy> m_PostOverflowPolicy = EventOverflowPolicy::Drop;
+        std::atomic<uint64_t> m_PostedCount = 0;
+        PostedEventStats m_PostedStats = {};
 
-        std::vector<std::weak_ptr<IEventHandler>> m_Handlers;
+        // Handlers are kept per event type, so an event only goes to the handlers that want it
+        std::unordered_map<EventType, HandlerList> m_Handlers;
+        HandlerList m_AllEventHandlers; // Handlers that don't have a type receive every event
+        bool m_HasExpiredHandlers = false;
     };
 }
\ No newline at end of file
@@ -35,6 +35,11 @@ namespace pxl
 
         static EventType GetStaticType() { return EventType::GamepadAxisChange; }
 
+        // Each axis of each gamepad is coalesced separately
+        virtual uint64_t GetCoalesceKey() const override { return Hash::FNV1aValue(m_Axis, Hash::FNV1aValue(m_JID, Hash::FNV1aValue(m_Type))); }
+
+        virtual void Coalesce(const Event& newer) override { m_Value = static_cast<const GamepadAxisChangeEvent&>(newer).m_Value; }
+
     protected:
         virtual std::string DataToString() const override { return std::format("Controller = {}, Axis = {}, Value = {}", m_JID, Utils::ToString(m_Axis), m_Value); }
 
@@ -8,5 +8,8 @@ namespace pxl
     {
     public:
         virtual void OnEvent(Event& e) = 0;
+
+        // The type of event this handler receives, so the event manager only passes it events of that type. Unknown receives every event
+        virtual EventType GetEventType() const { return EventType::Unknown; }
     };
 }
\ No newline at end of file
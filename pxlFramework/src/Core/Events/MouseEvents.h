@@ -14,20 +14,33 @@ namespace pxl
     class MouseMoveEvent : public InputEvent
     {
     public:
-        MouseMoveEvent(const glm::dvec2& position, const std::shared_ptr<InputSystem>& system)
-            : InputEvent(EventType::MouseMove, system), m_Position(position)
+        MouseMoveEvent(const glm::dvec2& position, const std::shared_ptr<InputSystem>& system, const glm::dvec2& delta = glm::dvec2(0.0))
+            : InputEvent(EventType::MouseMove, system), m_Position(position), m_Delta(delta)
         {
         }
 
         glm::dvec2 GetPosition() const { return m_Position; }
 
+        // How far the cursor moved since the last move event. Coalesced moves add up, so no movement is lost
+        glm::dvec2 GetDelta() const { return m_Delta; }
+
         static EventType GetStaticType() { return EventType::MouseMove; }
 
+        virtual uint64_t GetCoalesceKey() const override { return MakeCoalesceKey(m_InputSystem.lock().get()); }
+
+        virtual void Coalesce(const Event& newer) override
+        {
+            auto& move = static_cast<const MouseMoveEvent&>(newer);
+            m_Position = move.m_Position;
+            m_Delta += move.m_Delta;
+        }
+
     protected:
-        virtual std::string DataToString() const override { return std::format("Position = {}, {}", m_Position.x, m_Position.y); }
+        virtual std::string DataToString() const override { return std::format("Position = {}, {}, Delta = {}, {}", m_Position.x, m_Position.y, m_Delta.x, m_Delta.y); }
 
     private:
         glm::dvec2 m_Position;
+        glm::dvec2 m_Delta;
     };
 
     // ------------------------
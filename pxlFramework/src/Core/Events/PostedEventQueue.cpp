@@ -0,0 +1,119 @@
+#include "PostedEventQueue.h"
+
+namespace pxl
+{
+    PostedEventQueue::PostedEventQueue(uint32_t capacity)
+        : m_Capacity(std::bit_ceil(std::max(capacity, 2u))), m_Mask(m_Capacity - 1)
+    {
+        m_Slots = std::make_unique<Slot[]>(m_Capacity);
+
+        for (uint32_t i = 0; i < m_Capacity; i++)
+            m_Slots[i].Sequence.store(i, std::memory_order_relaxed);
+    }
+
+    PostedEventQueue::~PostedEventQueue()
+    {
+        // Destroy anything that was never drained
+        Drain([](Event&, std::chrono::steady_clock::time_point) {});
+    }
+
+    bool PostedEventQueue::Post(EventOverflowPolicy policy, std::unique_ptr<Event> e)
+    {
+        auto slot = Claim(policy);
+
+        if (!slot)
+            return false;
+
+        slot->Data = e.release();
+        slot->InStorage = false;
+
+        Publish(*slot);
+        return true;
+    }
+
+    uint32_t PostedEventQueue::Drain(const std::function<void(Event& e, std::chrono::steady_clock::time_point postTime)>& func)
+    {
+        PXL_PROFILE_SCOPE;
+
+        auto end = m_EnqueuePosition.load(std::memory_order_relaxed);
+        uint32_t count = 0;
+
+        while (m_DequeuePosition < end)
+        {
+            auto& slot = m_Slots[m_DequeuePosition & m_Mask];
+
+            // Claimed but not published yet. Events are drained in the order they were claimed, so the rest wait for the next drain
+            if (slot.Sequence.load(std::memory_order_acquire) != m_DequeuePosition + 1)
+                break;
+
+            func(*slot.Data, slot.PostTime);
+
+            if (slot.InStorage)
+                slot.Data->~Event();
+            else
+                delete slot.Data;
+
+            slot.Data = nullptr;
+
+            // Free to be claimed again once the producers have gone all the way around
+            slot.Sequence.store(m_DequeuePosition + m_Capacity, std::memory_order_release);
+            m_DequeuePosition++;
+            count++;
+        }
+
+        return count;
+    }
+
+    uint32_t PostedEventQueue::GetSize() const
+    {
+        auto enqueuePosition = m_EnqueuePosition.load(std::memory_order_relaxed);
+        return enqueuePosition > m_DequeuePosition ? static_cast<uint32_t>(enqueuePosition - m_DequeuePosition) : 0;
+    }
+
+    PostedEventQueue::Slot* PostedEventQueue::Claim(EventOverflowPolicy policy)
+    {
+        // Waiting on the thread that drains the queue would never end
+        if (policy == EventOverflowPolicy::Block && std::this_thread::get_id() == m_ConsumerThreadID)
+            policy = EventOverflowPolicy::Drop;
+
+        auto position = m_EnqueuePosition.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            auto& slot = m_Slots[position & m_Mask];
+            auto sequence = slot.Sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<int64_t>(sequence) - static_cast<int64_t>(position);
+
+            if (difference == 0)
+            {
+                // Another producer may have claimed it first, in which case position is updated and we try the next slot
+                if (m_EnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    return &slot;
+            }
+            else if (difference < 0)
+            {
+                // The slot still holds an event from the last time around, so the queue is full
+                if (policy == EventOverflowPolicy::Drop)
+                {
+                    m_Dropped.fetch_add(1, std::memory_order_relaxed);
+                    return nullptr;
+                }
+
+                std::this_thread::yield();
+                position = m_EnqueuePosition.load(std::memory_order_relaxed);
+            }
+            else
+            {
+                position = m_EnqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void PostedEventQueue::Publish(Slot& slot)
+    {
+        slot.PostTime = std::chrono::steady_clock::now();
+
+        auto position = slot.Sequence.load(std::memory_order_relaxed);
+        slot.Sequence.store(position + 1, std::memory_order_release);
+    }
+}
\ No newline at end of file
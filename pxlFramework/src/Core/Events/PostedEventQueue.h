@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+
+#include "Event.h"
+
+namespace pxl
+{
+    enum class EventOverflowPolicy
+    {
+        Drop,  // The event is dropped and posting it returns false
+        Block, // The posting thread waits for the main thread to process the queue. Events posted from the main thread are dropped instead
+    };
+
+    /// @brief A bounded lock-free queue that any number of threads can post events to, drained by one thread (the main thread).
+    /// Producers claim a slot with a compare exchange and publish it through the slot's sequence number (Dmitry Vyukov's bounded queue),
+    /// so posting never takes a lock. Each slot has room to construct a small event in place, so posting only allocates for events too big to fit
+    class PostedEventQueue
+    {
+    public:
+        // The capacity is rounded up to a power of 2
+        PostedEventQueue(uint32_t capacity);
+        ~PostedEventQueue();
+
+        PostedEventQueue(const PostedEventQueue&) = delete;
+        PostedEventQueue& operator=(const PostedEventQueue&) = delete;
+
+        template<typename EventT, typename... Args>
+        bool Post(EventOverflowPolicy policy, Args&&... args)
+        {
+            auto slot = Claim(policy);
+
+            if (!slot)
+                return false;
+
+            if constexpr (sizeof(EventT) <= k_InlineEventSize && alignof(EventT) <= alignof(std::max_align_t))
+            {
+                slot->Data = new (slot->Storage) EventT(std::forward<Args>(args)...);
+                slot->InStorage = true;
+            }
+            else
+            {
+                slot->Data = new EventT(std::forward<Args>(args)...);
+                slot->InStorage = false;
+            }
+
+            Publish(*slot);
+            return true;
+        }
+
+        bool Post(EventOverflowPolicy policy, std::unique_ptr<Event> e);
+
+        /// @brief Passes each event that was posted before draining started to func, then destroys it. Only the consuming thread may call this.
+        /// Events posted while draining are left for the next drain, so a handler that posts events can't keep the drain going forever
+        /// @return The number of events drained
+        uint32_t Drain(const std::function<void(Event& e, std::chrono::steady_clock::time_point postTime)>& func);
+
+        uint64_t GetDroppedCount() const { return m_Dropped.load(std::memory_order_relaxed); }
+        uint32_t GetCapacity() const { return m_Capacity; }
+
+        // Only a rough count, since producers may be posting at the same time
+        uint32_t GetSize() const;
+
+    private:
+        static constexpr size_t k_InlineEventSize = 64;
+
+        struct Slot
+        {
+            // Equal to the slot's position when it's free to be claimed, and one past it once an event has been published to it
+            std::atomic<uint64_t> Sequence = 0;
+
+            Event* Data = nullptr;
+            bool InStorage = false; // Otherwise Data was allocated with new
+            std::chrono::steady_clock::time_point PostTime;
+
+            alignas(std::max_align_t) std::byte Storage[k_InlineEventSize];
+        };
+
+        // Returns nullptr if the queue is full and the event should be dropped
+        Slot* Claim(EventOverflowPolicy policy);
+        void Publish(Slot& slot);
+
+    private:
+        uint32_t m_Capacity = 0;
+        uint64_t m_Mask = 0;
+        std::unique_ptr<Slot[]> m_Slots;
+
+        // Kept on separate cache lines so producers and the consumer don't slow each other down
+        alignas(64) std::atomic<uint64_t> m_EnqueuePosition = 0;
+        alignas(64) uint64_t m_DequeuePosition = 0; // Only touched by the consumer
+
+        std::atomic<uint64_t> m_Dropped = 0;
+
+        // Blocking is only safe on threads that aren't the one draining the queue
+        std::thread::id m_ConsumerThreadID = std::this_thread::get_id();
+    };
+}
\ No newline at end of file
@@ -33,6 +33,10 @@ namespace pxl
 
         static EventType GetStaticType() { return EventType::WindowResize; }
 
+        virtual uint64_t GetCoalesceKey() const override { return MakeCoalesceKey(GetWindow().get()); }
+
+        virtual void Coalesce(const Event& newer) override { m_Size = static_cast<const WindowResizeEvent&>(newer).m_Size; }
+
     protected:
         virtual std::string DataToString() const override { return std::format("Size = {}, {}", m_Size.Width, m_Size.Height); }
 
@@ -0,0 +1,157 @@
+#include "FramePacer.h"
+
+#ifdef __linux__
+    #include <cerrno>
+    #include <time.h>
+#endif
+
+#if defined(_WIN32) && !defined(CREATE_WAITABLE_TIMER_HIGH_RESOLUTION)
+    #define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+using namespace std::literals;
+
+namespace pxl
+{
+    // How much each new oversleep measurement moves the calibration
+    static constexpr double k_CalibrationWeight = 0.1;
+
+    // Bounds for the spin margin, so one bad measurement can't make the pacer spin for a whole frame or stop spinning
+    static constexpr auto k_MinSpinMargin = 100us;
+    static constexpr auto k_MaxSpinMargin = 4ms;
+
+    FramePacer::FramePacer()
+    {
+#ifdef _WIN32
+        // High resolution timers (Windows 10 1803+) wake within ~0.5ms instead of the scheduler's default 1-15ms
+        m_WaitableTimer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+
+        if (!m_WaitableTimer)
+            m_WaitableTimer = CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
+#endif
+    }
+
+    FramePacer::~FramePacer()
+    {
+#ifdef _WIN32
+        if (m_WaitableTimer)
+            CloseHandle(m_WaitableTimer);
+#endif
+    }
+
+    void FramePacer::SetTargetFrameRate(uint32_t fps)
+    {
+        if (fps == m_TargetFrameRate)
+            return;
+
+        m_TargetFrameRate = fps;
+        m_Interval = fps > 0 ? std::chrono::nanoseconds(1s) / fps : 0ns;
+        m_Deadline = std::chrono::steady_clock::now() + m_Interval;
+
+        m_Stats.TargetFrameTime = std::chrono::duration<float, std::milli>(m_Interval).count();
+    }
+
+    void FramePacer::Wait()
+    {
+        PXL_PROFILE_SCOPE;
+
+        if (m_Interval == 0ns)
+            return;
+
+        auto now = std::chrono::steady_clock::now();
+
+        m_Stats.SleepTime = 0.0f;
+        m_Stats.SpinTime = 0.0f;
+
+        if (now >= m_Deadline)
+        {
+            // The frame took longer than its budget, so start counting from now rather than rushing the next frames to catch up
+            m_Stats.PacingError = std::chrono::duration<float, std::milli>(now - m_Deadline).count();
+            m_Stats.MissedDeadlines++;
+            m_Deadline = now + m_Interval;
+        }
+        else
+        {
+            auto spinMargin = std::chrono::nanoseconds(static_cast<int64_t>(m_OversleepMean + 2.0 * std::sqrt(m_OversleepVariance)));
+            spinMargin = std::clamp<std::chrono::nanoseconds>(spinMargin, k_MinSpinMargin, k_MaxSpinMargin);
+
+            m_Stats.SpinMargin = std::chrono::duration<float, std::milli>(spinMargin).count();
+
+            // Sleep through most of the remaining time
+            auto sleepTime = (m_Deadline - now) - spinMargin;
+            if (sleepTime > 0ns)
+            {
+                PXL_PROFILE_SCOPE_NAMED("Frame Pacer Sleep");
+
+                auto sleepStart = std::chrono::steady_clock::now();
+                SleepFor(sleepTime);
+                auto slept = std::chrono::steady_clock::now() - sleepStart;
+
+                UpdateCalibration(slept - sleepTime);
+
+                m_Stats.SleepTime = std::chrono::duration<float, std::milli>(slept).count();
+                m_Stats.TotalSleepTime += std::chrono::duration<double>(slept).count();
+            }
+
+            // Spin for the rest, which is only as long as the OS is likely to oversleep by
+            {
+                PXL_PROFILE_SCOPE_NAMED("Frame Pacer Spin");
+
+                auto spinStart = std::chrono::steady_clock::now();
+                while (std::chrono::steady_clock::now() < m_Deadline)
+                    std::this_thread::yield();
+
+                m_Stats.SpinTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - spinStart).count();
+            }
+
+            now = std::chrono::steady_clock::now();
+            m_Stats.PacingError = std::chrono::duration<float, std::milli>(now - m_Deadline).count();
+
+            // Schedule from the deadline rather than from now so small errors don't accumulate into drift
+            m_Deadline += m_Interval;
+        }
+
+        m_Stats.AveragePacingError += (std::abs(m_Stats.PacingError) - m_Stats.AveragePacingError) * static_cast<float>(k_CalibrationWeight);
+    }
+
+    void FramePacer::SleepFor(std::chrono::nanoseconds duration)
+    {
+#if defined(_WIN32)
+        if (m_WaitableTimer)
+        {
+            // Negative values are relative, in 100 nanosecond intervals
+            LARGE_INTEGER dueTime;
+            dueTime.QuadPart = -static_cast<LONGLONG>(duration.count() / 100);
+
+            if (SetWaitableTimer(m_WaitableTimer, &dueTime, 0, nullptr, nullptr, FALSE))
+            {
+                WaitForSingleObject(m_WaitableTimer, INFINITE);
+                return;
+            }
+        }
+
+        std::this_thread::sleep_for(duration);
+#elif defined(__linux__)
+        timespec request = {};
+        request.tv_sec = static_cast<time_t>(duration.count() / 1'000'000'000);
+        request.tv_nsec = static_cast<long>(duration.count() % 1'000'000'000);
+
+        // Resume the remaining time if a signal interrupts the sleep
+        while (clock_nanosleep(CLOCK_MONOTONIC, 0, &request, &request) == EINTR)
+        {
+        }
+#else
+        std::this_thread::sleep_for(duration);
+#endif
+    }
+
+    void FramePacer::UpdateCalibration(std::chrono::nanoseconds oversleep)
+    {
+        // Exponentially weighted mean and variance, so the margin follows changes in system load
+        double sample = static_cast<double>(oversleep.count());
+        double difference = sample - m_OversleepMean;
+
+        m_OversleepMean += k_CalibrationWeight * difference;
+        m_OversleepVariance = (1.0 - k_CalibrationWeight) * (m_OversleepVariance + k_CalibrationWeight * difference * difference);
+    }
+}
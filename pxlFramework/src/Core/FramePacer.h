@@ -0,0 +1,56 @@
+#pragma once
+
+namespace pxl
+{
+    struct FramePacerStats
+    {
+        float TargetFrameTime = 0.0f;    // ms
+        float PacingError = 0.0f;        // ms the last frame ended after its deadline, negative if it ended early
+        float AveragePacingError = 0.0f; // ms, rolling average of the absolute pacing error
+        float SleepTime = 0.0f;          // ms the last wait spent asleep
+        float SpinTime = 0.0f;           // ms the last wait spent spinning
+        float SpinMargin = 0.0f;         // ms, the calibrated oversleep the pacer spins through instead of sleeping
+        double TotalSleepTime = 0.0;     // seconds spent asleep rather than busy waiting, i.e. CPU time saved
+        uint64_t MissedDeadlines = 0;
+    };
+
+    /** @brief Limits the frame rate by waiting until each frame's deadline.
+        It sleeps for most of the wait and only spins for the last part. The spin margin is calibrated from how much
+        the OS has overslept previous sleeps, so the CPU stays mostly idle without losing pacing precision.
+    */
+    class FramePacer
+    {
+    public:
+        FramePacer();
+        ~FramePacer();
+
+        FramePacer(const FramePacer& other) = delete;
+        FramePacer& operator=(const FramePacer& other) = delete;
+
+        // 0 disables pacing
+        void SetTargetFrameRate(uint32_t fps);
+        uint32_t GetTargetFrameRate() const { return m_TargetFrameRate; }
+
+        // Blocks until the current frame's deadline, then schedules the next one
+        void Wait();
+
+        const FramePacerStats& GetStats() const { return m_Stats; }
+
+    private:
+        void SleepFor(std::chrono::nanoseconds duration);
+        void UpdateCalibration(std::chrono::nanoseconds oversleep);
+
+    private:
+        uint32_t m_TargetFrameRate = 0;
+        std::chrono::nanoseconds m_Interval = std::chrono::nanoseconds::zero();
+        std::chrono::steady_clock::time_point m_Deadline;
+
+        // Rolling mean and variance of the oversleep in nanoseconds
+        double m_OversleepMean = 1'000'000.0;
+        double m_OversleepVariance = 0.0;
+
+        void* m_WaitableTimer = nullptr; // Windows only
+
+        FramePacerStats m_Stats = {};
+    };
+}
@@ -2,12 +2,13 @@
 
 #include <GLFW/glfw3.h>
 
+#include "Events/EventManager.h"
 #include "Events/GamepadEvents.h"
 
 namespace pxl
 {
-    Gamepad::Gamepad(uint32_t jid, const std::function<void(std::unique_ptr<pxl::Event>)>& eventCallback)
-        : m_JID(jid), m_EventCallback(eventCallback)
+    Gamepad::Gamepad(uint32_t jid, EventManager& eventManager)
+        : m_JID(jid), m_EventManager(&eventManager)
     {
         UpdateState();
     }
@@ -56,8 +57,7 @@ namespace pxl
             if (axisValue == m_PreviousState.axes[i])
                 continue;
 
-            auto axisChangeEvent = std::make_unique<GamepadAxisChangeEvent>(m_JID, static_cast<GamepadAxis>(i), axisValue);
-            m_EventCallback(std::move(axisChangeEvent));
+            m_EventManager->QueueEvent<GamepadAxisChangeEvent>(m_JID, static_cast<GamepadAxis>(i), axisValue);
         }
 
         // Propogate button events
@@ -72,14 +72,12 @@ namespace pxl
             {
                 case GLFW_PRESS:
                 {
-                    auto downEvent = std::make_unique<GamepadButtonDownEvent>(m_JID, static_cast<GamepadButton>(i));
-                    m_EventCallback(std::move(downEvent));
+                    m_EventManager->QueueEvent<GamepadButtonDownEvent>(m_JID, static_cast<GamepadButton>(i));
                     break;
                 }
                 case GLFW_RELEASE:
                 {
-                    auto upEvent = std::make_unique<GamepadButtonUpEvent>(m_JID, static_cast<GamepadButton>(i));
-                    m_EventCallback(std::move(upEvent));
+                    m_EventManager->QueueEvent<GamepadButtonUpEvent>(m_JID, static_cast<GamepadButton>(i));
                     break;
                 }
             }
@@ -7,10 +7,12 @@
 
 namespace pxl
 {
+    class EventManager;
+
     class Gamepad
     {
     public:
-        Gamepad(uint32_t jid, const std::function<void(std::unique_ptr<pxl::Event>)>& eventCallback);
+        Gamepad(uint32_t jid, EventManager& eventManager);
 
         bool IsButtonHeld(GamepadButton button);
 
@@ -22,7 +24,7 @@ namespace pxl
 
     private:
         int32_t m_JID = 0;
-        std::function<void(std::unique_ptr<pxl::Event>)> m_EventCallback;
+        EventManager* m_EventManager = nullptr;
 
         GLFWgamepadstate m_State;
         GLFWgamepadstate m_PreviousState;
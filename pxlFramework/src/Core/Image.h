@@ -25,6 +25,7 @@ namespace pxl
         JPG,
         PNG,
         BMP,
+        QOI,
     };
 
     struct ImageMetadata
@@ -1,24 +1,31 @@
 #include "InputSystem.h"
 
+#include "Events/EventManager.h"
 #include "Events/KeyboardEvents.h"
 #include "Events/MouseEvents.h"
 #include "Window.h"
 
 namespace pxl
 {
-    InputSystem::InputSystem(GLFWwindow* window, const std::function<void(std::unique_ptr<Event>)>& eventCallback)
-        : m_Window(window), m_EventCallback(eventCallback)
+    InputSystem::InputSystem(GLFWwindow* window, EventManager& eventManager)
+        : m_Window(window), m_EventManager(&eventManager)
     {
+        // So the first move event's delta is from where the cursor actually started
+        glfwGetCursorPos(m_Window, &m_CurrentInputState.CursorPosition.x, &m_CurrentInputState.CursorPosition.y);
+
         glfwSetCursorPosCallback(m_Window, [](GLFWwindow* window, double xpos, double ypos)
         {
             PXL_PROFILE_SCOPE_NAMED("GLFW Cursor Callback");
 
             auto& input = static_cast<Window*>(glfwGetWindowUserPointer(window))->GetInputSystem();
 
-            input->m_CurrentInputState.CursorPosition = { xpos, ypos };
+            glm::dvec2 position = { xpos, ypos };
+            auto delta = position - input->m_CurrentInputState.CursorPosition;
+
+            input->m_CurrentInputState.CursorPosition = position;
 
-            auto event = std::make_unique<MouseMoveEvent>(glm::dvec2(xpos, ypos), input);
-            input->m_EventCallback(std::move(event));
+            // High polling rate mice call this many times a frame, the event manager coalesces the moves into one
+            input->m_EventManager->QueueEvent<MouseMoveEvent>(position, input, delta);
         });
 
         glfwSetMouseButtonCallback(window, [](GLFWwindow* window, int button, int action, int mods)
@@ -33,14 +40,12 @@ namespace pxl
             {
                 case GLFW_PRESS:
                 {
-                    auto downEvent = std::make_unique<MouseButtonDownEvent>(static_cast<MouseCode>(button), input);
-                    input->m_EventCallback(std::move(downEvent));
+                    input->m_EventManager->QueueEvent<MouseButtonDownEvent>(static_cast<MouseCode>(button), input);
                     break;
                 }
                 case GLFW_RELEASE:
                 {
-                    auto upEvent = std::make_unique<MouseButtonUpEvent>(static_cast<MouseCode>(button), input);
-                    input->m_EventCallback(std::move(upEvent));
+                    input->m_EventManager->QueueEvent<MouseButtonUpEvent>(static_cast<MouseCode>(button), input);
                     break;
                 }
             }
@@ -55,8 +60,7 @@ namespace pxl
             input->m_CurrentInputState.HorizontalScrollOffset = xoffset;
             input->m_CurrentInputState.VerticalScrollOffset = yoffset;
 
-            auto event = std::make_unique<MouseScrollEvent>(yoffset, xoffset, input);
-            input->m_EventCallback(std::move(event));
+            input->m_EventManager->QueueEvent<MouseScrollEvent>(yoffset, xoffset, input);
         });
 
         glfwSetKeyCallback(window, [](GLFWwindow* window, int key, int scancode, int action, int mods)
@@ -78,14 +82,12 @@ namespace pxl
             {
                 case GLFW_PRESS:
                 {
-                    auto downEvent = std::make_unique<KeyDownEvent>(input, static_cast<KeyCode>(key), mods);
-                    input->m_EventCallback(std::move(downEvent));
+                    input->m_EventManager->QueueEvent<KeyDownEvent>(input, static_cast<KeyCode>(key), mods);
                     break;
                 }
                 case GLFW_RELEASE:
                 {
-                    auto upEvent = std::make_unique<KeyUpEvent>(input, static_cast<KeyCode>(key), mods);
-                    input->m_EventCallback(std::move(upEvent));
+                    input->m_EventManager->QueueEvent<KeyUpEvent>(input, static_cast<KeyCode>(key), mods);
                     break;
                 }
                 case GLFW_REPEAT:
@@ -19,10 +19,12 @@ namespace pxl
         glm::dvec2 CursorPosition = glm::dvec2(0.0f);
     };
 
+    class EventManager;
+
     class InputSystem
     {
     public:
-        InputSystem(GLFWwindow* window, const std::function<void(std::unique_ptr<Event>)>& eventCallback);
+        InputSystem(GLFWwindow* window, EventManager& eventManager);
 
         void ResetCurrentState();
 
@@ -35,6 +37,6 @@ namespace pxl
         InputState m_CurrentInputState;
         InputState m_PreviousInputState;
 
-        std::function<void(std::unique_ptr<Event>)> m_EventCallback = nullptr;
+        EventManager* m_EventManager = nullptr;
     };
 }
\ No newline at end of file
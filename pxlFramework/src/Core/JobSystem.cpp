@@ -0,0 +1,325 @@
+#include "JobSystem.h"
+
+#include <condition_variable>
+#include <deque>
+
+namespace pxl
+{
+    struct JobQueue
+    {
+        std::mutex Mutex;
+        std::deque<JobSystem::Job> Jobs;
+    };
+
+    // Queue 0 belongs to the main thread, the rest belong to the workers in order
+    static std::vector<std::unique_ptr<JobQueue>> s_Queues;
+    static JobQueue s_MainThreadQueue;
+
+    // The queue of the current thread, or -1 for threads the job system doesn't own
+    static thread_local int32_t s_ThreadQueueIndex = -1;
+
+    // Spreads jobs scheduled from outside threads across the queues
+    static std::atomic<uint32_t> s_NextQueueIndex = 0;
+
+    // Idle workers sleep until a job is queued
+    static std::mutex s_SleepMutex;
+    static std::condition_variable s_SleepCondition;
+    static std::atomic<uint32_t> s_PendingJobCount = 0;
+    static std::atomic<bool> s_Running = false;
+
+    void JobSystem::Init(uint32_t workerCount)
+    {
+        PXL_PROFILE_SCOPE;
+
+        if (s_Enabled)
+            return;
+
+        if (workerCount == 0)
+            workerCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+
+        s_MainThreadID = std::this_thread::get_id();
+
+        s_Queues.clear();
+        for (uint32_t i = 0; i < workerCount + 1; i++)
+            s_Queues.push_back(std::make_unique<JobQueue>());
+
+        s_ThreadQueueIndex = 0;
+        s_Running = true;
+
+        for (uint32_t i = 1; i <= workerCount; i++)
+            s_Workers.emplace_back(&JobSystem::WorkerLoop, i);
+
+        s_Enabled = true;
+
+        PXL_LOG_INFO(LogArea::Core, "Job system initialized with {} worker threads", workerCount);
+    }
+
+    void JobSystem::Shutdown()
+    {
+        PXL_PROFILE_SCOPE;
+
+        if (!s_Enabled)
+            return;
+
+        // Finish everything that's already queued so nothing waiting on a counter is left hanging
+        while (TryRunJob())
+        {
+        }
+
+        {
+            std::lock_guard lock(s_SleepMutex);
+            s_Running = false;
+        }
+
+        s_SleepCondition.notify_all();
+
+        for (auto& worker : s_Workers)
+            worker.join();
+
+        s_Workers.clear();
+        s_Queues.clear();
+        s_ThreadQueueIndex = -1;
+        s_Enabled = false;
+
+        PXL_LOG_INFO(LogArea::Core, "Job system shutdown");
+    }
+
+    std::shared_ptr<JobCounter> JobSystem::Schedule(const std::function<void()>& job, JobAffinity affinity)
+    {
+        auto counter = std::make_shared<JobCounter>();
+        Schedule(counter, job, affinity);
+        return counter;
+    }
+
+    std::shared_ptr<JobCounter> JobSystem::Schedule(const std::function<void()>& job, const std::vector<std::shared_ptr<JobCounter>>& dependencies, JobAffinity affinity)
+    {
+        auto counter = std::make_shared<JobCounter>();
+        counter->m_Count++;
+
+        // The extra count stops the job being released before every continuation has been attached
+        auto remaining = std::make_shared<std::atomic<uint32_t>>(static_cast<uint32_t>(dependencies.size()) + 1);
+
+        auto release = [job, counter, affinity, remaining]()
+        {
+            if (remaining->fetch_sub(1, std::memory_order_acq_rel) == 1)
+                Enqueue({ job, counter, affinity });
+        };
+
+        for (const auto& dependency : dependencies)
+        {
+            PXL_ASSERT(dependency);
+
+            std::unique_lock lock(dependency->m_Mutex);
+
+            if (dependency->IsDone())
+            {
+                lock.unlock();
+                release();
+            }
+            else
+            {
+                dependency->m_Continuations.push_back(release);
+            }
+        }
+
+        release();
+
+        return counter;
+    }
+
+    void JobSystem::Schedule(const std::shared_ptr<JobCounter>& counter, const std::function<void()>& job, JobAffinity affinity)
+    {
+        PXL_ASSERT(counter);
+
+        counter->m_Count.fetch_add(1, std::memory_order_relaxed);
+        Enqueue({ job, counter, affinity });
+    }
+
+    void JobSystem::Wait(const std::shared_ptr<JobCounter>& counter)
+    {
+        PXL_PROFILE_SCOPE;
+
+        if (!counter)
+            return;
+
+        while (!counter->IsDone())
+        {
+            if (!TryRunJob())
+                std::this_thread::yield();
+        }
+    }
+
+    void JobSystem::ParallelFor(uint32_t count, const std::function<void(uint32_t begin, uint32_t end)>& func, uint32_t grainSize)
+    {
+        PXL_PROFILE_SCOPE;
+
+        if (count == 0)
+            return;
+
+        // Aim for a few ranges per thread so a slow range doesn't leave the other threads idle
+        if (grainSize == 0)
+            grainSize = std::max(count / (GetThreadCount() * 4), 1u);
+
+        if (!s_Enabled || grainSize >= count)
+        {
+            func(0, count);
+            return;
+        }
+
+        auto counter = std::make_shared<JobCounter>();
+
+        for (uint32_t begin = 0; begin < count; begin += grainSize)
+        {
+            uint32_t end = std::min(begin + grainSize, count);
+            Schedule(counter, [&func, begin, end]() { func(begin, end); });
+        }
+
+        Wait(counter);
+    }
+
+    void JobSystem::RunMainThreadJobs()
+    {
+        PXL_PROFILE_SCOPE;
+
+        PXL_ASSERT_MSG(IsMainThread(), "Main thread jobs can only be run on the main thread");
+
+        std::deque<Job> jobs;
+
+        {
+            std::lock_guard lock(s_MainThreadQueue.Mutex);
+            jobs.swap(s_MainThreadQueue.Jobs);
+        }
+
+        for (auto& job : jobs)
+            Execute(job);
+    }
+
+    void JobSystem::Enqueue(Job&& job)
+    {
+        // Without worker threads the job just runs straight away, unless it has to wait for the main thread
+        if (!s_Enabled && (job.Affinity == JobAffinity::Any || IsMainThread()))
+        {
+            Execute(job);
+            return;
+        }
+
+        if (job.Affinity == JobAffinity::MainThread)
+        {
+            std::lock_guard lock(s_MainThreadQueue.Mutex);
+            s_MainThreadQueue.Jobs.push_back(std::move(job));
+            return;
+        }
+
+        // Jobs go onto the scheduling thread's own queue so they're likely to run on a warm cache
+        uint32_t queueIndex = s_ThreadQueueIndex >= 0 ? static_cast<uint32_t>(s_ThreadQueueIndex) : s_NextQueueIndex++ % s_Queues.size();
+
+        // Count the job before it's visible to other threads so the count never drops below zero
+        {
+            std::lock_guard lock(s_SleepMutex);
+            s_PendingJobCount++;
+        }
+
+        {
+            std::lock_guard lock(s_Queues[queueIndex]->Mutex);
+            s_Queues[queueIndex]->Jobs.push_back(std::move(job));
+        }
+
+        s_SleepCondition.notify_one();
+    }
+
+    void JobSystem::Execute(Job& job)
+    {
+        PXL_PROFILE_SCOPE;
+
+        job.Function();
+
+        if (job.Counter->m_Count.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            return;
+
+        // This was the last job on the counter, release everything that depends on it
+        std::vector<std::function<void()>> continuations;
+
+        {
+            std::lock_guard lock(job.Counter->m_Mutex);
+            continuations.swap(job.Counter->m_Continuations);
+        }
+
+        for (const auto& continuation : continuations)
+            continuation();
+    }
+
+    bool JobSystem::TryRunJob()
+    {
+        std::optional<Job> job;
+
+        if (IsMainThread())
+        {
+            std::lock_guard lock(s_MainThreadQueue.Mutex);
+
+            if (!s_MainThreadQueue.Jobs.empty())
+            {
+                job = std::move(s_MainThreadQueue.Jobs.front());
+                s_MainThreadQueue.Jobs.pop_front();
+            }
+        }
+
+        if (!job && s_Enabled)
+        {
+            uint32_t queueCount = static_cast<uint32_t>(s_Queues.size());
+            uint32_t ownIndex = s_ThreadQueueIndex >= 0 ? static_cast<uint32_t>(s_ThreadQueueIndex) : 0;
+
+            // Take the newest job from our own queue, then steal the oldest job from the others
+            for (uint32_t i = 0; i < queueCount && !job; i++)
+            {
+                auto& queue = *s_Queues[(ownIndex + i) % queueCount];
+                bool ownQueue = i == 0 && s_ThreadQueueIndex >= 0;
+
+                std::lock_guard lock(queue.Mutex);
+
+                if (queue.Jobs.empty())
+                    continue;
+
+                if (ownQueue)
+                {
+                    job = std::move(queue.Jobs.back());
+                    queue.Jobs.pop_back();
+                }
+                else
+                {
+                    job = std::move(queue.Jobs.front());
+                    queue.Jobs.pop_front();
+                }
+            }
+
+            if (job)
+                s_PendingJobCount--;
+        }
+
+        if (!job)
+            return false;
+
+        Execute(job.value());
+        return true;
+    }
+
+    void JobSystem::WorkerLoop(uint32_t queueIndex)
+    {
+        s_ThreadQueueIndex = static_cast<int32_t>(queueIndex);
+
+        PXL_PROFILE_THREAD(std::format("Job Worker {}", queueIndex).c_str());
+
+        while (true)
+        {
+            if (TryRunJob())
+                continue;
+
+            PXL_PROFILE_SCOPE_NAMED("Job Worker Idle");
+
+            std::unique_lock lock(s_SleepMutex);
+            s_SleepCondition.wait(lock, []() { return !s_Running || s_PendingJobCount > 0; });
+
+            if (!s_Running)
+                break;
+        }
+    }
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+
+namespace pxl
+{
+    enum class JobAffinity
+    {
+        Any,        // Runs on whichever thread picks it up first
+        MainThread, // Only runs on the main thread, e.g. for OpenGL calls
+    };
+
+    /// @brief Tracks a group of scheduled jobs. It's done once every job added to it has finished,
+    /// and can be passed to JobSystem::Schedule() as a dependency of later jobs.
+    class JobCounter
+    {
+    public:
+        bool IsDone() const { return m_Count.load(std::memory_order_acquire) == 0; }
+
+    private:
+        friend class JobSystem;
+
+        std::atomic<uint32_t> m_Count = 0;
+
+        // Jobs waiting on this counter, released once it reaches zero
+        std::mutex m_Mutex;
+        std::vector<std::function<void()>> m_Continuations;
+    };
+
+    /** @brief A work-stealing job system. Each worker thread owns a queue and steals from the others when it runs out.
+        The thread that initializes the job system becomes the main thread. It has a queue of its own and runs jobs
+        while it waits, and it's the only thread that runs JobAffinity::MainThread jobs.
+    */
+    class JobSystem
+    {
+    public:
+        // Starts the worker threads. A worker count of 0 uses one worker per core, minus the main thread
+        static void Init(uint32_t workerCount = 0);
+        static void Shutdown();
+
+        static bool IsInitialized() { return s_Enabled; }
+
+        static std::shared_ptr<JobCounter> Schedule(const std::function<void()>& job, JobAffinity affinity = JobAffinity::Any);
+
+        // Schedules a job that only starts once every dependency is done
+        static std::shared_ptr<JobCounter> Schedule(const std::function<void()>& job, const std::vector<std::shared_ptr<JobCounter>>& dependencies, JobAffinity affinity = JobAffinity::Any);
+
+        // Adds a job to an existing counter, so several jobs can be waited on or depended on as one
+        static void Schedule(const std::shared_ptr<JobCounter>& counter, const std::function<void()>& job, JobAffinity affinity = JobAffinity::Any);
+
+        // Blocks until the counter is done. The calling thread runs other jobs in the meantime
+        static void Wait(const std::shared_ptr<JobCounter>& counter);
+
+        /// @brief Calls func over [0, count) split into ranges of grainSize, and waits for all of them to finish.
+        /// @param grainSize The number of indices per job, 0 picks one that gives each thread a few jobs to balance the load
+        static void ParallelFor(uint32_t count, const std::function<void(uint32_t begin, uint32_t end)>& func, uint32_t grainSize = 0);
+
+        // Runs the main thread jobs that are ready, called by the application once per frame
+        static void RunMainThreadJobs();
+
+        // The number of threads that run jobs, including the main thread
+        static uint32_t GetThreadCount() { return static_cast<uint32_t>(s_Workers.size()) + 1; }
+
+        static bool IsMainThread() { return std::this_thread::get_id() == s_MainThreadID; }
+
+    private:
+        friend struct JobQueue;
+
+        struct Job
+        {
+            std::function<void()> Function;
+            std::shared_ptr<JobCounter> Counter;
+            JobAffinity Affinity = JobAffinity::Any;
+        };
+
+        static void Enqueue(Job&& job);
+        static void Execute(Job& job);
+        static bool TryRunJob();
+
+        static void WorkerLoop(uint32_t queueIndex);
+
+    private:
+        static inline bool s_Enabled = false;
+        static inline std::thread::id s_MainThreadID;
+        static inline std::vector<std::thread> s_Workers;
+    };
+}
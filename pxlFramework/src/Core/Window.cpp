@@ -4,6 +4,7 @@
 #include "Events/WindowEvents.h"
 #include "Input.h"
 #include "Platform.h"
+#include "Renderer/RenderThread.h"
 #include "Renderer/Renderer.h"
 #include "Renderer/Vulkan/VulkanContext.h"
 #include "Renderer/Vulkan/VulkanHelpers.h"
@@ -16,7 +17,7 @@ namespace pxl
     static constexpr uint8_t k_MaxWindowCount = 5;
 
     Window::Window(const WindowSpecs& specs)
-        : m_Title(specs.Title), m_Size(specs.Size), m_WindowMode(specs.WindowMode), m_RendererAPI(specs.RendererAPI)
+        : m_Title(specs.Title), m_Size(specs.Size), m_WindowMode(specs.WindowMode), m_RendererAPI(specs.RendererAPI), m_ShowAfterFirstPresent(specs.Visible)
     {
         if (!s_Initialized)
             Window::Init();
@@ -92,6 +93,11 @@ namespace pxl
 
                 glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
                 break;
+
+            case RendererAPIType::Null:
+                // The null renderer draws nothing, so the window doesn't need a client api
+                glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+                break;
         }
 
         m_GLFWWindow = glfwCreateWindow(static_cast<int>(m_Size.Width), static_cast<int>(m_Size.Height), m_Title.c_str(), glfwMonitor, nullptr);
@@ -116,14 +122,17 @@ namespace pxl
 
         // Init event and input systems
         m_EventCallback = Application::Get().GetEventManager()->GetEventSendCallback();
-        m_InputSystem = std::make_shared<InputSystem>(m_GLFWWindow, Application::Get().GetEventManager()->GetEventQueueCallback());
+        m_InputSystem = std::make_shared<InputSystem>(m_GLFWWindow, *Application::Get().GetEventManager());
     }
 
     void Window::Update()
     {
         PXL_PROFILE_SCOPE;
 
-        if (m_GraphicsContext)
+        // The render thread presents the renderer's context itself once it has drawn a frame packet
+        bool presentedByRenderThread = RenderThread::IsRunning() && m_GraphicsContext == Renderer::GetGraphicsContext();
+
+        if (m_GraphicsContext && !presentedByRenderThread)
             m_GraphicsContext->Present();
 
         if (m_ShowAfterFirstPresent)
@@ -416,7 +425,17 @@ namespace pxl
         if (windowInstance->m_WindowMode == WindowMode::Windowed)
             windowInstance->m_LastWindowedSize = { static_cast<uint32_t>(width), static_cast<uint32_t>(height) };
 
-        WindowResizeEvent event({ static_cast<uint32_t>(width), static_cast<uint32_t>(height) }, windowInstance->m_Handle.lock());
+        Size2D size = { static_cast<uint32_t>(width), static_cast<uint32_t>(height) };
+        auto& eventManager = Application::Get().GetEventManager();
+
+        // Drag resizing calls this for every step, so queue it to be coalesced into one resize per frame
+        if (eventManager->IsCoalescing(EventType::WindowResize))
+        {
+            eventManager->QueueEvent<WindowResizeEvent>(size, windowInstance->m_Handle.lock());
+            return;
+        }
+
+        WindowResizeEvent event(size, windowInstance->m_Handle.lock());
         windowInstance->m_EventCallback(event);
     }
 
@@ -424,34 +443,38 @@ namespace pxl
     {
         auto windowInstance = static_cast<Window*>(glfwGetWindowUserPointer(window));
 
-        if (Renderer::IsInitialized())
-        {
-            // Use windowed borderless hack
-            windowInstance->m_WindowMode == WindowMode::Borderless ? Renderer::ResizeViewport(0, 0, width - 1, height)
-                                                                   : Renderer::ResizeViewport(0, 0, width, height);
-            Renderer::ResizeScissor(0, 0, width, height);
-        }
-
-        if (Renderer::GetCurrentAPI() == RendererAPIType::Vulkan)
+        // The viewport and swapchain belong to the render thread while it's running
+        RenderThread::Submit([windowInstance, width, height]()
         {
-            auto swapchain = std::dynamic_pointer_cast<VulkanGraphicsContext>(windowInstance->m_GraphicsContext)->GetSwapchain();
-            auto swapchainSpecs = swapchain->GetSwapchainSpecs();
-
-            if (width == 0 || height == 0)
+            if (Renderer::IsInitialized())
             {
-                swapchain->Suspend();
-                return;
+                // Use windowed borderless hack
+                windowInstance->m_WindowMode == WindowMode::Borderless ? Renderer::ResizeViewport(0, 0, width - 1, height)
+                                                                       : Renderer::ResizeViewport(0, 0, width, height);
+                Renderer::ResizeScissor(0, 0, width, height);
             }
 
-            swapchain->Continue();
-
-            // Only recreate the swapchain if the fb size has actually changed
-            if (static_cast<uint32_t>(width) != swapchainSpecs.Extent.width || static_cast<uint32_t>(height) != swapchainSpecs.Extent.height)
+            if (Renderer::GetCurrentAPI() == RendererAPIType::Vulkan)
             {
-                swapchain->SetExtent({ static_cast<uint32_t>(width), static_cast<uint32_t>(height) });
-                swapchain->Invalidate();
+                auto swapchain = std::dynamic_pointer_cast<VulkanGraphicsContext>(windowInstance->m_GraphicsContext)->GetSwapchain();
+                auto swapchainSpecs = swapchain->GetSwapchainSpecs();
+
+                if (width == 0 || height == 0)
+                {
+                    swapchain->Suspend();
+                    return;
+                }
+
+                swapchain->Continue();
+
+                // Only recreate the swapchain if the fb size has actually changed
+                if (static_cast<uint32_t>(width) != swapchainSpecs.Extent.width || static_cast<uint32_t>(height) != swapchainSpecs.Extent.height)
+                {
+                    swapchain->SetExtent({ static_cast<uint32_t>(width), static_cast<uint32_t>(height) });
+                    swapchain->Invalidate();
+                }
             }
-        }
+        });
     }
 
     void Window::WindowIconifyCallback(GLFWwindow* window, int iconified)
@@ -570,7 +593,9 @@ namespace pxl
         for (auto& [jid, gamepad] : s_Gamepads)
             gamepad->UpdateState();
 
-        s_EventProcessFunc();
+        // Headless applications never initialize GLFW
+        if (s_Initialized)
+            s_EventProcessFunc();
     }
 
     void Window::UpdateAll()
@@ -628,8 +653,7 @@ namespace pxl
         PXL_LOG_INFO(LogArea::Input, "Controller {} connected", jid);
         if (glfwJoystickIsGamepad(jid))
         {
-            auto eventQueueCallback = Application::Get().GetEventManager()->GetEventQueueCallback();
-            auto gamepad = std::make_shared<Gamepad>(jid, eventQueueCallback);
+            auto gamepad = std::make_shared<Gamepad>(jid, *Application::Get().GetEventManager());
             s_Gamepads[jid] = gamepad;
 
             PXL_LOG_INFO(LogArea::Input, "- Name: {}", gamepad->GetName());
@@ -686,28 +710,9 @@ namespace pxl
         if (windowSpecs.RendererAPI == RendererAPIType::Vulkan)
         {
             // Initialize the Vulkan instance if necessary
-            if (!VulkanInstance::Get())
-            {
-                std::vector<const char*> selectedExtensions;
-                std::vector<const char*> selectedLayers;
-
-                // Initialize volk
-                VK_CHECK(volkInitialize());
-
-                // We are only using the required extensions by glfw for now
-                // Should retrieve VK_KHR_SURFACE and platform specific extensions (VK_KHR_win32_SURFACE)
-                selectedExtensions = Window::GetVKRequiredInstanceExtensions();
-
-                // Get available instance layers
-                auto availableLayers = VulkanHelpers::GetAvailableInstanceLayers();
-
-#ifdef PXL_DEBUG
-                // Get validation layer (Vulkan debugging)
-                selectedLayers.push_back(VulkanHelpers::GetValidationLayer(availableLayers));
-#endif
-
-                VulkanInstance::Init(selectedExtensions, selectedLayers);
-            }
+            // We are only using the required extensions by glfw for now
+            // Should retrieve VK_KHR_SURFACE and platform specific extensions (VK_KHR_win32_SURFACE)
+            VulkanInstance::InitDefault(Window::GetVKRequiredInstanceExtensions());
         }
 
         if (windowSpecs.RendererAPI != RendererAPIType::None)
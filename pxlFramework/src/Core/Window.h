@@ -84,6 +84,9 @@ namespace pxl
 
         // Use dark mode for window title
         bool DarkMode = true;
+
+        // Whether to show the window once it has been presented to. Hidden windows still render, which is useful for benchmarks and tools
+        bool Visible = true;
     };
 
     /// @brief A desktop window used to display stuff to the user
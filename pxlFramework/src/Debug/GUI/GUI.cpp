@@ -7,6 +7,7 @@
 
 #include "Core/Application.h"
 #include "GUIOpenGL.h"
+#include "Renderer/RenderThread.h"
 #include "Renderer/Renderer.h"
 
 namespace pxl
@@ -16,6 +17,12 @@ namespace pxl
         PXL_ASSERT_MSG(window, "Can't initialize GUI with invalid window");
         PXL_ASSERT_MSG(Renderer::IsInitialized(), "Renderer must be initialized before GUI is initialized");
 
+        if (RenderThread::IsRunning())
+        {
+            PXL_LOG_ERROR(LogArea::Other, "Can't initialize GUI while the render thread is running, ImGui's context can only be used from the main thread");
+            return;
+        }
+
         s_WindowHandle = window;
 
         // Setup Dear ImGui context
@@ -50,6 +57,10 @@ namespace pxl
             case RendererAPIType::Vulkan:
                 PXL_LOG_ERROR(LogArea::Other, "Can't initialize ImGui for Vulkan");
                 return;
+
+            case RendererAPIType::Null:
+                PXL_LOG_WARN(LogArea::Other, "Can't initialize ImGui for the null renderer, the debug GUI is disabled");
+                return;
         }
 
         s_Enabled = true;
@@ -4,6 +4,7 @@
 
 #include "Renderer/Vulkan/VulkanHelpers.h"
 #include "Renderer/Vulkan/VulkanInstance.h"
+#include "Renderer/Vulkan/VulkanRenderer.h"
 
 namespace pxl
 {
@@ -62,7 +63,7 @@ namespace pxl
 
     void GUIVulkan::Render()
     {
-        ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), m_ContextHandle->GetSwapchain()->GetCurrentFrame().CommandBuffer);
+        ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), VulkanRenderer::GetActiveCommandBuffer());
     }
 
     void GUIVulkan::Shutdown()
@@ -1,3 +1,9 @@
+#include "Profiler.h"
+
+#include <fstream>
+
+#include "Core/Input.h"
+
 // Memory allocation profiling
 #ifdef PXL_ENABLE_PROFILING
 void* operator new(std::size_t count)
@@ -12,4 +18,273 @@ void operator delete(void* ptr) noexcept
     TracyFree(ptr);
     free(ptr);
 }
-#endif
\ No newline at end of file
+#endif
+
+namespace pxl
+{
+    // Records kept per thread, older records are overwritten once a capture exceeds this. Must be a power of two
+    static constexpr uint64_t k_RecordsPerThread = 1 << 16;
+
+    // Only the owning thread writes to a buffer, so publishing a record is a single release store of the write index.
+    // Records stays empty until the thread submits its first record, so named threads cost nothing when nothing is captured
+    struct ProfilerThreadBuffer
+    {
+        std::vector<Profiler::Record> Records;
+        std::atomic<uint64_t> WriteIndex = 0;
+        uint64_t CaptureStartIndex = 0;
+        uint64_t CaptureEndIndex = 0; // Scopes still open when the capture ended are submitted after this, and aren't exported
+        uint32_t ThreadID = 0;
+        std::string Name;
+    };
+
+    // Buffers outlive their threads so a capture can still be exported after a thread exits
+    static std::mutex s_BufferMutex;
+    static std::vector<std::unique_ptr<ProfilerThreadBuffer>> s_Buffers;
+    static thread_local ProfilerThreadBuffer* s_ThreadBuffer = nullptr;
+
+    static uint64_t s_CaptureStartTicks = 0;
+    static uint64_t s_CaptureEndTicks = 0;
+    static std::chrono::steady_clock::time_point s_CaptureStartTime;
+    static std::chrono::steady_clock::time_point s_CaptureEndTime;
+
+    static ProfilerThreadBuffer& GetThreadBuffer()
+    {
+        if (!s_ThreadBuffer)
+        {
+            auto buffer = std::make_unique<ProfilerThreadBuffer>();
+
+            std::lock_guard lock(s_BufferMutex);
+            buffer->ThreadID = static_cast<uint32_t>(s_Buffers.size());
+            buffer->Name = std::format("Thread {}", buffer->ThreadID);
+
+            s_ThreadBuffer = buffer.get();
+            s_Buffers.push_back(std::move(buffer));
+        }
+
+        return *s_ThreadBuffer;
+    }
+
+    static void AppendJSONString(std::string& json, std::string_view str)
+    {
+        json += '"';
+
+        for (char c : str)
+        {
+            if (c == '"' || c == '\\')
+                json += '\\';
+
+            json += c;
+        }
+
+        json += '"';
+    }
+
+    void Profiler::BeginCapture()
+    {
+#if !defined(PXL_ENABLE_BUILTIN_PROFILER) || defined(PXL_ENABLE_PROFILING)
+        PXL_LOG_WARN(LogArea::Core, "Started a profiler capture, but the built-in profiler isn't enabled in this build so it will be empty");
+#endif
+
+        if (IsCapturing())
+            return;
+
+        {
+            std::lock_guard lock(s_BufferMutex);
+
+            for (auto& buffer : s_Buffers)
+                buffer->CaptureStartIndex = buffer->WriteIndex.load(std::memory_order_acquire);
+        }
+
+        s_CaptureStartTime = std::chrono::steady_clock::now();
+        s_CaptureStartTicks = GetTimestamp();
+
+        s_Capturing.store(true, std::memory_order_relaxed);
+
+        PXL_LOG_INFO(LogArea::Core, "Profiler capture started");
+    }
+
+    void Profiler::EndCapture()
+    {
+        if (!IsCapturing())
+            return;
+
+        {
+            std::lock_guard lock(s_BufferMutex);
+
+            // Another thread may have ended the capture at the same time
+            if (!IsCapturing())
+                return;
+
+            // Taken while still capturing, so every record the export reads was finished before the capture ended
+            for (auto& buffer : s_Buffers)
+                buffer->CaptureEndIndex = buffer->WriteIndex.load(std::memory_order_acquire);
+
+            s_Capturing.store(false, std::memory_order_relaxed);
+        }
+
+        s_CaptureEndTicks = GetTimestamp();
+        s_CaptureEndTime = std::chrono::steady_clock::now();
+        s_CaptureFramesRemaining.store(0, std::memory_order_relaxed);
+
+        auto time = std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now());
+        auto path = s_OutputDirectory / std::format("pxl_trace_{:%Y%m%d_%H%M%S}.json", time);
+
+        if (ExportChromeTrace(path))
+            PXL_LOG_INFO(LogArea::Core, "Profiler capture saved to '{}'", path.string());
+    }
+
+    void Profiler::CaptureFrames(uint32_t frameCount)
+    {
+        if (frameCount == 0 || IsCapturing())
+            return;
+
+        BeginCapture();
+        s_CaptureFramesRemaining.store(frameCount, std::memory_order_relaxed);
+    }
+
+    void Profiler::SetCaptureHotkey(KeyCode key, uint32_t frameCount)
+    {
+        s_CaptureHotkeyFrames.store(frameCount, std::memory_order_relaxed);
+        s_CaptureHotkey.store(key, std::memory_order_relaxed);
+    }
+
+    bool Profiler::ExportChromeTrace(const std::filesystem::path& path)
+    {
+        if (s_CaptureEndTicks <= s_CaptureStartTicks)
+        {
+            PXL_LOG_WARN(LogArea::Core, "Failed to export profiler capture, there is no finished capture to export");
+            return false;
+        }
+
+        // Work out the tick rate from the clock, rdtsc ticks don't have a fixed unit
+        double captureMicroseconds = std::chrono::duration<double, std::micro>(s_CaptureEndTime - s_CaptureStartTime).count();
+        double microsecondsPerTick = captureMicroseconds / static_cast<double>(s_CaptureEndTicks - s_CaptureStartTicks);
+
+        std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        bool firstEvent = true;
+        uint64_t droppedRecords = 0;
+
+        {
+            std::lock_guard lock(s_BufferMutex);
+
+            for (const auto& buffer : s_Buffers)
+            {
+                uint64_t endIndex = buffer->CaptureEndIndex;
+                uint64_t startIndex = buffer->CaptureStartIndex;
+
+                // Threads that started after the capture ended have nothing in it
+                if (endIndex < startIndex)
+                    continue;
+
+                // The ring buffer wrapped, during the capture or since then by scopes that were still open, so the oldest records are gone
+                uint64_t writeIndex = buffer->WriteIndex.load(std::memory_order_acquire);
+                uint64_t oldestIndex = std::min(writeIndex > k_RecordsPerThread ? writeIndex - k_RecordsPerThread : 0, endIndex);
+
+                if (startIndex < oldestIndex)
+                {
+                    droppedRecords += oldestIndex - startIndex;
+                    startIndex = oldestIndex;
+                }
+
+                if (startIndex == endIndex)
+                    continue;
+
+                json += firstEvent ? "" : ",";
+                json += std::format("{{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":0,\"tid\":{},\"args\":{{\"name\":", buffer->ThreadID);
+                AppendJSONString(json, buffer->Name);
+                json += "}}";
+                firstEvent = false;
+
+                for (uint64_t i = startIndex; i < endIndex; i++)
+                {
+                    const auto& record = buffer->Records[i & (k_RecordsPerThread - 1)];
+
+                    // Scopes that began before the capture started aren't recorded, but guard against them anyway
+                    if (record.Start < s_CaptureStartTicks || record.End < record.Start)
+                        continue;
+
+                    double start = static_cast<double>(record.Start - s_CaptureStartTicks) * microsecondsPerTick;
+                    double duration = static_cast<double>(record.End - record.Start) * microsecondsPerTick;
+
+                    json += ",{\"ph\":\"X\",\"name\":";
+                    AppendJSONString(json, record.Name);
+                    json += std::format(",\"pid\":0,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}", buffer->ThreadID, start, duration);
+                }
+            }
+        }
+
+        json += "]}";
+
+        if (droppedRecords > 0)
+            PXL_LOG_WARN(LogArea::Core, "Profiler capture exceeded the per thread record limit, {} records were dropped", droppedRecords);
+
+        std::error_code error;
+        if (path.has_parent_path())
+            std::filesystem::create_directories(path.parent_path(), error);
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+        if (!file.is_open())
+        {
+            PXL_LOG_WARN(LogArea::Core, "Failed to export profiler capture to '{}'", path.string());
+            return false;
+        }
+
+        file.write(json.data(), json.size());
+
+        return true;
+    }
+
+    void Profiler::SetThreadName(const std::string& name)
+    {
+        auto& buffer = GetThreadBuffer();
+
+        std::lock_guard lock(s_BufferMutex);
+        buffer.Name = name;
+    }
+
+    void Profiler::FrameEnd()
+    {
+        auto hotkey = s_CaptureHotkey.load(std::memory_order_relaxed);
+
+        if (hotkey && Input::IsInitialized())
+        {
+            bool hotkeyDown = Input::IsKeyPressed(*hotkey);
+
+            bool hotkeyWasDown = s_CaptureHotkeyWasDown.exchange(hotkeyDown, std::memory_order_relaxed);
+
+            if (hotkeyDown && !hotkeyWasDown)
+                CaptureFrames(s_CaptureHotkeyFrames.load(std::memory_order_relaxed));
+        }
+
+        // The count is reset if the capture is ended on another thread, so only end it if this is what took the count to 0
+        auto remaining = s_CaptureFramesRemaining.load(std::memory_order_relaxed);
+
+        while (remaining > 0)
+        {
+            if (s_CaptureFramesRemaining.compare_exchange_weak(remaining, remaining - 1, std::memory_order_relaxed))
+            {
+                if (remaining == 1)
+                    EndCapture();
+
+                break;
+            }
+        }
+    }
+
+    void Profiler::Submit(const char* name, uint64_t start, uint64_t end)
+    {
+        auto& buffer = GetThreadBuffer();
+
+        // Only the owning thread resizes its records, but the export reads them under the lock
+        if (buffer.Records.empty())
+        {
+            std::lock_guard lock(s_BufferMutex);
+            buffer.Records.resize(k_RecordsPerThread);
+        }
+
+        uint64_t index = buffer.WriteIndex.load(std::memory_order_relaxed);
+        buffer.Records[index & (k_RecordsPerThread - 1)] = { name, start, end };
+        buffer.WriteIndex.store(index + 1, std::memory_order_release);
+    }
+}
\ No newline at end of file
@@ -1,13 +1,126 @@
 #pragma once
 
+#include <atomic>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+#endif
+
+#include "Core/KeyCodes.h"
+
+namespace pxl
+{
+    /// @brief A lightweight built-in scope profiler, used by the PXL_PROFILE macros when PXL_ENABLE_BUILTIN_PROFILER is defined and Tracy isn't.
+    /// Scopes are only recorded during a capture, into a lock-free ring buffer owned by the recording thread.
+    /// Captures are exported as Chrome trace JSON, which can be opened in Perfetto (ui.perfetto.dev) or chrome://tracing
+    class Profiler
+    {
+    public:
+        struct Record
+        {
+            const char* Name; // Must be a string literal, since only the pointer is stored
+            uint64_t Start;
+            uint64_t End;
+        };
+
+        // Starts recording scopes on every thread until EndCapture() is called
+        static void BeginCapture();
+
+        // Stops recording and exports the capture to the output directory
+        static void EndCapture();
+
+        // Records the next few frames, then exports them
+        static void CaptureFrames(uint32_t frameCount);
+
+        static bool IsCapturing() { return s_Capturing.load(std::memory_order_relaxed); }
+
+        // Pressing the hotkey captures the given number of frames
+        static void SetCaptureHotkey(KeyCode key, uint32_t frameCount = 120);
+        static void ClearCaptureHotkey() { s_CaptureHotkey.store(std::nullopt, std::memory_order_relaxed); }
+
+        static void SetOutputDirectory(const std::filesystem::path& directory) { s_OutputDirectory = directory; }
+        static const std::filesystem::path& GetOutputDirectory() { return s_OutputDirectory; }
+
+        // Writes the records of the last capture to a Chrome trace JSON file
+        static bool ExportChromeTrace(const std::filesystem::path& path);
+
+        // Names the calling thread in exported traces
+        static void SetThreadName(const std::string& name);
+
+        // Called once per frame by PXL_PROFILE_FRAME_END to process capture triggers
+        static void FrameEnd();
+
+        // Raw CPU timestamp, in ticks. Uses rdtsc where available since it's much cheaper than querying a clock.
+        // Ticks are converted to time using the clock at the start and end of each capture, which assumes an invariant TSC
+        static uint64_t GetTimestamp()
+        {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+            return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+            return __builtin_ia32_rdtsc();
+#else
+            return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+        }
+
+        // Appends a record to the calling thread's ring buffer
+        static void Submit(const char* name, uint64_t start, uint64_t end);
+
+    private:
+        static inline std::atomic<bool> s_Capturing = false;
+        static inline std::atomic<uint32_t> s_CaptureFramesRemaining = 0; // Counted down by FrameEnd(), but a capture can be ended from any thread
+
+        static inline std::atomic<std::optional<KeyCode>> s_CaptureHotkey;
+        static inline std::atomic<uint32_t> s_CaptureHotkeyFrames = 0;
+        static inline std::atomic<bool> s_CaptureHotkeyWasDown = false;
+
+        static inline std::filesystem::path s_OutputDirectory = "profiles";
+    };
+
+    // Records the lifetime of a scope while a capture is running
+    class ProfileScope
+    {
+    public:
+        explicit ProfileScope(const char* name)
+            : m_Name(Profiler::IsCapturing() ? name : nullptr)
+        {
+            if (m_Name)
+                m_Start = Profiler::GetTimestamp();
+        }
+
+        ~ProfileScope()
+        {
+            if (m_Name)
+                Profiler::Submit(m_Name, m_Start, Profiler::GetTimestamp());
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+    private:
+        const char* m_Name = nullptr;
+        uint64_t m_Start = 0;
+    };
+}
+
+#define PXL_PROFILE_CONCAT_INNER(a, b) a##b
+#define PXL_PROFILE_CONCAT(a, b) PXL_PROFILE_CONCAT_INNER(a, b)
+
 #ifdef PXL_ENABLE_PROFILING
     #include <tracy/Tracy.hpp>
 
     #define PXL_PROFILE_SCOPE ZoneScoped;
     #define PXL_PROFILE_SCOPE_NAMED(zoneName) ZoneScopedN(zoneName);
     #define PXL_PROFILE_FRAME_END FrameMark;
+    #define PXL_PROFILE_THREAD(threadName) tracy::SetThreadName(threadName);
+#elif defined(PXL_ENABLE_BUILTIN_PROFILER)
+    #define PXL_PROFILE_SCOPE ::pxl::ProfileScope PXL_PROFILE_CONCAT(pxlProfileScope, __LINE__)(__FUNCTION__);
+    #define PXL_PROFILE_SCOPE_NAMED(zoneName) ::pxl::ProfileScope PXL_PROFILE_CONCAT(pxlProfileScope, __LINE__)(zoneName);
+    #define PXL_PROFILE_FRAME_END ::pxl::Profiler::FrameEnd();
+    #define PXL_PROFILE_THREAD(threadName) ::pxl::Profiler::SetThreadName(threadName);
 #else
     #define PXL_PROFILE_SCOPE
     #define PXL_PROFILE_SCOPE_NAMED(zoneName)
     #define PXL_PROFILE_FRAME_END
+    #define PXL_PROFILE_THREAD(threadName)
 #endif
\ No newline at end of file
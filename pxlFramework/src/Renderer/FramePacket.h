@@ -0,0 +1,52 @@
+#pragma once
+
+#include <glm/mat4x4.hpp>
+
+#include "Primitives/Cube.h"
+#include "Primitives/Line.h"
+#include "Primitives/Quad.h"
+#include "RendererData.h"
+
+namespace pxl
+{
+    struct FramePacketMeshDraw
+    {
+        std::shared_ptr<pxl::Mesh> Mesh;
+        glm::vec3 Position;
+        glm::vec3 Rotation;
+        glm::vec3 Scale;
+    };
+
+    /// @brief Everything the renderer needs to draw one frame, recorded by OnRender without touching the graphics API.
+    /// Packets are consumed on the render thread, so anything stored here must stay valid until the packet has been rendered
+    struct FramePacket
+    {
+        uint64_t FrameIndex = 0;
+
+        std::vector<Quad> Quads;
+        std::vector<Cube> Cubes;
+        std::vector<Line> Lines;
+        std::vector<FramePacketMeshDraw> Meshes;
+
+        std::optional<glm::vec4> ClearColour;
+
+        bool ReadbackRequested = false;
+
+        // Camera matrices at the time the packet was submitted, indexed by RendererGeometryTarget
+        std::array<glm::mat4, 4> ViewProjections = {};
+
+        // When the input this packet responds to was processed, used to measure input to present latency
+        std::chrono::steady_clock::time_point InputTimestamp = {};
+
+        // Clears the recorded commands but keeps the allocations for the next frame
+        void Reset()
+        {
+            Quads.clear();
+            Cubes.clear();
+            Lines.clear();
+            Meshes.clear();
+            ClearColour.reset();
+            ReadbackRequested = false;
+        }
+    };
+}
@@ -0,0 +1,173 @@
+#include "FrameReadback.h"
+
+namespace pxl
+{
+    std::shared_ptr<Image> ReadbackFrame::ToImage() const
+    {
+        PXL_PROFILE_SCOPE;
+
+        auto rowSize = GetRowSize();
+        auto height = static_cast<size_t>(m_Size.Height);
+
+        std::vector<uint8_t> pixels(GetByteSize());
+
+        for (size_t y = 0; y < height; y++)
+        {
+            auto srcRow = m_Pixels + (m_TopToBottom ? height - 1 - y : y) * rowSize;
+            auto dstRow = pixels.data() + y * rowSize;
+
+            memcpy(dstRow, srcRow, rowSize);
+
+            if (m_Format == ReadbackPixelFormat::BGRA8)
+            {
+                for (size_t x = 0; x < rowSize; x += 4)
+                    std::swap(dstRow[x], dstRow[x + 2]);
+            }
+        }
+
+        return std::make_shared<Image>(std::move(pixels), m_Size, ImageFormat::RGBA8);
+    }
+
+    FrameReadbackPool::FrameReadbackPool(uint32_t bufferCount)
+        : m_BufferCount(bufferCount)
+    {
+        PXL_ASSERT_MSG(bufferCount > 0, "A frame readback pool needs at least one buffer");
+
+        m_States = std::shared_ptr<std::atomic<BufferState>[]>(new std::atomic<BufferState>[bufferCount]);
+        m_Copies.resize(bufferCount);
+        m_FrameNumbers.resize(bufferCount);
+
+        for (uint32_t i = 0; i < bufferCount; i++)
+            m_States[i] = BufferState::Free;
+    }
+
+    FrameReadbackPool::~FrameReadbackPool()
+    {
+        for (uint32_t i = 0; i < m_BufferCount; i++)
+        {
+            if (m_States[i] == BufferState::Held)
+            {
+                PXL_LOG_WARN(LogArea::Renderer, "Frame readback buffers were destroyed while frames read back into them were still held");
+                break;
+            }
+        }
+    }
+
+    bool FrameReadbackPool::Queue(uint64_t frameNumber)
+    {
+        // Only one copy per frame
+        if (m_QueuedBuffer)
+            return true;
+
+        for (uint32_t i = 0; i < m_BufferCount; i++)
+        {
+            if (m_States[i].load(std::memory_order_acquire) != BufferState::Free)
+                continue;
+
+            m_States[i].store(BufferState::Queued, std::memory_order_relaxed);
+            m_FrameNumbers[i] = frameNumber;
+            m_QueuedBuffer = i;
+            return true;
+        }
+
+        m_Skipped++;
+        return false;
+    }
+
+    std::optional<uint32_t> FrameReadbackPool::TakeQueuedBuffer()
+    {
+        auto buffer = m_QueuedBuffer;
+        m_QueuedBuffer.reset();
+
+        if (buffer)
+        {
+            m_States[*buffer].store(BufferState::Copying, std::memory_order_relaxed);
+            m_InFlight.push_back(*buffer);
+            m_Requested++;
+        }
+
+        return buffer;
+    }
+
+    void FrameReadbackPool::Resolve()
+    {
+        PXL_PROFILE_SCOPE;
+
+        // The backend had nothing to copy (ie. no window framebuffer), so give the buffer back
+        if (m_QueuedBuffer)
+        {
+            m_States[*m_QueuedBuffer].store(BufferState::Free, std::memory_order_relaxed);
+            m_QueuedBuffer.reset();
+            m_Skipped++;
+        }
+
+        // Copies finish in submission order, so stop at the first one still in flight
+        while (!m_InFlight.empty() && IsCopyFinished(m_InFlight.front()))
+        {
+            auto buffer = m_InFlight.front();
+            m_InFlight.pop_front();
+
+            m_States[buffer].store(BufferState::Ready, std::memory_order_relaxed);
+            m_Completed++;
+
+            std::lock_guard lock(m_ReadyMutex);
+            m_Ready.push_back(buffer);
+        }
+    }
+
+    std::shared_ptr<ReadbackFrame> FrameReadbackPool::Poll()
+    {
+        uint32_t buffer = 0;
+
+        {
+            std::lock_guard lock(m_ReadyMutex);
+
+            if (m_Ready.empty())
+                return nullptr;
+
+            buffer = m_Ready.front();
+            m_Ready.pop_front();
+        }
+
+        m_States[buffer].store(BufferState::Held, std::memory_order_relaxed);
+
+        const auto& copy = m_Copies[buffer];
+
+        // Releasing the frame is all it takes to reuse the buffer, the release ordering makes sure the reads are done first
+        return std::make_shared<ReadbackFrame>(copy.Pixels, copy.Size, copy.Format, copy.TopToBottom, m_FrameNumbers[buffer], [states = m_States, buffer]()
+        {
+            states[buffer].store(BufferState::Free, std::memory_order_release);
+        });
+    }
+
+    bool FrameReadbackPool::HasFreeBuffer() const
+    {
+        if (m_QueuedBuffer)
+            return true;
+
+        for (uint32_t i = 0; i < m_BufferCount; i++)
+        {
+            if (m_States[i].load(std::memory_order_acquire) == BufferState::Free)
+                return true;
+        }
+
+        return false;
+    }
+
+    FrameReadbackStats FrameReadbackPool::GetStats() const
+    {
+        FrameReadbackStats stats = {};
+        stats.Requested = m_Requested;
+        stats.Skipped = m_Skipped;
+        stats.Completed = m_Completed;
+        stats.BufferCount = m_BufferCount;
+
+        for (uint32_t i = 0; i < m_BufferCount; i++)
+        {
+            if (m_States[i].load(std::memory_order_relaxed) != BufferState::Free)
+                stats.BuffersInUse++;
+        }
+
+        return stats;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <atomic>
+#include <deque>
+
+#include "Core/Image.h"
+#include "Core/Size.h"
+
+namespace pxl
+{
+    enum class ReadbackPixelFormat
+    {
+        RGBA8,
+        BGRA8, // Vulkan swapchains are usually BGRA
+    };
+
+    /// @brief A frame the GPU has finished copying back, read straight out of the mapped buffer it was copied into.
+    /// The buffer goes back to its pool once the last reference is released, so an encoder can hold onto it without copying the pixels,
+    /// but every frame held is one less buffer the renderer can read into. Frames have to be released before the renderer shuts down
+    class ReadbackFrame
+    {
+    public:
+        ReadbackFrame(const uint8_t* pixels, Size2D size, ReadbackPixelFormat format, bool topToBottom, uint64_t frameNumber, std::function<void()> onRelease)
+            : m_Pixels(pixels), m_Size(size), m_Format(format), m_TopToBottom(topToBottom), m_FrameNumber(frameNumber), m_OnRelease(std::move(onRelease))
+        {
+        }
+
+        ~ReadbackFrame()
+        {
+            if (m_OnRelease)
+                m_OnRelease();
+        }
+
+        ReadbackFrame(const ReadbackFrame&) = delete;
+        ReadbackFrame& operator=(const ReadbackFrame&) = delete;
+
+        // Rows are tightly packed, 4 bytes per pixel
+        const uint8_t* GetPixels() const { return m_Pixels; }
+        size_t GetRowSize() const { return static_cast<size_t>(m_Size.Width) * 4; }
+        size_t GetByteSize() const { return GetRowSize() * m_Size.Height; }
+
+        Size2D GetSize() const { return m_Size; }
+        ReadbackPixelFormat GetFormat() const { return m_Format; }
+
+        // OpenGL reads back bottom to top like every other Image, Vulkan reads back top to bottom
+        bool IsTopToBottom() const { return m_TopToBottom; }
+
+        // The renderer's frame number when the readback was requested
+        uint64_t GetFrameNumber() const { return m_FrameNumber; }
+
+        // Copies the pixels into an RGBA8 image with rows bottom to top, ready for FileSystem::WriteImageToFile.
+        // NOTE: This copies the whole frame, so avoid it on the main thread when reading back every frame
+        std::shared_ptr<Image> ToImage() const;
+
+    private:
+        const uint8_t* m_Pixels = nullptr;
+        Size2D m_Size = Size2D(0);
+        ReadbackPixelFormat m_Format = ReadbackPixelFormat::RGBA8;
+        bool m_TopToBottom = false;
+        uint64_t m_FrameNumber = 0;
+
+        std::function<void()> m_OnRelease;
+    };
+
+    struct FrameReadbackStats
+    {
+        uint64_t Requested = 0; // Frames copied into a buffer
+        uint64_t Skipped = 0;   // Requests made while every buffer was busy
+        uint64_t Completed = 0; // Copies the GPU has finished
+        uint32_t BuffersInUse = 0;
+        uint32_t BufferCount = 0;
+    };
+
+    /// @brief A ring of persistently mapped buffers frames are copied into without waiting on the GPU.
+    /// Each copy is fenced and the fences are only checked on later frames, so the CPU never waits for the copy and never reads a buffer the GPU is still writing.
+    /// Backends record the copy and the fence, the pool keeps track of which buffers are free, in flight, finished or held by the application
+    class FrameReadbackPool
+    {
+    public:
+        FrameReadbackPool(uint32_t bufferCount);
+        virtual ~FrameReadbackPool();
+
+        // Reserves a free buffer for the frame being recorded, the backend copies into it when the frame ends. Returns false if every buffer is busy
+        bool Queue(uint64_t frameNumber);
+
+        // Checks the fences of the copies in flight without waiting, in the order they were queued. Called once a frame after it's submitted
+        void Resolve();
+
+        // Takes the oldest finished frame, or nullptr if none are ready. Can be called from any thread
+        std::shared_ptr<ReadbackFrame> Poll();
+
+        FrameReadbackStats GetStats() const;
+
+        // Whether Queue() would succeed right now
+        bool HasFreeBuffer() const;
+
+    protected:
+        // Where a finished copy's pixels are, filled in by the backend when it records the copy
+        struct CopyInfo
+        {
+            const uint8_t* Pixels = nullptr;
+            Size2D Size = Size2D(0);
+            ReadbackPixelFormat Format = ReadbackPixelFormat::RGBA8;
+            bool TopToBottom = false;
+        };
+
+        // The buffer reserved by Queue() for this frame, if there is one. Backends call this while ending the frame to record the copy
+        std::optional<uint32_t> TakeQueuedBuffer();
+
+        // Returns true once the copy into the buffer has finished, must not wait. Backends make the pixels visible to the CPU here
+        virtual bool IsCopyFinished(uint32_t buffer) = 0;
+
+        uint32_t GetBufferCount() const { return m_BufferCount; }
+
+    protected:
+        std::vector<CopyInfo> m_Copies; // [buffer]
+
+    private:
+        enum class BufferState : uint8_t
+        {
+            Free,
+            Queued,  // Reserved for the frame being recorded
+            Copying, // Waiting on the GPU
+            Ready,   // Finished, waiting to be polled
+            Held,    // Handed to the application
+        };
+
+        uint32_t m_BufferCount = 0;
+
+        // Shared with the frames handed out, so releasing a frame after its pool is gone doesn't touch freed memory
+        std::shared_ptr<std::atomic<BufferState>[]> m_States = nullptr;
+        std::vector<uint64_t> m_FrameNumbers; // [buffer]
+
+        std::optional<uint32_t> m_QueuedBuffer;
+        std::deque<uint32_t> m_InFlight; // Copying buffers, oldest first
+
+        // Poll() may be called from a different thread to the one rendering
+        mutable std::mutex m_ReadyMutex;
+        std::deque<uint32_t> m_Ready;
+
+        std::atomic<uint64_t> m_Requested = 0;
+        std::atomic<uint64_t> m_Skipped = 0;
+        std::atomic<uint64_t> m_Completed = 0;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,432 @@
+#include "FrameRecorder.h"
+
+#ifdef _WIN32
+    #include <io.h>
+#else
+    #include <csignal>
+    #include <pthread.h>
+    #include <unistd.h>
+#endif
+
+#include "RenderThread.h"
+#include "Renderer.h"
+
+namespace pxl
+{
+    // The longest the Block backpressure mode holds up a frame waiting for a readback buffer
+    static constexpr auto k_BlockTimeout = std::chrono::seconds(1);
+
+    // Duplicates the descriptor so closing the stream doesn't close the caller's descriptor
+    static std::FILE* OpenFileDescriptor(int fd)
+    {
+#ifdef _WIN32
+        int duplicate = _dup(fd);
+        return duplicate >= 0 ? _fdopen(duplicate, "wb") : nullptr;
+#else
+        int duplicate = dup(fd);
+        return duplicate >= 0 ? fdopen(duplicate, "wb") : nullptr;
+#endif
+    }
+
+    bool FrameRecorder::Start(const FrameRecorderSpecs& specs)
+    {
+        if (IsRecording())
+        {
+            PXL_LOG_WARN(LogArea::Renderer, "Can't start recording frames, already recording");
+            return false;
+        }
+
+        if (!Renderer::IsInitialized())
+        {
+            PXL_LOG_ERROR(LogArea::Renderer, "Can't start recording frames, the renderer isn't initialized");
+            return false;
+        }
+
+        if (!specs.FileDescriptor && specs.Path.empty())
+        {
+            PXL_LOG_ERROR(LogArea::Renderer, "Can't start recording frames, no file descriptor or path was given");
+            return false;
+        }
+
+        s_Specs = specs;
+        s_Specs.QueueCapacity = std::max(s_Specs.QueueCapacity, 1u);
+
+        s_SegmentIndex = 0;
+        s_SegmentFrames = 0;
+        s_FrameSize.reset();
+        s_WriteFailed = false;
+
+        if (s_Specs.FileDescriptor)
+        {
+            s_Output = OpenFileDescriptor(*s_Specs.FileDescriptor);
+
+            if (!s_Output)
+            {
+                PXL_LOG_ERROR(LogArea::Renderer, "Can't start recording frames, failed to open file descriptor {}", *s_Specs.FileDescriptor);
+                return false;
+            }
+
+            std::setvbuf(s_Output, nullptr, _IOFBF, k_OutputBufferSize);
+        }
+        else if (!OpenSegment())
+        {
+            return false;
+        }
+
+        s_EnabledReadback = false;
+
+        if (!Renderer::IsFrameReadbackEnabled())
+        {
+            if (!Renderer::EnableFrameReadback(s_Specs.ReadbackBufferCount))
+            {
+                CloseOutput();
+                return false;
+            }
+
+            s_EnabledReadback = true;
+        }
+
+        s_Queue.assign(s_Specs.QueueCapacity, nullptr);
+        s_QueueHead = 0;
+        s_QueueTail = 0;
+
+        s_FramesWritten = 0;
+        s_BytesWritten = 0;
+        s_DroppedReadback = 0;
+        s_DroppedQueueFull = 0;
+        s_DroppedResized = 0;
+
+        s_StopRequested = false;
+        s_WriterThread = std::thread(WriterLoop);
+
+        s_Recording = true;
+
+        PXL_LOG_INFO(LogArea::Renderer, "Started recording frames to {}", s_Specs.FileDescriptor ? std::format("file descriptor {}", *s_Specs.FileDescriptor) : s_Specs.Path.string());
+
+        return true;
+    }
+
+    void FrameRecorder::Stop()
+    {
+        if (!IsRecording())
+            return;
+
+        s_Recording = false;
+
+        // Make sure the render thread has stopped pushing frames, which makes this thread the only producer
+        RenderThread::WaitIdle();
+
+        // Readbacks still in flight are left behind, the writer finishes once the queue is empty
+        s_StopRequested = true;
+
+        // Wakes the writer if it's waiting for a frame. If the queue is full it isn't waiting, and sees the flag once it has caught up
+        auto tail = s_QueueTail.load(std::memory_order_relaxed);
+
+        if (tail - s_QueueHead.load(std::memory_order_acquire) < s_Queue.size())
+        {
+            s_Queue[tail % s_Queue.size()] = nullptr;
+            s_QueueTail.store(tail + 1, std::memory_order_release);
+            s_QueueTail.notify_one();
+        }
+
+        s_WriterThread.join();
+        s_Queue.clear();
+
+        CloseOutput();
+
+        if (s_EnabledReadback)
+            Renderer::DisableFrameReadback();
+
+        auto stats = GetStats();
+        PXL_LOG_INFO(LogArea::Renderer, "Stopped recording frames, {} written and {} dropped", stats.FramesWritten, stats.GetDroppedFrames());
+    }
+
+    FrameRecorderStats FrameRecorder::GetStats()
+    {
+        FrameRecorderStats stats = {};
+        stats.FramesWritten = s_FramesWritten;
+        stats.BytesWritten = s_BytesWritten;
+        stats.DroppedReadback = s_DroppedReadback;
+        stats.DroppedQueueFull = s_DroppedQueueFull;
+        stats.DroppedResized = s_DroppedResized;
+        stats.QueueDepth = static_cast<uint32_t>(s_QueueTail.load(std::memory_order_relaxed) - s_QueueHead.load(std::memory_order_relaxed));
+
+        return stats;
+    }
+
+    void FrameRecorder::OnEndFrame(FrameReadbackPool& pool)
+    {
+        PXL_PROFILE_SCOPE;
+
+        if (s_Specs.Backpressure == FrameRecorderBackpressure::Block)
+        {
+            // Buffers are freed by the GPU finishing its copies and the writer finishing with frames, so keep both moving until one is free.
+            // A buffer can also be held by something other than the recorder, which would never free it, so only wait so long before dropping the frame
+            auto deadline = std::chrono::steady_clock::now() + k_BlockTimeout;
+
+            while (!pool.HasFreeBuffer() && !s_WriteFailed)
+            {
+                pool.Resolve();
+                CollectFrames(pool);
+
+                if (std::chrono::steady_clock::now() >= deadline)
+                {
+                    PXL_LOG_WARN(LogArea::Renderer, "Timed out waiting for a free readback buffer, dropping frame {}", Renderer::s_FrameNumber);
+                    break;
+                }
+
+                std::this_thread::yield();
+            }
+        }
+
+        if (!pool.Queue(Renderer::s_FrameNumber))
+            s_DroppedReadback++;
+    }
+
+    void FrameRecorder::CollectFrames(FrameReadbackPool& pool)
+    {
+        PXL_PROFILE_SCOPE;
+
+        while (auto frame = pool.Poll())
+        {
+            if (!s_FrameSize)
+                s_FrameSize = frame->GetSize();
+
+            // Raw and Y4M streams can't change size part way through
+            if (frame->GetSize().Width != s_FrameSize->Width || frame->GetSize().Height != s_FrameSize->Height)
+            {
+                if (s_DroppedResized++ == 0)
+                    PXL_LOG_WARN(LogArea::Renderer, "Dropping recorded frames that aren't {}x{}, the size recording started at", s_FrameSize->Width, s_FrameSize->Height);
+
+                continue;
+            }
+
+            Push(std::move(frame));
+        }
+    }
+
+    bool FrameRecorder::Push(std::shared_ptr<ReadbackFrame> frame)
+    {
+        auto tail = s_QueueTail.load(std::memory_order_relaxed);
+        auto head = s_QueueHead.load(std::memory_order_acquire);
+        auto deadline = std::chrono::steady_clock::now() + k_BlockTimeout;
+
+        while (tail - head >= s_Queue.size())
+        {
+            // The writer may be stuck on a reader that stopped reading (eg. a stalled pipe), so blocking only waits so long
+            if (s_Specs.Backpressure == FrameRecorderBackpressure::Drop || std::chrono::steady_clock::now() >= deadline)
+            {
+                s_DroppedQueueFull++;
+                return false;
+            }
+
+            // Polled rather than waited on, since a wait on the head can't time out
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            head = s_QueueHead.load(std::memory_order_acquire);
+        }
+
+        s_Queue[tail % s_Queue.size()] = std::move(frame);
+
+        s_QueueTail.store(tail + 1, std::memory_order_release);
+        s_QueueTail.notify_one();
+
+        return true;
+    }
+
+    void FrameRecorder::WriterLoop()
+    {
+        PXL_PROFILE_THREAD("Frame Recorder");
+
+#ifndef _WIN32
+        // SIGPIPE is sent to the writing thread if the reader of a pipe goes away. Blocking it here turns that into a failed write
+        // instead of terminating the application, without changing how the rest of the process handles the signal
+        sigset_t signals;
+        sigemptyset(&signals);
+        sigaddset(&signals, SIGPIPE);
+        pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+#endif
+
+        while (true)
+        {
+            auto head = s_QueueHead.load(std::memory_order_relaxed);
+            auto tail = s_QueueTail.load(std::memory_order_acquire);
+
+            if (head == tail)
+            {
+                if (s_StopRequested)
+                    break;
+
+                // Sleeps until a frame is pushed, or Stop() wakes it
+                s_QueueTail.wait(tail, std::memory_order_acquire);
+                continue;
+            }
+
+            auto frame = std::move(s_Queue[head % s_Queue.size()]);
+
+            s_QueueHead.store(head + 1, std::memory_order_release);
+
+            // Pushed by Stop() to wake the writer once everything else has been queued
+            if (!frame)
+                break;
+
+            if (s_WriteFailed)
+                continue;
+
+            if (!WriteFrame(*frame))
+            {
+                PXL_LOG_ERROR(LogArea::Renderer, "Failed to write recorded frame, the rest of the recording will be discarded");
+                s_WriteFailed = true;
+            }
+
+            // Releasing the frame hands its buffer back to the readback pool
+        }
+
+        if (s_Output)
+            std::fflush(s_Output);
+    }
+
+    bool FrameRecorder::WriteFrame(const ReadbackFrame& frame)
+    {
+        PXL_PROFILE_SCOPE;
+
+        auto width = static_cast<size_t>(frame.GetSize().Width);
+        auto height = static_cast<size_t>(frame.GetSize().Height);
+        auto rowSize = frame.GetRowSize();
+        auto pixels = frame.GetPixels();
+        bool bgra = frame.GetFormat() == ReadbackPixelFormat::BGRA8;
+
+        // Every segment is a complete file. File descriptors are always one stream
+        if (!s_Specs.FileDescriptor && s_Specs.FramesPerSegment > 0 && s_SegmentFrames == s_Specs.FramesPerSegment)
+        {
+            s_SegmentIndex++;
+            s_SegmentFrames = 0;
+
+            if (!OpenSegment())
+                return false;
+        }
+
+        // Both formats are written top to bottom
+        auto getRow = [&](size_t y) { return pixels + (frame.IsTopToBottom() ? y : height - 1 - y) * rowSize; };
+
+        if (s_Specs.Format == FrameRecorderFormat::Y4M)
+        {
+            if (s_SegmentFrames == 0)
+            {
+                auto header = std::format("YUV4MPEG2 W{} H{} F{}:1 Ip A1:1 C444\n", width, height, s_Specs.FrameRate);
+
+                if (!Write(header.data(), header.size()))
+                    return false;
+            }
+
+            // BT.601 video range, which is what players assume when the stream doesn't say
+            auto planeSize = width * height;
+            s_ScratchBuffer.resize(planeSize * 3);
+
+            auto yPlane = s_ScratchBuffer.data();
+            auto uPlane = yPlane + planeSize;
+            auto vPlane = uPlane + planeSize;
+
+            size_t redOffset = bgra ? 2 : 0;
+            size_t blueOffset = bgra ? 0 : 2;
+
+            for (size_t y = 0; y < height; y++)
+            {
+                auto row = getRow(y);
+
+                for (size_t x = 0; x < width; x++)
+                {
+                    int r = row[x * 4 + redOffset];
+                    int g = row[x * 4 + 1];
+                    int b = row[x * 4 + blueOffset];
+
+                    auto i = y * width + x;
+                    yPlane[i] = static_cast<uint8_t>(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+                    uPlane[i] = static_cast<uint8_t>(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+                    vPlane[i] = static_cast<uint8_t>(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+                }
+            }
+
+            if (!Write("FRAME\n", 6) || !Write(s_ScratchBuffer.data(), s_ScratchBuffer.size()))
+                return false;
+        }
+        else if (!bgra && frame.IsTopToBottom())
+        {
+            if (!Write(pixels, frame.GetByteSize()))
+                return false;
+        }
+        else
+        {
+            // Rows are written straight from the mapped buffer, only BGRA frames need swizzling first
+            s_ScratchBuffer.resize(rowSize);
+
+            for (size_t y = 0; y < height; y++)
+            {
+                auto row = getRow(y);
+
+                if (bgra)
+                {
+                    for (size_t x = 0; x < rowSize; x += 4)
+                    {
+                        s_ScratchBuffer[x + 0] = row[x + 2];
+                        s_ScratchBuffer[x + 1] = row[x + 1];
+                        s_ScratchBuffer[x + 2] = row[x + 0];
+                        s_ScratchBuffer[x + 3] = row[x + 3];
+                    }
+
+                    row = s_ScratchBuffer.data();
+                }
+
+                if (!Write(row, rowSize))
+                    return false;
+            }
+        }
+
+        s_SegmentFrames++;
+        s_FramesWritten++;
+
+        return true;
+    }
+
+    bool FrameRecorder::OpenSegment()
+    {
+        CloseOutput();
+
+        auto path = s_Specs.Path;
+
+        if (s_Specs.FramesPerSegment > 0)
+            path.replace_filename(std::format("{}_{:04}{}", s_Specs.Path.stem().string(), s_SegmentIndex, s_Specs.Path.extension().string()));
+
+        if (path.has_parent_path())
+            std::filesystem::create_directories(path.parent_path());
+
+        s_Output = std::fopen(path.string().c_str(), "wb");
+
+        if (!s_Output)
+        {
+            PXL_LOG_ERROR(LogArea::Renderer, "Failed to open '{}' to record frames to", path.string());
+            return false;
+        }
+
+        std::setvbuf(s_Output, nullptr, _IOFBF, k_OutputBufferSize);
+
+        return true;
+    }
+
+    void FrameRecorder::CloseOutput()
+    {
+        if (!s_Output)
+            return;
+
+        std::fclose(s_Output);
+        s_Output = nullptr;
+    }
+
+    bool FrameRecorder::Write(const void* data, size_t size)
+    {
+        if (std::fwrite(data, 1, size, s_Output) != size)
+            return false;
+
+        s_BytesWritten += size;
+        return true;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <atomic>
+#include <cstdio>
+
+#include "FrameReadback.h"
+
+namespace pxl
+{
+    enum class FrameRecorderFormat
+    {
+        RawRGBA, // Tightly packed RGBA8 rows, top to bottom, with no header
+        Y4M,     // YUV4MPEG2 with 4:4:4 BT.601 video range planes, which ffmpeg and most encoders read directly
+    };
+
+    enum class FrameRecorderBackpressure
+    {
+        Drop,  // Frames are dropped when the writer falls behind, so the frame rate is never affected
+        Block, // The renderer waits for the writer (up to a second for a readback buffer and a second for room in the queue), so every frame is recorded unless the writer stalls
+    };
+
+    struct FrameRecorderSpecs
+    {
+        FrameRecorderFormat Format = FrameRecorderFormat::Y4M;
+        FrameRecorderBackpressure Backpressure = FrameRecorderBackpressure::Drop;
+
+        // An already open file descriptor to write to, such as a pipe to an encoder or 1 for stdout. The recorder doesn't close it
+        std::optional<int> FileDescriptor;
+
+        // Otherwise frames are written to this file. With segments, each segment is its own complete file named <stem>_<index><extension>
+        std::filesystem::path Path;
+        uint32_t FramesPerSegment = 0; // 0 writes every frame to one file
+
+        // Only written to the Y4M header
+        uint32_t FrameRate = 60;
+
+        uint32_t QueueCapacity = 8;      // Frames waiting for the writer
+        uint32_t ReadbackBufferCount = 4; // Used if frame readback isn't already enabled
+    };
+
+    struct FrameRecorderStats
+    {
+        uint64_t FramesWritten = 0;
+        uint64_t BytesWritten = 0;
+
+        uint64_t DroppedReadback = 0;  // Every readback buffer was busy when the frame ended
+        uint64_t DroppedQueueFull = 0; // The writer's queue was full
+        uint64_t DroppedResized = 0;   // The frame's size didn't match the first frame recorded
+
+        uint32_t QueueDepth = 0;
+
+        uint64_t GetDroppedFrames() const { return DroppedReadback + DroppedQueueFull + DroppedResized; }
+    };
+
+    /// @brief Records every rendered frame to a file or pipe using frame readback, so recording doesn't stall the renderer.
+    /// Finished readbacks are passed to a writer thread through a bounded lock-free queue and written straight out of the mapped readback buffers.
+    /// Works with windows and headless renderers alike (see Renderer::Init(RendererAPIType, const FramebufferSpecs&)).
+    /// NOTE: While recording, the recorder takes every frame from the readback pool, so Renderer::PollReadback() shouldn't be used at the same time
+    class FrameRecorder
+    {
+    public:
+        static bool Start(const FrameRecorderSpecs& specs);
+
+        // Writes the frames still queued, then closes the output
+        static void Stop();
+
+        static bool IsRecording() { return s_Recording.load(std::memory_order_relaxed); }
+
+        static FrameRecorderStats GetStats();
+
+    private:
+        friend class Renderer;
+
+        // Called by the renderer before a frame ends. Requests the frame be read back, waiting for a free buffer first when blocking
+        static void OnEndFrame(FrameReadbackPool& pool);
+
+        // Called by the renderer after a frame ends, moves finished readbacks into the queue
+        static void CollectFrames(FrameReadbackPool& pool);
+
+        // Waits for space when blocking. Returns false if the frame was dropped
+        static bool Push(std::shared_ptr<ReadbackFrame> frame);
+
+        static void WriterLoop();
+        static bool WriteFrame(const ReadbackFrame& frame);
+        static bool OpenSegment();
+        static void CloseOutput();
+
+        static bool Write(const void* data, size_t size);
+
+    private:
+        static inline std::atomic<bool> s_Recording = false;
+        static inline FrameRecorderSpecs s_Specs = {};
+
+        // Whether Start() enabled frame readback, in which case Stop() disables it again
+        static inline bool s_EnabledReadback = false;
+
+        // Single producer (the thread that renders), single consumer (the writer). Indices only ever increase
+        static inline std::vector<std::shared_ptr<ReadbackFrame>> s_Queue;
+        static inline std::atomic<uint64_t> s_QueueHead = 0; // Next frame to write
+        static inline std::atomic<uint64_t> s_QueueTail = 0; // Next free slot
+
+        static inline std::thread s_WriterThread;
+        static inline std::atomic<bool> s_WriteFailed = false;
+        static inline std::atomic<bool> s_StopRequested = false; // The writer finishes once the queue is empty
+
+        // Only used by the writer thread once started
+        static inline std::FILE* s_Output = nullptr;
+        static constexpr size_t k_OutputBufferSize = 1024 * 1024; // Frames are large, so a bigger buffer cuts down on write calls
+        static inline uint32_t s_SegmentIndex = 0;
+        static inline uint32_t s_SegmentFrames = 0;
+        static inline std::vector<uint8_t> s_ScratchBuffer;
+
+        static inline std::optional<Size2D> s_FrameSize;
+
+        static inline std::atomic<uint64_t> s_FramesWritten = 0;
+        static inline std::atomic<uint64_t> s_BytesWritten = 0;
+        static inline std::atomic<uint64_t> s_DroppedReadback = 0;
+        static inline std::atomic<uint64_t> s_DroppedQueueFull = 0;
+        static inline std::atomic<uint64_t> s_DroppedResized = 0;
+    };
+}
\ No newline at end of file
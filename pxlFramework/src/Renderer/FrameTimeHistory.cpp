@@ -0,0 +1,98 @@
+#include "FrameTimeHistory.h"
+
+namespace pxl
+{
+    // How many frames between median refreshes, and how many frames are needed before stutters are counted
+    static constexpr uint32_t k_MedianRefreshInterval = 32;
+
+    FrameTimeHistory::FrameTimeHistory(size_t capacity)
+        : m_Samples(std::max<size_t>(capacity, 1))
+    {
+    }
+
+    void FrameTimeHistory::Add(float frameTimeMS)
+    {
+        if (m_Median > 0.0f && frameTimeMS > m_Median * 2.0f)
+            m_StutterCount++;
+
+        // Evict the oldest sample from the running sum once the ring is full
+        if (m_Count == m_Samples.size())
+            m_Sum -= m_Samples[m_Next];
+        else
+            m_Count++;
+
+        m_Samples[m_Next] = frameTimeMS;
+        m_Sum += frameTimeMS;
+        m_Next = (m_Next + 1) % m_Samples.size();
+
+        if (++m_SamplesSinceMedian >= k_MedianRefreshInterval)
+            UpdateMedian();
+    }
+
+    void FrameTimeHistory::Clear()
+    {
+        m_Next = 0;
+        m_Count = 0;
+        m_Sum = 0.0;
+        m_Median = 0.0f;
+        m_SamplesSinceMedian = 0;
+        m_StutterCount = 0;
+    }
+
+    FrameTimeSummary FrameTimeHistory::GetSummary() const
+    {
+        PXL_PROFILE_SCOPE;
+
+        FrameTimeSummary summary;
+        summary.SampleCount = static_cast<uint32_t>(m_Count);
+        summary.StutterCount = m_StutterCount;
+
+        if (m_Count == 0)
+            return summary;
+
+        m_SortScratch.assign(m_Samples.begin(), m_Samples.begin() + m_Count);
+        std::sort(m_SortScratch.begin(), m_SortScratch.end());
+
+        auto percentile = [&](float p)
+        {
+            auto index = static_cast<size_t>(p * static_cast<float>(m_Count - 1) + 0.5f);
+            return m_SortScratch[std::min(index, m_Count - 1)];
+        };
+
+        summary.Mean = GetMean();
+        summary.P50 = percentile(0.50f);
+        summary.P95 = percentile(0.95f);
+        summary.P99 = percentile(0.99f);
+        summary.Max = m_SortScratch.back();
+
+        // Always include at least the slowest frame
+        size_t slowestCount = std::max<size_t>(m_Count / 100, 1);
+        double slowestSum = 0.0;
+        for (size_t i = m_Count - slowestCount; i < m_Count; i++)
+            slowestSum += m_SortScratch[i];
+
+        summary.OnePercentLow = static_cast<float>(slowestSum / static_cast<double>(slowestCount));
+
+        return summary;
+    }
+
+    void FrameTimeHistory::ForEach(const std::function<void(float)>& func) const
+    {
+        size_t first = (m_Next + m_Samples.size() - m_Count) % m_Samples.size();
+
+        for (size_t i = 0; i < m_Count; i++)
+            func(m_Samples[(first + i) % m_Samples.size()]);
+    }
+
+    void FrameTimeHistory::UpdateMedian()
+    {
+        m_SamplesSinceMedian = 0;
+
+        m_SortScratch.assign(m_Samples.begin(), m_Samples.begin() + m_Count);
+
+        auto middle = m_SortScratch.begin() + m_SortScratch.size() / 2;
+        std::nth_element(m_SortScratch.begin(), middle, m_SortScratch.end());
+
+        m_Median = *middle;
+    }
+}
\ No newline at end of file
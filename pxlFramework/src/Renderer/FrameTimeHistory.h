@@ -0,0 +1,61 @@
+#pragma once
+
+namespace pxl
+{
+    // Percentiles of the frame times in a FrameTimeHistory, all in milliseconds
+    struct FrameTimeSummary
+    {
+        uint32_t SampleCount = 0;
+        float Mean = 0.0f;
+        float P50 = 0.0f;
+        float P95 = 0.0f;
+        float P99 = 0.0f;
+        float Max = 0.0f;
+        float OnePercentLow = 0.0f; // The mean of the slowest 1% of frames
+        uint32_t StutterCount = 0;
+
+        float GetOnePercentLowFPS() const { return OnePercentLow > 0.0f ? 1000.0f / OnePercentLow : 0.0f; }
+    };
+
+    /// @brief A fixed-size ring of the most recent frame times.
+    /// Adding a frame and reading the mean are O(1), percentiles are computed when a summary is requested.
+    /// Frames taking more than twice the median are counted as stutters. Not thread-safe, even reading a summary sorts into a shared buffer
+    class FrameTimeHistory
+    {
+    public:
+        explicit FrameTimeHistory(size_t capacity = 1024);
+
+        void Add(float frameTimeMS);
+        void Clear();
+
+        float GetMean() const { return m_Count > 0 ? static_cast<float>(m_Sum / static_cast<double>(m_Count)) : 0.0f; }
+        float GetLatest() const { return m_Count > 0 ? m_Samples[(m_Next + m_Samples.size() - 1) % m_Samples.size()] : 0.0f; }
+
+        size_t GetSampleCount() const { return m_Count; }
+        size_t GetCapacity() const { return m_Samples.size(); }
+
+        // Total stutters since the history was created or cleared, this isn't limited to the frames still in the ring
+        uint32_t GetStutterCount() const { return m_StutterCount; }
+
+        FrameTimeSummary GetSummary() const;
+
+        // Calls the function with each sample from oldest to newest, for plotting
+        void ForEach(const std::function<void(float)>& func) const;
+
+    private:
+        void UpdateMedian();
+
+    private:
+        std::vector<float> m_Samples;
+        size_t m_Next = 0;
+        size_t m_Count = 0;
+        double m_Sum = 0.0;
+
+        // The median is only refreshed every so often, since stutters are judged against the typical frame rather than the exact median
+        float m_Median = 0.0f;
+        uint32_t m_SamplesSinceMedian = 0;
+        uint32_t m_StutterCount = 0;
+
+        mutable std::vector<float> m_SortScratch;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+#include "Framebuffer.h"
+
+#include "Null/NullFramebuffer.h"
+#include "OpenGL/OpenGLFramebuffer.h"
+#include "Renderer.h"
+#include "Vulkan/VulkanOffscreenFramebuffer.h"
+
+namespace pxl
+{
+    std::shared_ptr<Framebuffer> Framebuffer::Create(const FramebufferSpecs& specs)
+    {
+        PXL_ASSERT_MSG(specs.Size.Width > 0 && specs.Size.Height > 0, "Framebuffer size must be greater than 0");
+
+        switch (Renderer::GetCurrentAPI())
+        {
+            case RendererAPIType::None:
+                PXL_LOG_ERROR(LogArea::Renderer, "Can't create Framebuffer for no renderer api.");
+                break;
+            case RendererAPIType::OpenGL:   return std::make_shared<OpenGLFramebuffer>(specs);
+            case RendererAPIType::Vulkan:   return std::make_shared<VulkanOffscreenFramebuffer>(specs);
+            case RendererAPIType::Null:     return std::make_shared<NullFramebuffer>(specs);
+        }
+
+        return nullptr;
+    }
+}
\ No newline at end of file
@@ -1,12 +1,33 @@
 #pragma once
 
+#include "Core/Image.h"
+#include "Core/Size.h"
+
 namespace pxl
 {
+    struct FramebufferSpecs
+    {
+        Size2D Size = Size2D(0);
+
+        // Geometry is depth tested while drawing into the framebuffer, the same as when drawing to a window
+        bool DepthAttachment = true;
+    };
+
+    /// @brief An offscreen render target with an RGBA8 colour attachment and an optional depth attachment
     class Framebuffer
     {
     public:
         virtual ~Framebuffer() = default;
 
+        // NOTE: The contents of the attachments are lost
         virtual void Resize(uint32_t width, uint32_t height) = 0;
+
+        virtual const FramebufferSpecs& GetSpecs() const = 0;
+
+        // Copies the colour attachment back to the CPU. Rows are ordered bottom to top like every other Image, so FileSystem::WriteImageToFile writes it the right way up.
+        // Blocks until the GPU has finished everything drawn to the framebuffer so far
+        virtual std::shared_ptr<Image> ReadPixels() = 0;
+
+        static std::shared_ptr<Framebuffer> Create(const FramebufferSpecs& specs);
     };
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "GPUBuffer.h"
 
+#include "Null/NullBuffer.h"
 #include "OpenGL/OpenGLBuffer.h"
 #include "Renderer.h"
 #include "Vulkan/VulkanBuffer.h"
@@ -15,6 +16,7 @@ namespace pxl
                 break;
             case RendererAPIType::OpenGL:   return std::make_shared<OpenGLBuffer>(usage, drawHint, size, data);
             case RendererAPIType::Vulkan:   return std::make_shared<VulkanBuffer>(usage, drawHint, size, data);
+            case RendererAPIType::Null:     return std::make_shared<NullBuffer>(usage, drawHint, size, data);
         }
 
         return nullptr;
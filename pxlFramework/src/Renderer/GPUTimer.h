@@ -0,0 +1,32 @@
+#pragma once
+
+namespace pxl
+{
+    // The parts of a frame the GPU time is measured for
+    enum class GPUTimerSection
+    {
+        Meshes,
+        StaticQuads,
+        StaticCubes,
+        Quads,
+        Cubes,
+        Lines,
+        GUI,
+        Count,
+    };
+
+    static constexpr size_t k_GPUTimerSectionCount = static_cast<size_t>(GPUTimerSection::Count);
+
+    // Timers started after this many in one frame aren't measured. Each record task uses one timer
+    static constexpr uint32_t k_MaxGPUTimersPerFrame = 64;
+
+    // How long the GPU spent executing each section of a frame, in milliseconds
+    struct GPUTimings
+    {
+        float FrameTime = 0.0f; // From the start to the end of the frame's commands, including any gaps between sections
+        std::array<float, k_GPUTimerSectionCount> SectionTimes = {};
+        uint64_t Sequence = 0; // Increases every time a new frame's timings are read back
+
+        float GetSectionTime(GPUTimerSection section) const { return SectionTimes[static_cast<size_t>(section)]; }
+    };
+}
\ No newline at end of file
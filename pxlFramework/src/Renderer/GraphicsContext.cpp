@@ -1,5 +1,6 @@
 #include "GraphicsContext.h"
 
+#include "Null/NullContext.h"
 #include "OpenGL/OpenGLContext.h"
 #include "Vulkan/VulkanContext.h"
 
@@ -12,6 +13,22 @@ namespace pxl
             case RendererAPIType::None:   PXL_LOG_ERROR(LogArea::Renderer, "Can't create Graphics Context for RendererAPIType::None"); return nullptr;
             case RendererAPIType::OpenGL: return std::make_shared<OpenGLGraphicsContext>(window);
             case RendererAPIType::Vulkan: return std::make_shared<VulkanGraphicsContext>(window);
+            case RendererAPIType::Null:   return std::make_shared<NullGraphicsContext>(window);
+        }
+
+        PXL_LOG_ERROR(LogArea::Renderer, "Unknown RendererAPIType");
+
+        return nullptr;
+    }
+
+    std::shared_ptr<GraphicsContext> GraphicsContext::CreateHeadless(RendererAPIType api, const FramebufferSpecs& targetSpecs)
+    {
+        switch (api)
+        {
+            case RendererAPIType::None:   PXL_LOG_ERROR(LogArea::Renderer, "Can't create Graphics Context for RendererAPIType::None"); return nullptr;
+            case RendererAPIType::OpenGL: return std::make_shared<OpenGLGraphicsContext>();
+            case RendererAPIType::Vulkan: return std::make_shared<VulkanGraphicsContext>(targetSpecs);
+            case RendererAPIType::Null:   return std::make_shared<NullGraphicsContext>(nullptr);
         }
 
         PXL_LOG_ERROR(LogArea::Renderer, "Unknown RendererAPIType");
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Framebuffer.h"
 #include "GraphicsDevice.h"
 #include "RendererAPIType.h"
 #include "RendererLimits.h"
@@ -23,10 +24,17 @@ namespace pxl
         // Required for OpenGL
         virtual void SetAsCurrent() = 0;
 
+        // Blocks until the GPU has finished the last presented frame
+        virtual void WaitForPreviousFrame() = 0;
+
         virtual std::shared_ptr<GraphicsDevice> GetDevice() const = 0;
 
         virtual RendererLimits GetLimits() = 0;
 
         static std::shared_ptr<GraphicsContext> Create(RendererAPIType api, const std::shared_ptr<Window>& window);
+
+        // Creates a context that isn't tied to a window and can only draw into framebuffers, such as on servers without a display.
+        // The target specs describe the framebuffer the renderer will draw into
+        static std::shared_ptr<GraphicsContext> CreateHeadless(RendererAPIType api, const FramebufferSpecs& targetSpecs);
     };
 }
\ No newline at end of file
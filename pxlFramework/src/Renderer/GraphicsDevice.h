@@ -14,6 +14,7 @@ namespace pxl
     {
         Graphics,
         Compute,
+        Transfer,
     };
 
     // Represents a Graphics Processing Device (GPU)
@@ -0,0 +1,37 @@
+#pragma once
+
+namespace pxl
+{
+    enum class LatencyMode
+    {
+        Default, // Up to 3 frames in flight for the most CPU/GPU overlap
+        Low,     // 2 frames in flight, and VSync presents the newest frame (mailbox) instead of queueing frames
+        Minimum, // 1 frame in flight, and input is sampled only after the GPU has finished the previous frame
+    };
+
+    // What a latency mode resolves to
+    struct LatencySettings
+    {
+        uint32_t FramesInFlight = 3;
+        bool PreferMailbox = false;        // Use mailbox rather than FIFO presentation when VSync is on
+        bool WaitForPreviousFrame = false; // Wait for the previous frame before polling events, so input is as fresh as possible
+
+        // A frames in flight override of 0 keeps the mode's default
+        static LatencySettings FromMode(LatencyMode mode, uint32_t framesInFlightOverride = 0)
+        {
+            LatencySettings settings;
+
+            switch (mode)
+            {
+                case LatencyMode::Default: settings = { 3, false, false }; break;
+                case LatencyMode::Low:     settings = { 2, true, false }; break;
+                case LatencyMode::Minimum: settings = { 1, true, true }; break;
+            }
+
+            if (framesInFlightOverride > 0)
+                settings.FramesInFlight = std::clamp(framesInFlightOverride, 1u, 3u);
+
+            return settings;
+        }
+    };
+}
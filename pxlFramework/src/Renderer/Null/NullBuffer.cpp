@@ -0,0 +1,49 @@
+#include "NullBuffer.h"
+
+namespace pxl
+{
+    NullBuffer::NullBuffer(GPUBufferUsage usage, [[maybe_unused]] GPUBufferDrawHint drawHint, uint32_t size, const void* data)
+        : m_BindPoint(ToBindPoint(usage))
+    {
+        NullCommandRecorder::Record(&NullCommandStats::BuffersCreated);
+
+        // Buffers created without data only allocate storage
+        if (data)
+        {
+            NullCommandRecorder::Record(&NullCommandStats::BufferUploads);
+            NullCommandRecorder::Record(&NullCommandStats::BytesUploaded, size);
+        }
+    }
+
+    void NullBuffer::Bind()
+    {
+        NullCommandRecorder::RecordBind(m_BindPoint, this);
+    }
+
+    void NullBuffer::Unbind()
+    {
+        NullCommandRecorder::RecordUnbind(m_BindPoint);
+    }
+
+    void NullBuffer::SetData(uint32_t size, [[maybe_unused]] const void* data)
+    {
+        NullCommandRecorder::Record(&NullCommandStats::BufferUploads);
+        NullCommandRecorder::Record(&NullCommandStats::BytesUploaded, size);
+    }
+
+    NullBindPoint NullBuffer::ToBindPoint(GPUBufferUsage usage)
+    {
+        switch (usage)
+        {
+            case GPUBufferUsage::None:
+                PXL_LOG_ERROR(LogArea::Renderer, "Buffer usage was none, treating it as a vertex buffer");
+                return NullBindPoint::VertexBuffer;
+
+            case GPUBufferUsage::Vertex:  return NullBindPoint::VertexBuffer;
+            case GPUBufferUsage::Index:   return NullBindPoint::IndexBuffer;
+            case GPUBufferUsage::Uniform: return NullBindPoint::UniformBuffer;
+        }
+
+        return NullBindPoint::VertexBuffer;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "NullCommandRecorder.h"
+#include "Renderer/GPUBuffer.h"
+
+namespace pxl
+{
+    // Keeps no data, uploads are only counted
+    class NullBuffer : public GPUBuffer
+    {
+    public:
+        NullBuffer(GPUBufferUsage usage, GPUBufferDrawHint drawHint, uint32_t size, const void* data);
+        virtual ~NullBuffer() override = default;
+
+        virtual void Bind() override;
+        virtual void Unbind() override;
+
+        virtual void SetData(uint32_t size, const void* data) override;
+
+    private:
+        static NullBindPoint ToBindPoint(GPUBufferUsage usage);
+
+    private:
+        NullBindPoint m_BindPoint = NullBindPoint::VertexBuffer;
+    };
+}
\ No newline at end of file
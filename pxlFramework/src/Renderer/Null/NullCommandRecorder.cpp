@@ -0,0 +1,65 @@
+#include "NullCommandRecorder.h"
+
+namespace pxl
+{
+    void NullCommandRecorder::Record(uint64_t NullCommandStats::* counter, uint64_t amount)
+    {
+        std::lock_guard lock(s_Mutex);
+
+        s_Stats.*counter += amount;
+    }
+
+    void NullCommandRecorder::RecordBind(NullBindPoint point, const void* object, uint32_t unit)
+    {
+        std::lock_guard lock(s_Mutex);
+
+        switch (point)
+        {
+            case NullBindPoint::VertexBuffer:
+            case NullBindPoint::IndexBuffer:
+            case NullBindPoint::UniformBuffer: s_Stats.BufferBinds++; break;
+            case NullBindPoint::VertexArray:   s_Stats.VertexArrayBinds++; break;
+            case NullBindPoint::Pipeline:      s_Stats.PipelineBinds++; break;
+            case NullBindPoint::Texture:       s_Stats.TextureBinds++; break;
+        }
+
+        auto& bound = s_Bound[GetBindSlot(point, unit)];
+
+        if (bound == object)
+            s_Stats.RedundantBinds++;
+
+        bound = object;
+    }
+
+    void NullCommandRecorder::RecordUnbind(NullBindPoint point, uint32_t unit)
+    {
+        std::lock_guard lock(s_Mutex);
+
+        s_Bound[GetBindSlot(point, unit)] = nullptr;
+    }
+
+    NullCommandStats NullCommandRecorder::GetStats()
+    {
+        std::lock_guard lock(s_Mutex);
+
+        return s_Stats;
+    }
+
+    void NullCommandRecorder::Reset()
+    {
+        std::lock_guard lock(s_Mutex);
+
+        s_Stats = {};
+        s_Bound = {};
+    }
+
+    size_t NullCommandRecorder::GetBindSlot(NullBindPoint point, uint32_t unit)
+    {
+        if (point != NullBindPoint::Texture)
+            return static_cast<size_t>(point);
+
+        PXL_ASSERT_MSG(unit < k_TextureUnitCount, "Texture unit {} is out of range for the null renderer", unit);
+
+        return static_cast<size_t>(NullBindPoint::Texture) + std::min(unit, k_TextureUnitCount - 1);
+    }
+}
\ No newline at end of file
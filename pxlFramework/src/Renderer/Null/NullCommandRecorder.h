@@ -0,0 +1,80 @@
+#pragma once
+
+namespace pxl
+{
+    // What the null backend was asked to do since it was created or its counts were last reset
+    struct NullCommandStats
+    {
+        uint64_t Frames = 0;
+        uint64_t Presents = 0;
+        uint64_t Clears = 0;
+
+        uint64_t DrawCalls = 0;
+        uint64_t VerticesDrawn = 0; // From array and line draws
+        uint64_t IndicesDrawn = 0;
+
+        uint64_t BufferBinds = 0;
+        uint64_t VertexArrayBinds = 0;
+        uint64_t PipelineBinds = 0;
+        uint64_t TextureBinds = 0;
+        uint64_t RedundantBinds = 0; // Binds of an object that was already bound, these are also included in the counts above
+
+        uint64_t UniformUpdates = 0;
+        uint64_t PushConstantUpdates = 0;
+        uint64_t ViewportChanges = 0;
+        uint64_t ScissorChanges = 0;
+        uint64_t ClearColourChanges = 0;
+
+        uint64_t BufferUploads = 0;
+        uint64_t BytesUploaded = 0; // Buffer and texture data
+
+        uint64_t BuffersCreated = 0;
+        uint64_t TexturesCreated = 0;
+        uint64_t ShadersCreated = 0;
+        uint64_t PipelinesCreated = 0;
+
+        // Binds that actually changed what was bound, plus every other state change
+        uint64_t GetStateChanges() const
+        {
+            return BufferBinds + VertexArrayBinds + PipelineBinds + TextureBinds - RedundantBinds + ViewportChanges + ScissorChanges + ClearColourChanges;
+        }
+    };
+
+    enum class NullBindPoint
+    {
+        VertexBuffer,
+        IndexBuffer,
+        UniformBuffer,
+        VertexArray,
+        Pipeline,
+        Texture,
+    };
+
+    /// @brief Collects what the null backend's objects are asked to do, in place of any GPU work.
+    /// Objects may be created and used from different threads, so every call is synchronized
+    class NullCommandRecorder
+    {
+    public:
+        // Adds to one of the counters, e.g. Record(&NullCommandStats::Clears)
+        static void Record(uint64_t NullCommandStats::* counter, uint64_t amount = 1);
+
+        // Counts a bind, and whether the object was already bound at that point
+        static void RecordBind(NullBindPoint point, const void* object, uint32_t unit = 0);
+        static void RecordUnbind(NullBindPoint point, uint32_t unit = 0);
+
+        static NullCommandStats GetStats();
+        static void Reset();
+
+        static constexpr uint32_t k_TextureUnitCount = 32;
+
+    private:
+        static size_t GetBindSlot(NullBindPoint point, uint32_t unit);
+
+    private:
+        static inline std::mutex s_Mutex;
+        static inline NullCommandStats s_Stats = {};
+
+        // What is bound at each bind point, with one slot per texture unit
+        static inline std::array<const void*, static_cast<size_t>(NullBindPoint::Texture) + k_TextureUnitCount> s_Bound = {};
+    };
+}
\ No newline at end of file
@@ -0,0 +1,25 @@
+#include "NullContext.h"
+
+#include "NullCommandRecorder.h"
+
+namespace pxl
+{
+    NullGraphicsContext::NullGraphicsContext([[maybe_unused]] const std::shared_ptr<Window>& window)
+    {
+        PXL_LOG_INFO(LogArea::Renderer, "Null graphics context created, no GPU work will be done");
+    }
+
+    void NullGraphicsContext::Present()
+    {
+        PXL_PROFILE_SCOPE;
+
+        NullCommandRecorder::Record(&NullCommandStats::Presents);
+    }
+
+    RendererLimits NullGraphicsContext::GetLimits()
+    {
+        return {
+            .MaxTextureUnits = NullCommandRecorder::k_TextureUnitCount,
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Core/Window.h"
+#include "Renderer/GraphicsContext.h"
+
+namespace pxl
+{
+    // A graphics context with nothing behind it, presenting only counts the frame
+    class NullGraphicsContext : public GraphicsContext
+    {
+    public:
+        NullGraphicsContext(const std::shared_ptr<Window>& window);
+        virtual ~NullGraphicsContext() override = default;
+
+        virtual void Present() override;
+
+        virtual bool GetVSync() const override { return m_VSync; }
+        virtual void SetVSync(bool value) override { m_VSync = value; }
+        virtual void ToggleVSync() override { SetVSync(!m_VSync); }
+
+        virtual void SetAsCurrent() override {}
+
+        // There is no GPU to wait for
+        virtual void WaitForPreviousFrame() override {}
+
+        virtual std::shared_ptr<GraphicsDevice> GetDevice() const override { return nullptr; }
+
+        virtual RendererLimits GetLimits() override;
+
+    private:
+        bool m_VSync = true;
+    };
+}
\ No newline at end of file
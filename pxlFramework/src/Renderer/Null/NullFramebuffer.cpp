@@ -0,0 +1,13 @@
+#include "NullFramebuffer.h"
+
+namespace pxl
+{
+    std::shared_ptr<Image> NullFramebuffer::ReadPixels()
+    {
+        auto image = std::make_shared<Image>();
+        image->Metadata = { m_Specs.Size, ImageFormat::RGBA8 };
+        image->Buffer.resize(static_cast<size_t>(m_Specs.Size.Width) * m_Specs.Size.Height * 4);
+
+        return image;
+    }
+}
\ No newline at end of file
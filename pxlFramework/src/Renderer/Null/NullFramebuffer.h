@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Renderer/Framebuffer.h"
+
+namespace pxl
+{
+    // Nothing is drawn into it, so read backs are always transparent black
+    class NullFramebuffer : public Framebuffer
+    {
+    public:
+        NullFramebuffer(const FramebufferSpecs& specs)
+            : m_Specs(specs)
+        {
+        }
+
+        virtual void Resize(uint32_t width, uint32_t height) override { m_Specs.Size = { width, height }; }
+
+        virtual const FramebufferSpecs& GetSpecs() const override { return m_Specs; }
+
+        virtual std::shared_ptr<Image> ReadPixels() override;
+
+    private:
+        FramebufferSpecs m_Specs;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,37 @@
+#include "NullPipeline.h"
+
+#include "NullCommandRecorder.h"
+
+namespace pxl
+{
+    NullGraphicsPipeline::NullGraphicsPipeline(const GraphicsPipelineSpecs& specs)
+        : m_Specs(specs)
+    {
+        NullCommandRecorder::Record(&NullCommandStats::PipelinesCreated);
+    }
+
+    void NullGraphicsPipeline::Bind()
+    {
+        NullCommandRecorder::RecordBind(NullBindPoint::Pipeline, this);
+    }
+
+    void NullGraphicsPipeline::Unbind()
+    {
+        NullCommandRecorder::RecordUnbind(NullBindPoint::Pipeline);
+    }
+
+    void NullGraphicsPipeline::SetUniformData([[maybe_unused]] const std::string& name, [[maybe_unused]] UniformDataType type, [[maybe_unused]] const void* data)
+    {
+        NullCommandRecorder::Record(&NullCommandStats::UniformUpdates);
+    }
+
+    void NullGraphicsPipeline::SetUniformData([[maybe_unused]] const std::string& name, [[maybe_unused]] UniformDataType type, [[maybe_unused]] uint32_t count, [[maybe_unused]] const void* data)
+    {
+        NullCommandRecorder::Record(&NullCommandStats::UniformUpdates);
+    }
+
+    void NullGraphicsPipeline::SetPushConstantData([[maybe_unused]] const std::string& name, [[maybe_unused]] const void* data)
+    {
+        NullCommandRecorder::Record(&NullCommandStats::PushConstantUpdates);
+    }
+}
\ No newline at end of file
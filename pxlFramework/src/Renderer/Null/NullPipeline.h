@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Renderer/Pipeline.h"
+
+namespace pxl
+{
+    class NullGraphicsPipeline : public GraphicsPipeline
+    {
+    public:
+        NullGraphicsPipeline(const GraphicsPipelineSpecs& specs);
+        virtual ~NullGraphicsPipeline() override = default;
+
+        virtual void Bind() override;
+        virtual void Unbind() override;
+
+        virtual void SetUniformData(const std::string& name, UniformDataType type, const void* data) override;
+        virtual void SetUniformData(const std::string& name, UniformDataType type, uint32_t count, const void* data) override;
+
+        virtual void SetPushConstantData(const std::string& name, const void* data) override;
+
+        virtual void* GetLayout() override { return nullptr; }
+
+        virtual const GraphicsPipelineSpecs& GetSpecs() override { return m_Specs; }
+        virtual void SetSpecs(const GraphicsPipelineSpecs& specs) override { m_Specs = specs; }
+
+    private:
+        GraphicsPipelineSpecs m_Specs = {};
+    };
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#include "NullRenderer.h"
+
+#include "NullCommandRecorder.h"
+
+namespace pxl
+{
+    NullRenderer::NullRenderer()
+    {
+        // Count from a clean slate each time the renderer is initialized
+        NullCommandRecorder::Reset();
+
+        PXL_LOG_INFO(LogArea::Renderer, "Null renderer initialized");
+    }
+
+    void NullRenderer::BeginFrame()
+    {
+        NullCommandRecorder::Record(&NullCommandStats::Frames);
+    }
+
+    void NullRenderer::Clear()
+    {
+        NullCommandRecorder::Record(&NullCommandStats::Clears);
+    }
+
+    void NullRenderer::SetClearColour([[maybe_unused]] const glm::vec4& colour)
+    {
+        NullCommandRecorder::Record(&NullCommandStats::ClearColourChanges);
+    }
+
+    void NullRenderer::DrawArrays(uint32_t vertexCount)
+    {
+        NullCommandRecorder::Record(&NullCommandStats::DrawCalls);
+        NullCommandRecorder::Record(&NullCommandStats::VerticesDrawn, vertexCount);
+    }
+
+    void NullRenderer::DrawLines(uint32_t vertexCount)
+    {
+        NullCommandRecorder::Record(&NullCommandStats::DrawCalls);
+        NullCommandRecorder::Record(&NullCommandStats::VerticesDrawn, vertexCount);
+    }
+
+    void NullRenderer::DrawIndexed(uint32_t indexCount)
+    {
+        NullCommandRecorder::Record(&NullCommandStats::DrawCalls);
+        NullCommandRecorder::Record(&NullCommandStats::IndicesDrawn, indexCount);
+    }
+
+    void NullRenderer::SetViewport([[maybe_unused]] uint32_t x, [[maybe_unused]] uint32_t y, [[maybe_unused]] uint32_t width, [[maybe_unused]] uint32_t height)
+    {
+        NullCommandRecorder::Record(&NullCommandStats::ViewportChanges);
+    }
+
+    void NullRenderer::SetScissor([[maybe_unused]] uint32_t x, [[maybe_unused]] uint32_t y, [[maybe_unused]] uint32_t width, [[maybe_unused]] uint32_t height)
+    {
+        NullCommandRecorder::Record(&NullCommandStats::ScissorChanges);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Renderer/RendererAPI.h"
+
+namespace pxl
+{
+    /// @brief A renderer API that does no GPU work. Every command is counted by the NullCommandRecorder instead,
+    /// so the renderer front end (batching, culling, sorting) can be profiled and tested on machines without a GPU
+    class NullRenderer : public RendererAPI
+    {
+    public:
+        NullRenderer();
+        virtual ~NullRenderer() override = default;
+
+        virtual void BeginFrame() override;
+        virtual void EndFrame() override {}
+
+        virtual void Clear() override;
+        virtual void SetClearColour(const glm::vec4& colour) override;
+
+        virtual void DrawArrays(uint32_t vertexCount) override;
+        virtual void DrawLines(uint32_t vertexCount) override;
+        virtual void DrawIndexed(uint32_t indexCount) override;
+
+        virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+        virtual void SetScissor(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+    };
+}
\ No newline at end of file
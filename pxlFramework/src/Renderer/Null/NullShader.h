@@ -0,0 +1,25 @@
+#pragma once
+
+#include "NullCommandRecorder.h"
+#include "Renderer/Shader.h"
+
+namespace pxl
+{
+    // Ignores its source, nothing is compiled
+    class NullShader : public Shader
+    {
+    public:
+        NullShader(ShaderStage stage)
+            : m_ShaderStage(stage)
+        {
+            NullCommandRecorder::Record(&NullCommandStats::ShadersCreated);
+        }
+
+        virtual void Reload() override {}
+
+        virtual ShaderStage GetShaderStage() const override { return m_ShaderStage; }
+
+    private:
+        ShaderStage m_ShaderStage = ShaderStage::Vertex;
+    };
+}
\ No newline at end of file
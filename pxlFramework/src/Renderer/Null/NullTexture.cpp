@@ -0,0 +1,52 @@
+#include "NullTexture.h"
+
+#include "NullCommandRecorder.h"
+
+namespace pxl
+{
+    NullTexture::NullTexture(const Image& image, const TextureSpecs& specs)
+        : m_Metadata(image.Metadata), m_Specs(specs)
+    {
+        NullCommandRecorder::Record(&NullCommandStats::TexturesCreated);
+        NullCommandRecorder::Record(&NullCommandStats::BytesUploaded, image.Buffer.size());
+    }
+
+    NullTexture::NullTexture(const std::shared_ptr<Image>& image, const TextureSpecs& specs)
+        : NullTexture(*image, specs)
+    {
+    }
+
+    void NullTexture::SetData([[maybe_unused]] const void* data)
+    {
+        uint64_t size = static_cast<uint64_t>(m_Metadata.Size.Width) * m_Metadata.Size.Height * GetBytesPerPixel(m_Metadata.Format);
+
+        NullCommandRecorder::Record(&NullCommandStats::BytesUploaded, size);
+    }
+
+    void NullTexture::Bind(uint32_t unit)
+    {
+        NullCommandRecorder::RecordBind(NullBindPoint::Texture, this, unit);
+        m_BoundUnit = unit;
+    }
+
+    void NullTexture::Unbind()
+    {
+        if (!m_BoundUnit)
+            return;
+
+        NullCommandRecorder::RecordUnbind(NullBindPoint::Texture, *m_BoundUnit);
+        m_BoundUnit.reset();
+    }
+
+    uint32_t NullTexture::GetBytesPerPixel(ImageFormat format)
+    {
+        switch (format)
+        {
+            case ImageFormat::Undefined: return 0;
+            case ImageFormat::RGB8:      return 3;
+            case ImageFormat::RGBA8:     return 4;
+        }
+
+        return 0;
+    }
+}
\ No newline at end of file
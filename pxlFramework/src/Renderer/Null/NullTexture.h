@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Renderer/Texture.h"
+
+namespace pxl
+{
+    // Keeps the image's metadata but not its pixels, uploads are only counted
+    class NullTexture : public Texture
+    {
+    public:
+        NullTexture(const Image& image, const TextureSpecs& specs);
+        NullTexture(const std::shared_ptr<Image>& image, const TextureSpecs& specs);
+        virtual ~NullTexture() override = default;
+
+        virtual void SetData(const void* data) override;
+
+        virtual void Bind(uint32_t unit) override;
+        virtual void Unbind() override;
+
+        virtual const ImageMetadata& GetMetadata() const override { return m_Metadata; }
+
+    private:
+        static uint32_t GetBytesPerPixel(ImageFormat format);
+
+    private:
+        ImageMetadata m_Metadata;
+        TextureSpecs m_Specs;
+
+        std::optional<uint32_t> m_BoundUnit;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,16 @@
+#include "NullVertexArray.h"
+
+#include "NullCommandRecorder.h"
+
+namespace pxl
+{
+    void NullVertexArray::Bind()
+    {
+        NullCommandRecorder::RecordBind(NullBindPoint::VertexArray, this);
+    }
+
+    void NullVertexArray::Unbind()
+    {
+        NullCommandRecorder::RecordUnbind(NullBindPoint::VertexArray);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Renderer/VertexArray.h"
+
+namespace pxl
+{
+    class NullVertexArray : public VertexArray
+    {
+    public:
+        NullVertexArray() = default;
+        virtual ~NullVertexArray() override = default;
+
+        virtual void Bind() override;
+        virtual void Unbind() override;
+
+        // Vertex arrays only reference their buffers, so setting them up isn't counted
+        virtual void AddVertexBuffer([[maybe_unused]] const std::shared_ptr<GPUBuffer>& vertexBuffer, [[maybe_unused]] const BufferLayout& layout) override {}
+        virtual void SetIndexBuffer([[maybe_unused]] const std::shared_ptr<GPUBuffer>& indexBuffer) override {}
+    };
+}
\ No newline at end of file
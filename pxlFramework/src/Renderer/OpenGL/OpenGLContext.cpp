@@ -2,6 +2,11 @@
 
 #include <glad/glad.h>
 
+#ifdef PXL_ENABLE_EGL
+    #include <EGL/egl.h>
+    #include <EGL/eglext.h>
+#endif
+
 namespace pxl
 {
     [[maybe_unused]] static void GLCallback([[maybe_unused]] GLenum source, [[maybe_unused]] GLenum type, [[maybe_unused]] GLuint id,
@@ -33,7 +38,67 @@ namespace pxl
         : m_GLFWWindowHandle(window->GetNativeWindow())
     {
         SetAsCurrent();
-        if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+        LoadGL((GLADloadproc)glfwGetProcAddress);
+
+        glfwSwapInterval(m_VSync);
+    }
+
+    OpenGLGraphicsContext::OpenGLGraphicsContext()
+        : m_Headless(true)
+    {
+        if (!CreateSurfacelessContext())
+            CreateHiddenWindowContext();
+    }
+
+    OpenGLGraphicsContext::~OpenGLGraphicsContext()
+    {
+#ifdef PXL_ENABLE_EGL
+        if (m_EGLContext)
+        {
+            eglMakeCurrent(m_EGLDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+            eglDestroyContext(m_EGLDisplay, m_EGLContext);
+        }
+
+        if (m_EGLDisplay)
+            eglTerminate(m_EGLDisplay);
+#endif
+
+        if (m_OwnsWindow)
+            glfwDestroyWindow(m_GLFWWindowHandle);
+    }
+
+    void OpenGLGraphicsContext::Present()
+    {
+        PXL_PROFILE_SCOPE;
+
+        if (!m_Headless)
+            glfwSwapBuffers(m_GLFWWindowHandle);
+    }
+
+    void OpenGLGraphicsContext::SetVSync(bool value)
+    {
+        if (!m_Headless)
+            value ? glfwSwapInterval(1) : glfwSwapInterval(0);
+
+        m_VSync = value;
+    }
+
+    void OpenGLGraphicsContext::SetAsCurrent()
+    {
+#ifdef PXL_ENABLE_EGL
+        if (m_EGLContext)
+        {
+            eglMakeCurrent(m_EGLDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, m_EGLContext);
+            return;
+        }
+#endif
+
+        glfwMakeContextCurrent(m_GLFWWindowHandle);
+    }
+
+    void OpenGLGraphicsContext::LoadGL(GLADloadproc loader)
+    {
+        if (!gladLoadGLLoader(loader))
         {
             PXL_LOG_ERROR(LogArea::OpenGL, "Failed to initialize Glad");
         }
@@ -46,25 +111,127 @@ namespace pxl
         glDebugMessageCallback(GLCallback, nullptr);
 #endif
 
-        glfwSwapInterval(m_VSync);
+        m_ProgramCache = std::make_unique<OpenGLProgramCache>();
     }
 
-    void OpenGLGraphicsContext::Present()
+    bool OpenGLGraphicsContext::CreateSurfacelessContext()
     {
-        PXL_PROFILE_SCOPE;
+#ifdef PXL_ENABLE_EGL
+        // The surfaceless platform (Mesa) needs no window system at all, otherwise fall back to the default display
+        auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+
+        EGLDisplay display = EGL_NO_DISPLAY;
+        if (getPlatformDisplay)
+            display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+
+        if (display == EGL_NO_DISPLAY)
+            display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
 
-        glfwSwapBuffers(m_GLFWWindowHandle);
+        EGLint major = 0, minor = 0;
+        if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor))
+        {
+            PXL_LOG_WARN(LogArea::OpenGL, "Failed to initialize an EGL display");
+            return false;
+        }
+
+        m_EGLDisplay = display;
+
+        const char* extensions = eglQueryString(display, EGL_EXTENSIONS);
+        if (!extensions || !strstr(extensions, "EGL_KHR_surfaceless_context"))
+        {
+            PXL_LOG_WARN(LogArea::OpenGL, "EGL display doesn't support surfaceless contexts");
+            return false;
+        }
+
+        if (!eglBindAPI(EGL_OPENGL_API))
+        {
+            PXL_LOG_WARN(LogArea::OpenGL, "EGL display doesn't support desktop OpenGL");
+            return false;
+        }
+
+        // Surfaceless displays only expose pbuffer configs, but no pbuffer is ever created
+        const EGLint configAttributes[] = {
+            EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+            EGL_NONE,
+        };
+
+        EGLConfig config = nullptr;
+        EGLint configCount = 0;
+        if (!eglChooseConfig(display, configAttributes, &config, 1, &configCount) || configCount == 0)
+        {
+            PXL_LOG_WARN(LogArea::OpenGL, "Failed to find an EGL config for OpenGL");
+            return false;
+        }
+
+        // Same version and profile as window contexts
+        const EGLint contextAttributes[] = {
+            EGL_CONTEXT_MAJOR_VERSION, 4,
+            EGL_CONTEXT_MINOR_VERSION, 6,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+#if PXL_DEBUG
+            EGL_CONTEXT_OPENGL_DEBUG, EGL_TRUE,
+#endif
+            EGL_NONE,
+        };
+
+        m_EGLContext = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttributes);
+
+        if (m_EGLContext == EGL_NO_CONTEXT)
+        {
+            PXL_LOG_WARN(LogArea::OpenGL, "Failed to create an EGL OpenGL 4.6 context");
+            m_EGLContext = nullptr;
+            return false;
+        }
+
+        SetAsCurrent();
+        LoadGL((GLADloadproc)eglGetProcAddress);
+
+        PXL_LOG_INFO(LogArea::OpenGL, "Created surfaceless EGL {}.{} context", major, minor);
+
+        return true;
+#else
+        return false;
+#endif
     }
 
-    void OpenGLGraphicsContext::SetVSync(bool value)
+    void OpenGLGraphicsContext::CreateHiddenWindowContext()
     {
-        value ? glfwSwapInterval(1) : glfwSwapInterval(0);
-        m_VSync = value;
+        PXL_LOG_INFO(LogArea::OpenGL, "Using a hidden window for the headless OpenGL context");
+
+        // NOTE: Harmless if GLFW has already been initialized by Window::Init
+        if (!glfwInit())
+        {
+            PXL_LOG_ERROR(LogArea::OpenGL, "Failed to initialize GLFW for the headless OpenGL context");
+            return;
+        }
+
+        glfwDefaultWindowHints();
+#if PXL_DEBUG
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GLFW_TRUE);
+#endif
+        glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_API);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+        // Everything is drawn into framebuffers, so the window's own framebuffer is never used
+        m_GLFWWindowHandle = glfwCreateWindow(1, 1, "pxl headless", nullptr, nullptr);
+        m_OwnsWindow = true;
+
+        PXL_ASSERT_MSG(m_GLFWWindowHandle, "Failed to create a hidden window for the headless OpenGL context");
+
+        SetAsCurrent();
+        LoadGL((GLADloadproc)glfwGetProcAddress);
     }
 
-    void OpenGLGraphicsContext::SetAsCurrent()
+    void OpenGLGraphicsContext::WaitForPreviousFrame()
     {
-        glfwMakeContextCurrent(m_GLFWWindowHandle);
+        PXL_PROFILE_SCOPE;
+
+        // OpenGL has no frame fences, but glFinish blocks until every command (including the last swap) is complete
+        glFinish();
     }
 
     RendererLimits OpenGLGraphicsContext::GetLimits()
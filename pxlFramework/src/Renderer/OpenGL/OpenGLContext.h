@@ -1,7 +1,10 @@
 #pragma once
+#include <glad/glad.h>
+
 #include <GLFW/glfw3.h>
 
 #include "Core/Window.h"
+#include "OpenGLProgramCache.h"
 #include "Renderer/GraphicsContext.h"
 
 namespace pxl
@@ -10,7 +13,11 @@ namespace pxl
     {
     public:
         OpenGLGraphicsContext(const std::shared_ptr<Window>& window);
-        virtual ~OpenGLGraphicsContext() override = default;
+
+        // Creates a context without a window. Uses a surfaceless EGL context where EGL is available (Linux), and a hidden window otherwise
+        OpenGLGraphicsContext();
+
+        virtual ~OpenGLGraphicsContext() override;
 
         virtual void Present() override;
 
@@ -20,6 +27,8 @@ namespace pxl
 
         virtual void SetAsCurrent() override;
 
+        virtual void WaitForPreviousFrame() override;
+
         virtual std::shared_ptr<GraphicsDevice> GetDevice() const override
         {
             PXL_LOG_ERROR(LogArea::OpenGL, "OpenGLContexts don't have devices, returning nullptr");
@@ -28,8 +37,29 @@ namespace pxl
 
         virtual RendererLimits GetLimits() override;
 
+        bool IsHeadless() const { return m_Headless; }
+
+        const OpenGLProgramCache& GetProgramCache() const { return *m_ProgramCache; }
+
+    private:
+        void LoadGL(GLADloadproc loader);
+
+        bool CreateSurfacelessContext();
+        void CreateHiddenWindowContext();
+
     private:
         GLFWwindow* m_GLFWWindowHandle = nullptr;
         bool m_VSync = true;
+
+        // Created once GL is loaded, since the cache keys on this context's driver strings
+        std::unique_ptr<OpenGLProgramCache> m_ProgramCache;
+
+        // Headless contexts have nothing to present to
+        bool m_Headless = false;
+        bool m_OwnsWindow = false;
+
+        // EGLDisplay and EGLContext, kept opaque so EGL headers aren't needed outside of the context
+        void* m_EGLDisplay = nullptr;
+        void* m_EGLContext = nullptr;
     };
 }
\ No newline at end of file
@@ -0,0 +1,104 @@
+#include "OpenGLFrameReadback.h"
+
+namespace pxl
+{
+    OpenGLFrameReadbackPool::OpenGLFrameReadbackPool(uint32_t bufferCount)
+        : FrameReadbackPool(bufferCount)
+    {
+        m_Buffers.resize(bufferCount);
+    }
+
+    OpenGLFrameReadbackPool::~OpenGLFrameReadbackPool()
+    {
+        for (auto& buffer : m_Buffers)
+        {
+            if (buffer.Fence)
+                glDeleteSync(buffer.Fence);
+
+            if (buffer.RendererID)
+            {
+                glUnmapNamedBuffer(buffer.RendererID);
+                glDeleteBuffers(1, &buffer.RendererID);
+            }
+        }
+    }
+
+    void OpenGLFrameReadbackPool::CopyFrame(GLuint framebuffer, Size2D size)
+    {
+        PXL_PROFILE_SCOPE;
+
+        auto index = TakeQueuedBuffer();
+
+        if (!index)
+            return;
+
+        auto& buffer = m_Buffers[*index];
+        Reserve(buffer, static_cast<size_t>(size.Width) * size.Height * 4);
+
+        GLint previousPackAlignment = 4;
+        glGetIntegerv(GL_PACK_ALIGNMENT, &previousPackAlignment);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+        // With a pack buffer bound, glReadPixels only queues the copy instead of waiting for the frame to finish
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer.RendererID);
+        glReadPixels(0, 0, static_cast<GLsizei>(size.Width), static_cast<GLsizei>(size.Height), GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        glPixelStorei(GL_PACK_ALIGNMENT, previousPackAlignment);
+
+        // The mapping is coherent, so once the fence has signalled the pixels are visible without a barrier
+        buffer.Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        // Headless contexts never swap buffers, so the fence has to be flushed here or it may never signal
+        glFlush();
+
+        // glReadPixels returns rows bottom to top, which is already the order images are kept in
+        m_Copies[*index] = { static_cast<const uint8_t*>(buffer.MappedData), size, ReadbackPixelFormat::RGBA8, false };
+    }
+
+    bool OpenGLFrameReadbackPool::IsCopyFinished(uint32_t index)
+    {
+        auto& buffer = m_Buffers[index];
+
+        if (!buffer.Fence)
+            return true;
+
+        // A timeout of 0 only checks the fence. It was flushed when the copy was queued, so it will signal without GL_SYNC_FLUSH_COMMANDS_BIT
+        auto result = glClientWaitSync(buffer.Fence, 0, 0);
+
+        if (result == GL_TIMEOUT_EXPIRED)
+            return false;
+
+        if (result == GL_WAIT_FAILED)
+            PXL_LOG_ERROR(LogArea::OpenGL, "Failed to check frame readback fence");
+
+        glDeleteSync(buffer.Fence);
+        buffer.Fence = nullptr;
+
+        return true;
+    }
+
+    void OpenGLFrameReadbackPool::Reserve(PackBuffer& buffer, size_t size)
+    {
+        if (buffer.Capacity >= size)
+            return;
+
+        if (buffer.RendererID)
+        {
+            glUnmapNamedBuffer(buffer.RendererID);
+            glDeleteBuffers(1, &buffer.RendererID);
+        }
+
+        // Immutable storage can stay mapped while the GPU writes into it
+        constexpr GLbitfield flags = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+        glCreateBuffers(1, &buffer.RendererID);
+        glNamedBufferStorage(buffer.RendererID, static_cast<GLsizeiptr>(size), nullptr, flags);
+        buffer.MappedData = glMapNamedBufferRange(buffer.RendererID, 0, static_cast<GLsizeiptr>(size), flags);
+        buffer.Capacity = size;
+
+        if (!buffer.MappedData)
+            PXL_LOG_ERROR(LogArea::OpenGL, "Failed to map frame readback buffer");
+    }
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <glad/glad.h>
+
+#include "Renderer/FrameReadback.h"
+
+namespace pxl
+{
+    /// @brief Reads frames back into persistently mapped pixel pack buffers. glReadPixels into a bound PBO returns straight away,
+    /// and the copy is fenced so the pixels are only handed out once glClientWaitSync says the GPU has written them
+    class OpenGLFrameReadbackPool : public FrameReadbackPool
+    {
+    public:
+        OpenGLFrameReadbackPool(uint32_t bufferCount);
+        virtual ~OpenGLFrameReadbackPool() override;
+
+        // Copies the framebuffer (0 for the window) into the queued buffer, if there is one. Called at the end of the frame
+        void CopyFrame(GLuint framebuffer, Size2D size);
+
+    protected:
+        virtual bool IsCopyFinished(uint32_t buffer) override;
+
+    private:
+        struct PackBuffer
+        {
+            GLuint RendererID = 0;
+            GLsync Fence = nullptr;
+            void* MappedData = nullptr;
+            size_t Capacity = 0;
+        };
+
+        // Recreates the buffer if the frame has grown since it was last used
+        void Reserve(PackBuffer& buffer, size_t size);
+
+    private:
+        std::vector<PackBuffer> m_Buffers;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include "OpenGLFramebuffer.h"
+
+namespace pxl
+{
+    OpenGLFramebuffer::OpenGLFramebuffer(const FramebufferSpecs& specs)
+        : m_Specs(specs)
+    {
+        Create();
+    }
+
+    OpenGLFramebuffer::~OpenGLFramebuffer()
+    {
+        Destroy();
+    }
+
+    void OpenGLFramebuffer::Resize(uint32_t width, uint32_t height)
+    {
+        if (width == 0 || height == 0)
+        {
+            PXL_LOG_WARN(LogArea::OpenGL, "Can't resize framebuffer to {}x{}", width, height);
+            return;
+        }
+
+        m_Specs.Size = { width, height };
+
+        Destroy();
+        Create();
+    }
+
+    std::shared_ptr<Image> OpenGLFramebuffer::ReadPixels()
+    {
+        PXL_PROFILE_SCOPE;
+
+        auto width = static_cast<size_t>(m_Specs.Size.Width);
+        auto height = static_cast<size_t>(m_Specs.Size.Height);
+
+        std::vector<uint8_t> pixels(width * height * 4);
+
+        // glReadPixels waits for every command drawing into the framebuffer to finish.
+        // It returns rows bottom to top, which is already the order images are kept in
+        GLint previousPackAlignment = 4;
+        glGetIntegerv(GL_PACK_ALIGNMENT, &previousPackAlignment);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+        glNamedFramebufferReadBuffer(m_RendererID, GL_COLOR_ATTACHMENT0);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, m_RendererID);
+        glReadPixels(0, 0, static_cast<GLsizei>(width), static_cast<GLsizei>(height), GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+
+        glPixelStorei(GL_PACK_ALIGNMENT, previousPackAlignment);
+
+        return std::make_shared<Image>(std::move(pixels), m_Specs.Size, ImageFormat::RGBA8);
+    }
+
+    void OpenGLFramebuffer::Bind()
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
+    }
+
+    void OpenGLFramebuffer::Create()
+    {
+        auto width = static_cast<GLsizei>(m_Specs.Size.Width);
+        auto height = static_cast<GLsizei>(m_Specs.Size.Height);
+
+        glCreateFramebuffers(1, &m_RendererID);
+
+        // Colour attachment
+        glCreateTextures(GL_TEXTURE_2D, 1, &m_ColourTexture);
+        glTextureStorage2D(m_ColourTexture, 1, GL_RGBA8, width, height);
+        glTextureParameteri(m_ColourTexture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTextureParameteri(m_ColourTexture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTextureParameteri(m_ColourTexture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(m_ColourTexture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glNamedFramebufferTexture(m_RendererID, GL_COLOR_ATTACHMENT0, m_ColourTexture, 0);
+
+        // Depth attachment, it's never sampled so a renderbuffer is enough
+        if (m_Specs.DepthAttachment)
+        {
+            glCreateRenderbuffers(1, &m_DepthRenderbuffer);
+            glNamedRenderbufferStorage(m_DepthRenderbuffer, GL_DEPTH24_STENCIL8, width, height);
+            glNamedFramebufferRenderbuffer(m_RendererID, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, m_DepthRenderbuffer);
+        }
+
+        auto status = glCheckNamedFramebufferStatus(m_RendererID, GL_FRAMEBUFFER);
+
+        if (status != GL_FRAMEBUFFER_COMPLETE)
+            PXL_LOG_ERROR(LogArea::OpenGL, "Framebuffer is incomplete (status: {:#x})", status);
+    }
+
+    void OpenGLFramebuffer::Destroy()
+    {
+        if (m_DepthRenderbuffer)
+        {
+            glDeleteRenderbuffers(1, &m_DepthRenderbuffer);
+            m_DepthRenderbuffer = 0;
+        }
+
+        glDeleteTextures(1, &m_ColourTexture);
+        glDeleteFramebuffers(1, &m_RendererID);
+        m_ColourTexture = 0;
+        m_RendererID = 0;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <glad/glad.h>
+
+#include "Renderer/Framebuffer.h"
+
+namespace pxl
+{
+    // A framebuffer object with a texture colour attachment and a renderbuffer depth attachment
+    class OpenGLFramebuffer : public Framebuffer
+    {
+    public:
+        OpenGLFramebuffer(const FramebufferSpecs& specs);
+        virtual ~OpenGLFramebuffer() override;
+
+        virtual void Resize(uint32_t width, uint32_t height) override;
+
+        virtual const FramebufferSpecs& GetSpecs() const override { return m_Specs; }
+
+        virtual std::shared_ptr<Image> ReadPixels() override;
+
+        void Bind();
+
+        GLuint GetID() const { return m_RendererID; }
+        GLuint GetColourTexture() const { return m_ColourTexture; }
+
+    private:
+        void Create();
+        void Destroy();
+
+    private:
+        FramebufferSpecs m_Specs;
+
+        GLuint m_RendererID = 0;
+        GLuint m_ColourTexture = 0;
+        GLuint m_DepthRenderbuffer = 0;
+    };
+}
\ No newline at end of file
@@ -2,6 +2,10 @@
 
 #include <glad/glad.h>
 
+#include "OpenGLContext.h"
+#include "OpenGLProgramCache.h"
+#include "Renderer/Renderer.h"
+
 namespace pxl
 {
     OpenGLGraphicsPipeline::OpenGLGraphicsPipeline(const GraphicsPipelineSpecs& specs)
@@ -12,9 +16,29 @@ namespace pxl
             PXL_LOG_ERROR(LogArea::OpenGL, "OpenGL pipelines require at least a vertex AND fragment shader");
         }
 
+        auto vertexShader = static_pointer_cast<OpenGLShader>(m_Shaders.at(ShaderStage::Vertex));
+        auto fragmentShader = static_pointer_cast<OpenGLShader>(m_Shaders.at(ShaderStage::Fragment));
+
+        const auto& programCache = static_pointer_cast<OpenGLGraphicsContext>(Renderer::GetGraphicsContext())->GetProgramCache();
+
+        bool useProgramCache = programCache.IsAvailable();
+        uint64_t cacheKey = 0;
+
+        if (useProgramCache)
+        {
+            cacheKey = programCache.GetKey({ vertexShader->GetSourceHash(), fragmentShader->GetSourceHash() });
+
+            // Skip compiling and linking entirely if the driver accepts the cached binary
+            if (LoadProgramBinary(programCache, cacheKey))
+                return;
+        }
+
         m_ShaderProgramID = glCreateProgram();
-        auto vertexShaderID = static_pointer_cast<OpenGLShader>(m_Shaders.at(ShaderStage::Vertex))->GetID();
-        auto fragmentShaderID = static_pointer_cast<OpenGLShader>(m_Shaders.at(ShaderStage::Fragment))->GetID();
+        auto vertexShaderID = vertexShader->GetID();
+        auto fragmentShaderID = fragmentShader->GetID();
+
+        if (useProgramCache)
+            glProgramParameteri(m_ShaderProgramID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
 
         // Attach our shaders to our program
         glAttachShader(m_ShaderProgramID, vertexShaderID);
@@ -50,6 +74,55 @@ namespace pxl
         // Always detach shaders after a successful link.
         glDetachShader(m_ShaderProgramID, vertexShaderID);
         glDetachShader(m_ShaderProgramID, fragmentShaderID);
+
+        if (useProgramCache)
+            StoreProgramBinary(programCache, cacheKey);
+    }
+
+    bool OpenGLGraphicsPipeline::LoadProgramBinary(const OpenGLProgramCache& programCache, uint64_t cacheKey)
+    {
+        PXL_PROFILE_SCOPE;
+
+        auto binary = programCache.Load(cacheKey);
+
+        if (!binary.has_value())
+            return false;
+
+        m_ShaderProgramID = glCreateProgram();
+        glProgramBinary(m_ShaderProgramID, binary->Format, binary->Data.data(), static_cast<GLsizei>(binary->Data.size()));
+
+        // Drivers reject binaries after driver updates or from other hardware, so this isn't an error
+        GLint isLinked = 0;
+        glGetProgramiv(m_ShaderProgramID, GL_LINK_STATUS, &isLinked);
+
+        if (isLinked == GL_FALSE)
+        {
+            PXL_LOG_INFO(LogArea::OpenGL, "Driver rejected cached program binary ({:016x}), recompiling", cacheKey);
+            glDeleteProgram(m_ShaderProgramID);
+            m_ShaderProgramID = 0;
+            return false;
+        }
+
+        PXL_LOG_INFO(LogArea::OpenGL, "Loaded program from binary cache ({:016x})", cacheKey);
+
+        return true;
+    }
+
+    void OpenGLGraphicsPipeline::StoreProgramBinary(const OpenGLProgramCache& programCache, uint64_t cacheKey)
+    {
+        PXL_PROFILE_SCOPE;
+
+        GLint binaryLength = 0;
+        glGetProgramiv(m_ShaderProgramID, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+
+        if (binaryLength <= 0)
+            return;
+
+        OpenGLProgramBinary binary;
+        binary.Data.resize(binaryLength);
+        glGetProgramBinary(m_ShaderProgramID, binaryLength, nullptr, &binary.Format, binary.Data.data());
+
+        programCache.Store(cacheKey, binary);
     }
 
     void OpenGLGraphicsPipeline::Bind()
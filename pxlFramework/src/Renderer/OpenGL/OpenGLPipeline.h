@@ -2,6 +2,7 @@
 
 #include <glad/glad.h>
 
+#include "OpenGLProgramCache.h"
 #include "OpenGLShader.h"
 #include "Renderer/Pipeline.h"
 
@@ -29,6 +30,10 @@ namespace pxl
         virtual void SetSpecs(const GraphicsPipelineSpecs& specs) { m_Specs = specs; }
 
     private:
+        // Tries to create the program from a cached binary, returns false if there was none or the driver rejected it
+        bool LoadProgramBinary(const OpenGLProgramCache& programCache, uint64_t cacheKey);
+        void StoreProgramBinary(const OpenGLProgramCache& programCache, uint64_t cacheKey);
+
         int GetUniformLocation(const std::string& name) const;
 
         GLenum ToGLCullMode(CullMode mode);
@@ -0,0 +1,106 @@
+#include "OpenGLProgramCache.h"
+
+#include <fstream>
+
+#include "Core/Config.h"
+#include "Utils/Hash.h"
+
+namespace pxl
+{
+    // Identifies pxl program binary files, followed by the binary format and the binary itself
+    static constexpr uint32_t k_ProgramCacheMagic = 0x4C475850; // 'PXGL'
+
+    OpenGLProgramCache::OpenGLProgramCache()
+    {
+        auto vendor = reinterpret_cast<const char*>(glGetString(GL_VENDOR));
+        auto renderer = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+        auto version = reinterpret_cast<const char*>(glGetString(GL_VERSION));
+
+        m_DriverHash = Hash::FNV1a(vendor ? vendor : "");
+        m_DriverHash = Hash::FNV1a(renderer ? renderer : "", m_DriverHash);
+        m_DriverHash = Hash::FNV1a(version ? version : "", m_DriverHash);
+
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &m_FormatCount);
+    }
+
+    uint64_t OpenGLProgramCache::GetKey(const std::vector<uint64_t>& shaderHashes) const
+    {
+        uint64_t key = m_DriverHash;
+        for (auto shaderHash : shaderHashes)
+            key = Hash::FNV1aValue(shaderHash, key);
+
+        return key;
+    }
+
+    std::optional<OpenGLProgramBinary> OpenGLProgramCache::Load(uint64_t key) const
+    {
+        PXL_PROFILE_SCOPE;
+
+        std::ifstream file(GetFilePath(key), std::ios::ate | std::ios::binary);
+
+        if (!file.is_open())
+            return std::nullopt;
+
+        size_t fileSize = static_cast<size_t>(file.tellg());
+        size_t headerSize = sizeof(uint32_t) + sizeof(GLenum);
+
+        if (fileSize <= headerSize)
+            return std::nullopt;
+
+        file.seekg(0);
+
+        uint32_t magic = 0;
+        OpenGLProgramBinary binary;
+        file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+        file.read(reinterpret_cast<char*>(&binary.Format), sizeof(binary.Format));
+
+        if (magic != k_ProgramCacheMagic)
+            return std::nullopt;
+
+        binary.Data.resize(fileSize - headerSize);
+        file.read(reinterpret_cast<char*>(binary.Data.data()), binary.Data.size());
+
+        if (!file)
+            return std::nullopt;
+
+        return binary;
+    }
+
+    void OpenGLProgramCache::Store(uint64_t key, const OpenGLProgramBinary& binary) const
+    {
+        PXL_PROFILE_SCOPE;
+
+        auto path = GetFilePath(key);
+
+        std::error_code error;
+        std::filesystem::create_directories(path.parent_path(), error);
+
+        // Write to a temporary file first so a crash mid-write never leaves a truncated binary behind
+        auto tempPath = path;
+        tempPath += ".tmp";
+
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+
+            if (!file.is_open())
+            {
+                PXL_LOG_WARN(LogArea::OpenGL, "Failed to write program binary to cache '{}'", tempPath.string());
+                return;
+            }
+
+            file.write(reinterpret_cast<const char*>(&k_ProgramCacheMagic), sizeof(k_ProgramCacheMagic));
+            file.write(reinterpret_cast<const char*>(&binary.Format), sizeof(binary.Format));
+            file.write(reinterpret_cast<const char*>(binary.Data.data()), binary.Data.size());
+        }
+
+        std::filesystem::rename(tempPath, path, error);
+
+        if (error)
+            PXL_LOG_WARN(LogArea::OpenGL, "Failed to move program binary into cache '{}': {}", path.string(), error.message());
+    }
+
+    std::filesystem::path OpenGLProgramCache::GetFilePath(uint64_t key)
+    {
+        return FrameworkConfig::GetCacheDirectory() / "programs" / std::format("{:016x}.bin", key);
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <glad/glad.h>
+
+namespace pxl
+{
+    struct OpenGLProgramBinary
+    {
+        GLenum Format = 0;
+        std::vector<uint8_t> Data;
+    };
+
+    /// @brief An on-disk cache of linked program binaries, retrieved with glGetProgramBinary.
+    /// Binaries are keyed by the shader source hashes and the driver (GL_VENDOR, GL_RENDERER and GL_VERSION),
+    /// since drivers only accept binaries they produced themselves. Each context owns its own cache, so the
+    /// driver strings are queried from whichever context is current when the cache is created.
+    class OpenGLProgramCache
+    {
+    public:
+        OpenGLProgramCache();
+
+        uint64_t GetKey(const std::vector<uint64_t>& shaderHashes) const;
+
+        // Returns the cached binary for the key, or nullopt on a cache miss
+        std::optional<OpenGLProgramBinary> Load(uint64_t key) const;
+        void Store(uint64_t key, const OpenGLProgramBinary& binary) const;
+
+        // Caching is only used if enabled and the driver supports at least one program binary format
+        bool IsAvailable() const { return s_Enabled && m_FormatCount > 0; }
+
+        static bool IsEnabled() { return s_Enabled; }
+        static void SetEnabled(bool value) { s_Enabled = value; }
+
+    private:
+        static std::filesystem::path GetFilePath(uint64_t key);
+
+    private:
+        uint64_t m_DriverHash = 0;
+        GLint m_FormatCount = 0;
+
+    private:
+        static inline bool s_Enabled = true;
+    };
+}
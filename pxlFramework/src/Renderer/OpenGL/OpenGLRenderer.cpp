@@ -12,6 +12,53 @@ namespace pxl
         glEnable(GL_BLEND);
         glEnable(GL_SCISSOR_TEST);
         glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+        for (auto& set : m_TimerSets)
+            glGenQueries(static_cast<GLsizei>(set.Queries.size()), set.Queries.data());
+    }
+
+    OpenGLRenderer::~OpenGLRenderer()
+    {
+        for (auto& set : m_TimerSets)
+            glDeleteQueries(static_cast<GLsizei>(set.Queries.size()), set.Queries.data());
+    }
+
+    void OpenGLRenderer::BeginFrame()
+    {
+        m_CurrentTimerSet = (m_CurrentTimerSet + 1) % k_TimerQueryLatency;
+
+        auto& set = m_TimerSets[m_CurrentTimerSet];
+
+        // These queries were issued k_TimerQueryLatency frames ago
+        ResolveTimerQueries(set);
+
+        set.UsedCount = 0;
+        glQueryCounter(set.Queries[0], GL_TIMESTAMP);
+    }
+
+    void OpenGLRenderer::EndFrame()
+    {
+        auto& set = m_TimerSets[m_CurrentTimerSet];
+
+        glQueryCounter(set.Queries[1], GL_TIMESTAMP);
+        set.Submitted = true;
+
+        // Copied after the frame's end timestamp so reading back doesn't count towards the GPU frame time
+        if (auto readbackPool = m_ReadbackPool.lock())
+        {
+            if (m_RenderTarget)
+            {
+                readbackPool->CopyFrame(m_RenderTarget->GetID(), m_RenderTarget->GetSpecs().Size);
+            }
+            else if (auto window = glfwGetCurrentContext())
+            {
+                int width = 0, height = 0;
+                glfwGetFramebufferSize(window, &width, &height);
+
+                if (width > 0 && height > 0)
+                    readbackPool->CopyFrame(0, Size2D(static_cast<uint32_t>(width), static_cast<uint32_t>(height)));
+            }
+        }
     }
 
     void OpenGLRenderer::Clear()
@@ -39,6 +86,31 @@ namespace pxl
         glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr);
     }
 
+    void OpenGLRenderer::SetRenderTarget(const std::shared_ptr<Framebuffer>& target)
+    {
+        m_RenderTarget = static_pointer_cast<OpenGLFramebuffer>(target);
+
+        if (!m_RenderTarget)
+        {
+            glBindFramebuffer(GL_FRAMEBUFFER, 0);
+            return;
+        }
+
+        m_RenderTarget->Bind();
+
+        // Surfaceless contexts have no default framebuffer, so the viewport starts out empty
+        auto size = m_RenderTarget->GetSpecs().Size;
+        SetViewport(0, 0, size.Width, size.Height);
+        SetScissor(0, 0, size.Width, size.Height);
+    }
+
+    std::shared_ptr<FrameReadbackPool> OpenGLRenderer::CreateReadbackPool(uint32_t bufferCount)
+    {
+        auto pool = std::make_shared<OpenGLFrameReadbackPool>(bufferCount);
+        m_ReadbackPool = pool;
+        return pool;
+    }
+
     void OpenGLRenderer::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
     {
         glViewport(x, y, width, height);
@@ -48,4 +120,67 @@ namespace pxl
     {
         glScissor(x, y, width, height);
     }
+
+    void OpenGLRenderer::BeginGPUTimer(GPUTimerSection section)
+    {
+        auto& set = m_TimerSets[m_CurrentTimerSet];
+
+        // Timers past the end of the set are just not measured
+        if (set.UsedCount >= k_MaxGPUTimersPerFrame)
+        {
+            m_ActiveTimer.reset();
+            return;
+        }
+
+        uint32_t timer = set.UsedCount++;
+        set.Sections[timer] = section;
+        glQueryCounter(set.Queries[(timer + 1) * 2], GL_TIMESTAMP);
+
+        m_ActiveTimer = timer;
+    }
+
+    void OpenGLRenderer::EndGPUTimer()
+    {
+        if (!m_ActiveTimer)
+            return;
+
+        glQueryCounter(m_TimerSets[m_CurrentTimerSet].Queries[(*m_ActiveTimer + 1) * 2 + 1], GL_TIMESTAMP);
+
+        m_ActiveTimer.reset();
+    }
+
+    void OpenGLRenderer::ResolveTimerQueries(TimerQuerySet& set)
+    {
+        PXL_PROFILE_SCOPE;
+
+        if (!set.Submitted)
+            return;
+
+        set.Submitted = false;
+
+        // The frame end query is issued last, so once it's available the rest are too.
+        // If the GPU is still that far behind, drop this frame's results rather than stalling
+        GLint available = GL_FALSE;
+        glGetQueryObjectiv(set.Queries[1], GL_QUERY_RESULT_AVAILABLE, &available);
+
+        if (!available)
+            return;
+
+        auto toMilliseconds = [&](uint32_t beginQuery)
+        {
+            GLuint64 begin = 0, end = 0;
+            glGetQueryObjectui64v(set.Queries[beginQuery], GL_QUERY_RESULT, &begin);
+            glGetQueryObjectui64v(set.Queries[beginQuery + 1], GL_QUERY_RESULT, &end);
+            return static_cast<float>(static_cast<double>(end - begin) / 1'000'000.0);
+        };
+
+        GPUTimings timings;
+        timings.FrameTime = toMilliseconds(0);
+
+        for (uint32_t i = 0; i < set.UsedCount; i++)
+            timings.SectionTimes[static_cast<size_t>(set.Sections[i])] += toMilliseconds((i + 1) * 2);
+
+        timings.Sequence = m_GPUTimings.Sequence + 1;
+        m_GPUTimings = timings;
+    }
 }
\ No newline at end of file
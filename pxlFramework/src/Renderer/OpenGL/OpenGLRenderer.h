@@ -1,6 +1,10 @@
 #pragma once
 
+#include <glad/glad.h>
+
 #include "Core/Window.h"
+#include "OpenGLFrameReadback.h"
+#include "OpenGLFramebuffer.h"
 #include "Renderer/RendererAPI.h"
 
 namespace pxl
@@ -9,9 +13,10 @@ namespace pxl
     {
     public:
         OpenGLRenderer();
+        virtual ~OpenGLRenderer() override;
 
-        virtual void BeginFrame() override {};
-        virtual void EndFrame() override {};
+        virtual void BeginFrame() override;
+        virtual void EndFrame() override;
 
         virtual void Clear() override;
         virtual void SetClearColour(const glm::vec4& colour) override;
@@ -23,7 +28,39 @@ namespace pxl
         virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
         virtual void SetScissor(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
 
+        virtual void BeginGPUTimer(GPUTimerSection section) override;
+        virtual void EndGPUTimer() override;
+        virtual GPUTimings GetGPUTimings() const override { return m_GPUTimings; }
+
+        virtual void SetRenderTarget(const std::shared_ptr<Framebuffer>& target) override;
+
+        virtual std::shared_ptr<FrameReadbackPool> CreateReadbackPool(uint32_t bufferCount) override;
+
+    private:
+        // GL_TIMESTAMP queries for one frame. Queries 0 and 1 time the whole frame, then each timer uses a begin and end query after that
+        struct TimerQuerySet
+        {
+            std::array<GLuint, (k_MaxGPUTimersPerFrame + 1) * 2> Queries = {};
+            std::array<GPUTimerSection, k_MaxGPUTimersPerFrame> Sections = {};
+            uint32_t UsedCount = 0;
+            bool Submitted = false;
+        };
+
+        void ResolveTimerQueries(TimerQuerySet& set);
+
     private:
         bool m_ScissorEnabled = false;
+
+        std::shared_ptr<OpenGLFramebuffer> m_RenderTarget = nullptr;
+
+        std::weak_ptr<OpenGLFrameReadbackPool> m_ReadbackPool;
+
+        // Results are read a few frames after they were issued so reading them never stalls the pipeline
+        static constexpr uint32_t k_TimerQueryLatency = 3;
+
+        std::array<TimerQuerySet, k_TimerQueryLatency> m_TimerSets;
+        uint32_t m_CurrentTimerSet = 0;
+        std::optional<uint32_t> m_ActiveTimer;
+        GPUTimings m_GPUTimings = {};
     };
 }
\ No newline at end of file
@@ -4,12 +4,25 @@
 
 #include <glm/gtc/type_ptr.hpp>
 
+#include "Utils/Hash.h"
+
 namespace pxl
 {
-    OpenGLShader::OpenGLShader(ShaderStage stage, const std::string& glslSrc)
-        : m_ShaderStage(stage)
+    OpenGLShader::OpenGLShader(ShaderStage stage, const std::string& glslSrc, const ShaderCompileOptions& options)
+        : m_ShaderStage(stage), m_Source(options.Defines.empty() ? glslSrc : InsertDefines(glslSrc, options))
+    {
+        m_SourceHash = Hash::FNV1aValue(m_ShaderStage, Hash::FNV1a(m_Source));
+    }
+
+    uint32_t OpenGLShader::GetID()
     {
-        Compile(glslSrc);
+        if (!m_Compiled)
+        {
+            Compile(m_Source);
+            m_Compiled = true;
+        }
+
+        return m_RendererID;
     }
 
     OpenGLShader::~OpenGLShader()
@@ -49,6 +62,7 @@ namespace pxl
 
             // We don't need the shader anymore.
             glDeleteShader(m_RendererID);
+            m_RendererID = 0;
 
             PXL_LOG_ERROR(LogArea::OpenGL, infoLog.data());
 
@@ -56,6 +70,24 @@ namespace pxl
         }
     }
 
+    std::string OpenGLShader::InsertDefines(const std::string& glslSrc, const ShaderCompileOptions& options)
+    {
+        std::string defines;
+        for (const auto& [name, value] : options.Defines)
+            defines += std::format("#define {} {}\n", name, value);
+
+        // Defines must come after the #version directive
+        auto versionPos = glslSrc.find("#version");
+        if (versionPos == std::string::npos)
+            return defines + glslSrc;
+
+        auto lineEnd = glslSrc.find('\n', versionPos);
+        if (lineEnd == std::string::npos)
+            return glslSrc + "\n" + defines;
+
+        return glslSrc.substr(0, lineEnd + 1) + defines + glslSrc.substr(lineEnd + 1);
+    }
+
     uint32_t OpenGLShader::ShaderStageToGLShaderStage(ShaderStage stage)
     {
         switch (stage)
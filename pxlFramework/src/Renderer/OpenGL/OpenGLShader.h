@@ -7,22 +7,33 @@ namespace pxl
     class OpenGLShader : public Shader
     {
     public:
-        OpenGLShader(ShaderStage stage, const std::string& glslSrc);
+        OpenGLShader(ShaderStage stage, const std::string& glslSrc, const ShaderCompileOptions& options = {});
         ~OpenGLShader();
 
         virtual void Reload() override;
 
         virtual ShaderStage GetShaderStage() const override { return m_ShaderStage; }
 
-        uint32_t GetID() const { return m_RendererID; }
+        // Gets the GL shader object, compiling it on first use
+        // NOTE: Compilation is deferred so pipelines loaded from the program binary cache never compile their shaders
+        uint32_t GetID();
+
+        // Hash of the final source code (including defines) and stage, used to key cached program binaries
+        uint64_t GetSourceHash() const { return m_SourceHash; }
 
     private:
         void Compile(const std::string& glslSrc);
 
+        static std::string InsertDefines(const std::string& glslSrc, const ShaderCompileOptions& options);
+
         static uint32_t ShaderStageToGLShaderStage(ShaderStage stage);
 
     private:
         uint32_t m_RendererID = 0;
         ShaderStage m_ShaderStage = ShaderStage::Vertex;
+
+        std::string m_Source;
+        uint64_t m_SourceHash = 0;
+        bool m_Compiled = false;
     };
 }
\ No newline at end of file
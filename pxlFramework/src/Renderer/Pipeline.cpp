@@ -1,5 +1,6 @@
 #include "Pipeline.h"
 
+#include "Null/NullPipeline.h"
 #include "OpenGL/OpenGLPipeline.h"
 #include "Renderer.h"
 #include "Vulkan/VulkanContext.h"
@@ -13,6 +14,7 @@ namespace pxl
         {
             case RendererAPIType::None:   PXL_LOG_ERROR(LogArea::Renderer, "Can't create Graphics Pipeline for no renderer api."); return nullptr;
             case RendererAPIType::OpenGL: return std::make_shared<OpenGLGraphicsPipeline>(specs);
+            case RendererAPIType::Null:   return std::make_shared<NullGraphicsPipeline>(specs);
             case RendererAPIType::Vulkan:
                 auto context = std::static_pointer_cast<VulkanGraphicsContext>(Renderer::GetGraphicsContext());
                 return std::make_shared<VulkanGraphicsPipeline>(specs, context->GetDefaultRenderPass());
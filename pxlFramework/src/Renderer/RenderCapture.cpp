@@ -0,0 +1,387 @@
+#include "RenderCapture.h"
+
+#include "Renderer.h"
+
+namespace pxl
+{
+    // Identifies pxl render capture files, followed by the format version and the API the capture was made with
+    static constexpr uint32_t k_RenderCaptureMagic = 0x43525850; // 'PXRC'
+    static constexpr uint32_t k_RenderCaptureVersion = 1;
+
+    // Each record in a capture starts with its type
+    enum class RenderCaptureRecord : uint8_t
+    {
+        Texture,
+        Mesh,
+        StaticGeometry,
+        BeginFrame,
+        Flush,
+        EndFrame,
+    };
+
+    template<typename T>
+    static void WriteValue(std::ofstream& file, const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    static void WriteVector(std::ofstream& file, const std::vector<T>& values)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        WriteValue(file, static_cast<uint32_t>(values.size()));
+        file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+    }
+
+    template<typename T>
+    static bool ReadValue(std::ifstream& file, T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+
+    template<typename T>
+    static bool ReadVector(std::ifstream& file, std::vector<T>& values)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        uint32_t count = 0;
+        if (!ReadValue(file, count))
+            return false;
+
+        // A corrupt count would otherwise allocate up to 4 billion elements before the read fails
+        auto position = file.tellg();
+        file.seekg(0, std::ios::end);
+        auto remaining = static_cast<uint64_t>(file.tellg() - position);
+        file.seekg(position);
+
+        if (!file || static_cast<uint64_t>(count) * sizeof(T) > remaining)
+            return false;
+
+        values.resize(count);
+        return static_cast<bool>(file.read(reinterpret_cast<char*>(values.data()), count * sizeof(T)));
+    }
+
+    bool RenderCapture::Begin(const std::filesystem::path& path, uint32_t frameCount)
+    {
+        std::lock_guard lock(s_Mutex);
+
+        if (s_Capturing)
+        {
+            PXL_LOG_WARN(LogArea::Renderer, "Can't begin render capture, a capture is already running");
+            return false;
+        }
+
+        std::error_code error;
+        if (path.has_parent_path())
+            std::filesystem::create_directories(path.parent_path(), error);
+
+        s_File.open(path, std::ios::binary | std::ios::trunc);
+
+        if (!s_File.is_open())
+        {
+            PXL_LOG_WARN(LogArea::Renderer, "Failed to open render capture file '{}'", path.string());
+            return false;
+        }
+
+        WriteValue(s_File, k_RenderCaptureMagic);
+        WriteValue(s_File, k_RenderCaptureVersion);
+        WriteValue(s_File, Renderer::GetCurrentAPI());
+
+        s_InFrame = false;
+        s_FramesRemaining = frameCount;
+        s_FramesCaptured = 0;
+        s_Capturing = true;
+
+        PXL_LOG_INFO(LogArea::Renderer, "Began render capture to '{}'", path.string());
+
+        return true;
+    }
+
+    void RenderCapture::End()
+    {
+        std::lock_guard lock(s_Mutex);
+
+        if (s_Capturing)
+            Close();
+    }
+
+    void RenderCapture::Close()
+    {
+        s_Capturing = false;
+        s_File.close();
+
+        s_TextureIDs.clear();
+        s_MeshIDs.clear();
+
+        PXL_LOG_INFO(LogArea::Renderer, "Finished render capture, {} frames were captured", s_FramesCaptured);
+    }
+
+    bool RenderCapture::OnBeginFrame(const glm::vec4& clearColour)
+    {
+        std::lock_guard lock(s_Mutex);
+
+        if (!s_Capturing)
+            return false;
+
+        WriteValue(s_File, RenderCaptureRecord::BeginFrame);
+        WriteValue(s_File, clearColour);
+
+        s_InFrame = true;
+
+        return s_FramesCaptured == 0;
+    }
+
+    void RenderCapture::OnEndFrame()
+    {
+        PXL_PROFILE_SCOPE;
+
+        std::lock_guard lock(s_Mutex);
+
+        // The capture may have begun part way through this frame
+        if (!s_Capturing || !s_InFrame)
+            return;
+
+        WriteValue(s_File, RenderCaptureRecord::EndFrame);
+
+        s_InFrame = false;
+        s_FramesCaptured++;
+
+        if (s_FramesRemaining > 0 && --s_FramesRemaining == 0)
+            Close();
+    }
+
+    void RenderCapture::OnFlush(const RenderCaptureFlush& flush)
+    {
+        PXL_PROFILE_SCOPE;
+
+        std::lock_guard lock(s_Mutex);
+
+        if (!s_Capturing || !s_InFrame)
+            return;
+
+        WriteValue(s_File, RenderCaptureRecord::Flush);
+        WriteValue(s_File, flush.ViewProjections);
+        WriteVector(s_File, flush.TextureUnits);
+        WriteVector(s_File, flush.QuadVertices);
+        WriteVector(s_File, flush.CubeVertices);
+        WriteVector(s_File, flush.LineVertices);
+        WriteVector(s_File, flush.MeshDraws);
+    }
+
+    void RenderCapture::OnStaticGeometry(const RenderCaptureStaticGeometry& geometry)
+    {
+        PXL_PROFILE_SCOPE;
+
+        std::lock_guard lock(s_Mutex);
+
+        if (!s_Capturing)
+            return;
+
+        WriteValue(s_File, RenderCaptureRecord::StaticGeometry);
+        WriteVector(s_File, geometry.QuadVertices);
+        WriteVector(s_File, geometry.QuadIndices);
+        WriteVector(s_File, geometry.CubeVertices);
+        WriteVector(s_File, geometry.CubeIndices);
+    }
+
+    uint32_t RenderCapture::GetTextureID(const std::shared_ptr<Texture>& texture)
+    {
+        std::lock_guard lock(s_Mutex);
+
+        auto it = s_TextureIDs.find(texture);
+        if (it != s_TextureIDs.end())
+            return it->second;
+
+        auto id = static_cast<uint32_t>(s_TextureIDs.size());
+        s_TextureIDs.emplace(texture, id);
+
+        // Only the metadata is written, null textures (ie. on Vulkan) are written with no size
+        WriteValue(s_File, RenderCaptureRecord::Texture);
+        WriteValue(s_File, texture ? texture->GetMetadata() : ImageMetadata());
+
+        return id;
+    }
+
+    uint32_t RenderCapture::GetMeshID(const std::shared_ptr<Mesh>& mesh)
+    {
+        std::lock_guard lock(s_Mutex);
+
+        auto it = s_MeshIDs.find(mesh);
+        if (it != s_MeshIDs.end())
+            return it->second;
+
+        auto id = static_cast<uint32_t>(s_MeshIDs.size());
+        s_MeshIDs.emplace(mesh, id);
+
+        WriteValue(s_File, RenderCaptureRecord::Mesh);
+        WriteVector(s_File, mesh->Vertices);
+        WriteVector(s_File, mesh->Indices);
+
+        return id;
+    }
+
+    std::optional<RenderCaptureFile> RenderCapture::Load(const std::filesystem::path& path)
+    {
+        PXL_PROFILE_SCOPE;
+
+        std::ifstream file(path, std::ios::binary);
+
+        if (!file.is_open())
+        {
+            PXL_LOG_WARN(LogArea::Renderer, "Failed to open render capture file '{}'", path.string());
+            return std::nullopt;
+        }
+
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        RenderCaptureFile capture;
+
+        if (!ReadValue(file, magic) || !ReadValue(file, version) || !ReadValue(file, capture.API) || magic != k_RenderCaptureMagic)
+        {
+            PXL_LOG_WARN(LogArea::Renderer, "'{}' isn't a render capture file", path.string());
+            return std::nullopt;
+        }
+
+        if (version != k_RenderCaptureVersion)
+        {
+            PXL_LOG_WARN(LogArea::Renderer, "Render capture '{}' is version {}, expected version {}", path.string(), version, k_RenderCaptureVersion);
+            return std::nullopt;
+        }
+
+        std::optional<RenderCaptureFrame> frame;
+        std::optional<uint32_t> staticGeometry;
+
+        RenderCaptureRecord record;
+        while (ReadValue(file, record))
+        {
+            bool valid = true;
+
+            switch (record)
+            {
+                case RenderCaptureRecord::Texture:
+                {
+                    valid = ReadValue(file, capture.Textures.emplace_back());
+                    break;
+                }
+                case RenderCaptureRecord::Mesh:
+                {
+                    std::vector<MeshVertex> vertices;
+                    std::vector<uint32_t> indices;
+                    valid = ReadVector(file, vertices) && ReadVector(file, indices);
+                    capture.Meshes.push_back(std::make_shared<Mesh>(vertices, indices));
+                    break;
+                }
+                case RenderCaptureRecord::StaticGeometry:
+                {
+                    auto& geometry = capture.StaticGeometry.emplace_back();
+                    valid = ReadVector(file, geometry.QuadVertices) && ReadVector(file, geometry.QuadIndices) && ReadVector(file, geometry.CubeVertices) && ReadVector(file, geometry.CubeIndices);
+
+                    staticGeometry = static_cast<uint32_t>(capture.StaticGeometry.size() - 1);
+
+                    // Static geometry uploaded during a frame is drawn from that frame's next flush, so treat it as drawn for the whole frame
+                    if (frame)
+                        frame->StaticGeometry = staticGeometry;
+                    break;
+                }
+                case RenderCaptureRecord::BeginFrame:
+                {
+                    frame.emplace();
+                    frame->StaticGeometry = staticGeometry;
+                    valid = ReadValue(file, frame->ClearColour);
+                    break;
+                }
+                case RenderCaptureRecord::Flush:
+                {
+                    if (!frame)
+                    {
+                        valid = false;
+                        break;
+                    }
+
+                    auto& flush = frame->Flushes.emplace_back();
+                    valid = ReadValue(file, flush.ViewProjections) && ReadVector(file, flush.TextureUnits) && ReadVector(file, flush.QuadVertices)
+                        && ReadVector(file, flush.CubeVertices) && ReadVector(file, flush.LineVertices) && ReadVector(file, flush.MeshDraws);
+                    break;
+                }
+                case RenderCaptureRecord::EndFrame:
+                {
+                    if (frame)
+                        capture.Frames.push_back(std::move(frame.value()));
+
+                    frame.reset();
+                    break;
+                }
+                default:
+                {
+                    valid = false;
+                    break;
+                }
+            }
+
+            if (!valid)
+            {
+                // Keep the complete frames, the capture may have been cut off while it was being written
+                PXL_LOG_WARN(LogArea::Renderer, "Render capture '{}' is truncated or corrupt, only the first {} frames were loaded", path.string(), capture.Frames.size());
+                break;
+            }
+        }
+
+        // Make sure every id a frame refers to exists, so replaying never has to check
+        for (const auto& capturedFrame : capture.Frames)
+        {
+            for (const auto& flush : capturedFrame.Flushes)
+            {
+                bool texturesValid = std::ranges::all_of(flush.TextureUnits, [&](uint32_t id) { return id < capture.Textures.size(); });
+                bool meshesValid = std::ranges::all_of(flush.MeshDraws, [&](const RenderCaptureMeshDraw& draw) { return draw.MeshID < capture.Meshes.size(); });
+
+                if (!texturesValid || !meshesValid)
+                {
+                    PXL_LOG_WARN(LogArea::Renderer, "Render capture '{}' refers to textures or meshes it doesn't contain", path.string());
+                    return std::nullopt;
+                }
+            }
+        }
+
+        PXL_LOG_INFO(LogArea::Renderer, "Loaded render capture '{}' ({} frames, {} textures, {} meshes)", path.string(), capture.Frames.size(), capture.Textures.size(), capture.Meshes.size());
+
+        return capture;
+    }
+
+    RenderCaptureReplayer::RenderCaptureReplayer(const std::shared_ptr<RenderCaptureFile>& capture)
+        : m_Capture(capture)
+    {
+        PXL_ASSERT(m_Capture);
+
+        // Placeholders are white so captured vertex colours come through unchanged
+        for (const auto& metadata : m_Capture->Textures)
+        {
+            Size2D size = { std::max(metadata.Size.Width, 1u), std::max(metadata.Size.Height, 1u) };
+            Image image(std::vector<uint8_t>(static_cast<size_t>(size.Width) * size.Height * 4, 255), size, ImageFormat::RGBA8);
+
+            m_Textures.push_back(Texture::Create(image, {}));
+        }
+    }
+
+    void RenderCaptureReplayer::PrepareFrame(size_t index)
+    {
+        const auto& frame = m_Capture->Frames.at(index);
+
+        Renderer::SetClearColour(frame.ClearColour);
+
+        if (frame.StaticGeometry != m_StaticGeometry)
+        {
+            Renderer::ReplayStaticGeometry(frame.StaticGeometry ? m_Capture->StaticGeometry[frame.StaticGeometry.value()] : RenderCaptureStaticGeometry());
+            m_StaticGeometry = frame.StaticGeometry;
+        }
+    }
+
+    void RenderCaptureReplayer::ReplayFrame(size_t index)
+    {
+        PXL_PROFILE_SCOPE;
+
+        for (const auto& flush : m_Capture->Frames.at(index).Flushes)
+            Renderer::ReplayFlush(flush, m_Textures, m_Capture->Meshes);
+    }
+}
\ No newline at end of file
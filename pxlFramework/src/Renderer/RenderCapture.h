@@ -0,0 +1,131 @@
+#pragma once
+
+#include <atomic>
+#include <fstream>
+
+#include <glm/mat4x4.hpp>
+
+#include "RendererAPIType.h"
+#include "RendererData.h"
+#include "Texture.h"
+#include "Vertices.h"
+
+namespace pxl
+{
+    struct RenderCaptureMeshDraw
+    {
+        uint32_t MeshID;
+        glm::mat4 Transform;
+    };
+
+    // Everything one renderer flush uploaded and drew. Vertices are stored exactly as they were uploaded
+    struct RenderCaptureFlush
+    {
+        // Camera matrices, indexed by RendererGeometryTarget
+        std::array<glm::mat4, 4> ViewProjections = {};
+
+        // Texture ids, in texture unit order
+        std::vector<uint32_t> TextureUnits;
+
+        std::vector<QuadVertex> QuadVertices;
+        std::vector<CubeVertex> CubeVertices;
+        std::vector<LineVertex> LineVertices;
+        std::vector<RenderCaptureMeshDraw> MeshDraws;
+    };
+
+    struct RenderCaptureStaticGeometry
+    {
+        std::vector<QuadVertex> QuadVertices;
+        std::vector<uint32_t> QuadIndices;
+        std::vector<CubeVertex> CubeVertices;
+        std::vector<uint32_t> CubeIndices;
+    };
+
+    struct RenderCaptureFrame
+    {
+        glm::vec4 ClearColour = glm::vec4(0.0f);
+
+        // The static geometry drawn with this frame, if any had been uploaded
+        std::optional<uint32_t> StaticGeometry;
+
+        std::vector<RenderCaptureFlush> Flushes;
+    };
+
+    // A loaded capture. Textures only keep their metadata, since only the binding pattern matters for benchmarking
+    struct RenderCaptureFile
+    {
+        RendererAPIType API = RendererAPIType::None;
+
+        std::vector<ImageMetadata> Textures;
+        std::vector<std::shared_ptr<Mesh>> Meshes;
+        std::vector<RenderCaptureStaticGeometry> StaticGeometry;
+        std::vector<RenderCaptureFrame> Frames;
+    };
+
+    /// @brief Records the renderer's command stream (camera matrices, texture bindings, vertex uploads and draws) to a compact binary file,
+    /// so the same frames can be replayed against each backend without the application that produced them.
+    /// Textures and meshes are written once, the first time they're used, and referred to by id afterwards
+    class RenderCapture
+    {
+    public:
+        // Starts capturing at the start of the next frame. A frame count of 0 captures until End() is called
+        static bool Begin(const std::filesystem::path& path, uint32_t frameCount = 0);
+        static void End();
+
+        static bool IsCapturing() { return s_Capturing.load(std::memory_order_relaxed); }
+
+        static std::optional<RenderCaptureFile> Load(const std::filesystem::path& path);
+
+    private:
+        friend class Renderer;
+
+        // Returns true if this is the first captured frame
+        static bool OnBeginFrame(const glm::vec4& clearColour);
+        static void OnEndFrame();
+
+        static void OnFlush(const RenderCaptureFlush& flush);
+        static void OnStaticGeometry(const RenderCaptureStaticGeometry& geometry);
+
+        // Returns the id of a texture or mesh, writing it to the capture the first time it's seen
+        static uint32_t GetTextureID(const std::shared_ptr<Texture>& texture);
+        static uint32_t GetMeshID(const std::shared_ptr<Mesh>& mesh);
+
+        static void Close();
+
+    private:
+        static inline std::atomic<bool> s_Capturing = false;
+
+        // Frames may be rendered on the render thread while the main thread starts or ends a capture
+        static inline std::mutex s_Mutex;
+
+        static inline std::ofstream s_File;
+        static inline bool s_InFrame = false;
+        static inline uint32_t s_FramesRemaining = 0;
+        static inline uint32_t s_FramesCaptured = 0;
+
+        // Keeps the captured textures and meshes alive so their ids can't be reused by another object at the same address
+        static inline std::unordered_map<std::shared_ptr<Texture>, uint32_t> s_TextureIDs;
+        static inline std::unordered_map<std::shared_ptr<Mesh>, uint32_t> s_MeshIDs;
+    };
+
+    /// @brief Plays a loaded capture back through the renderer, reusing the renderer's flush path so each backend does the same work it did when captured.
+    /// Textures are replaced by placeholder textures of the same size
+    class RenderCaptureReplayer
+    {
+    public:
+        RenderCaptureReplayer(const std::shared_ptr<RenderCaptureFile>& capture);
+
+        // Applies the frame's clear colour and static geometry, call before the renderer begins the frame (ie. from OnUpdate)
+        void PrepareFrame(size_t index);
+
+        // Draws the frame's flushes, call from OnRender
+        void ReplayFrame(size_t index);
+
+        size_t GetFrameCount() const { return m_Capture->Frames.size(); }
+
+    private:
+        std::shared_ptr<RenderCaptureFile> m_Capture = nullptr;
+        std::vector<std::shared_ptr<Texture>> m_Textures;
+        std::optional<uint32_t> m_StaticGeometry;
+    };
+}
\ No newline at end of file
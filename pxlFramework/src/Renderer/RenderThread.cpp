@@ -0,0 +1,231 @@
+#include "RenderThread.h"
+
+#include <GLFW/glfw3.h>
+
+#include <condition_variable>
+#include <deque>
+
+#include "Debug/GUI/GUI.h"
+#include "Renderer.h"
+
+namespace pxl
+{
+    static std::thread s_Thread;
+
+    // NOTE: Everything below is guarded by s_Mutex
+    static std::mutex s_Mutex;
+    static std::condition_variable s_Condition;
+
+    static std::vector<FramePacket> s_Packets;
+    static std::deque<uint32_t> s_FreePackets;
+    static std::deque<uint32_t> s_ReadyPackets;
+    static std::vector<std::function<void()>> s_Functions;
+
+    static uint32_t s_RecordingPacket = 0;
+    static uint64_t s_SubmittedPacketCount = 0;
+    static bool s_Busy = false;
+    static bool s_StopRequested = false;
+
+    bool RenderThread::Start(uint32_t packetCount)
+    {
+        PXL_PROFILE_SCOPE;
+
+        PXL_ASSERT_MSG(Renderer::IsInitialized(), "Renderer must be initialized before the render thread is started");
+
+        if (s_Running)
+            return true;
+
+        // ImGui's context isn't thread-safe, and its input callbacks run on the main thread while the frame would be built on the render thread
+        if (GUI::IsInitialized())
+        {
+            PXL_LOG_ERROR(LogArea::Renderer, "Can't start the render thread while the GUI is initialized");
+            return false;
+        }
+
+        packetCount = std::clamp(packetCount, 2u, 3u);
+
+        s_Packets = std::vector<FramePacket>(packetCount);
+        s_FreePackets.clear();
+        s_ReadyPackets.clear();
+
+        for (uint32_t i = 0; i < packetCount; i++)
+            s_FreePackets.push_back(i);
+
+        s_StopRequested = false;
+        s_Running = true;
+
+        // An OpenGL context can only be current on one thread at a time. Pipelines still compiling need it on this thread, so they're finished first
+        if (Renderer::GetCurrentAPI() == RendererAPIType::OpenGL)
+        {
+            Renderer::ResolvePipelineJobs(true);
+            glfwMakeContextCurrent(nullptr);
+        }
+
+        s_Thread = std::thread(&RenderThread::Run);
+
+        PXL_LOG_INFO(LogArea::Renderer, "Render thread started with {} frame packets", packetCount);
+
+        return true;
+    }
+
+    void RenderThread::Stop()
+    {
+        PXL_PROFILE_SCOPE;
+
+        if (!s_Running)
+            return;
+
+        {
+            std::lock_guard lock(s_Mutex);
+            s_StopRequested = true;
+        }
+
+        s_Condition.notify_all();
+
+        // The render thread finishes any packets and functions still queued before exiting
+        s_Thread.join();
+
+        s_Running = false;
+        s_Packets.clear();
+
+        if (Renderer::GetCurrentAPI() == RendererAPIType::OpenGL)
+            Renderer::GetGraphicsContext()->SetAsCurrent();
+
+        PXL_LOG_INFO(LogArea::Renderer, "Render thread stopped");
+    }
+
+    void RenderThread::Submit(const std::function<void()>& func)
+    {
+        if (!s_Running)
+        {
+            func();
+            return;
+        }
+
+        {
+            std::lock_guard lock(s_Mutex);
+            s_Functions.push_back(func);
+        }
+
+        s_Condition.notify_all();
+    }
+
+    void RenderThread::WaitIdle()
+    {
+        PXL_PROFILE_SCOPE;
+
+        if (!s_Running)
+            return;
+
+        std::unique_lock lock(s_Mutex);
+        s_Condition.wait(lock, []() { return s_ReadyPackets.empty() && s_Functions.empty() && !s_Busy; });
+    }
+
+    FramePacket& RenderThread::AcquirePacket()
+    {
+        PXL_PROFILE_SCOPE;
+
+        uint32_t index = 0;
+
+        {
+            // If every packet is in flight, simulation is ahead of the render thread and has to wait for it
+            PXL_PROFILE_SCOPE_NAMED("Wait for free frame packet");
+
+            std::unique_lock lock(s_Mutex);
+            s_Condition.wait(lock, []() { return !s_FreePackets.empty(); });
+
+            index = s_FreePackets.front();
+            s_FreePackets.pop_front();
+        }
+
+        s_RecordingPacket = index;
+
+        auto& packet = s_Packets[index];
+        packet.Reset();
+        packet.FrameIndex = s_SubmittedPacketCount;
+
+        Renderer::s_RecordingPacket = &packet;
+
+        return packet;
+    }
+
+    void RenderThread::SubmitPacket()
+    {
+        PXL_PROFILE_SCOPE;
+
+        auto& packet = s_Packets[s_RecordingPacket];
+
+        Renderer::CapturePacketCameras(packet);
+        Renderer::s_RecordingPacket = nullptr;
+
+        {
+            std::lock_guard lock(s_Mutex);
+            s_ReadyPackets.push_back(s_RecordingPacket);
+            s_SubmittedPacketCount++;
+        }
+
+        s_Condition.notify_all();
+    }
+
+    void RenderThread::Run()
+    {
+        PXL_PROFILE_THREAD("Render Thread");
+
+        if (Renderer::GetCurrentAPI() == RendererAPIType::OpenGL)
+            Renderer::GetGraphicsContext()->SetAsCurrent();
+
+        while (true)
+        {
+            std::vector<std::function<void()>> functions;
+            std::optional<uint32_t> packetIndex;
+
+            {
+                std::unique_lock lock(s_Mutex);
+                s_Condition.wait(lock, []() { return s_StopRequested || !s_ReadyPackets.empty() || !s_Functions.empty(); });
+
+                functions.swap(s_Functions);
+
+                if (!s_ReadyPackets.empty())
+                {
+                    packetIndex = s_ReadyPackets.front();
+                    s_ReadyPackets.pop_front();
+                }
+                else if (functions.empty())
+                {
+                    // Only reached once a stop was requested and there's nothing left to do
+                    break;
+                }
+
+                s_Busy = true;
+            }
+
+            for (const auto& function : functions)
+                function();
+
+            if (packetIndex)
+            {
+                PXL_PROFILE_SCOPE_NAMED("Render Frame Packet");
+
+                const auto& packet = s_Packets[*packetIndex];
+
+                Renderer::RenderPacket(packet);
+                Renderer::GetGraphicsContext()->Present();
+                Renderer::RecordInputLatency(packet.InputTimestamp);
+            }
+
+            {
+                std::lock_guard lock(s_Mutex);
+
+                if (packetIndex)
+                    s_FreePackets.push_back(*packetIndex);
+
+                s_Busy = false;
+            }
+
+            s_Condition.notify_all();
+        }
+
+        if (Renderer::GetCurrentAPI() == RendererAPIType::OpenGL)
+            glfwMakeContextCurrent(nullptr);
+    }
+}
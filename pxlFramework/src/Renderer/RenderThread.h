@@ -0,0 +1,42 @@
+#pragma once
+
+#include "FramePacket.h"
+
+namespace pxl
+{
+    /** @brief Runs the renderer on its own thread so simulating frame N overlaps submitting frame N-1.
+        While running, OnRender records into a FramePacket instead of talking to the graphics API directly,
+        and the render thread replays the previous packet and presents it.
+        NOTE: GPU resources (textures, static geometry, pipelines) should be created before starting, or through Submit()
+    */
+    class RenderThread
+    {
+    public:
+        // Starts the render thread with double (2) or triple (3) buffered frame packets.
+        // Returns false if the GUI is initialized, since ImGui would build frames on the render thread while the main thread feeds it input
+        static bool Start(uint32_t packetCount = 2);
+        static void Stop();
+
+        static bool IsRunning() { return s_Running; }
+
+        // Runs a function on the render thread before the next packet, or immediately if the render thread isn't running
+        static void Submit(const std::function<void()>& func);
+
+        // Blocks until every submitted packet and function has been processed
+        static void WaitIdle();
+
+    private:
+        friend class Application;
+
+        // Blocks until a packet is free, then directs Renderer calls on this thread into it
+        static FramePacket& AcquirePacket();
+
+        // Hands the packet from AcquirePacket() to the render thread
+        static void SubmitPacket();
+
+        static void Run();
+
+    private:
+        static inline bool s_Running = false;
+    };
+}
@@ -1,11 +1,16 @@
 #include "Renderer.h"
 
 #include "BufferLayout.h"
+#include "Core/JobSystem.h"
 #include "Core/Platform.h"
+#include "Core/Stopwatch.h"
 #include "Debug/GUI/GUI.h"
+#include "FrameRecorder.h"
 #include "GPUBuffer.h"
 #include "OpenGL/OpenGLRenderer.h"
+#include "RenderThread.h"
 #include "ShaderManager.h"
+#include "TextureUnits.h"
 #include "UniformLayout.h"
 #include "Utils/FileSystem.h"
 #include "VertexArray.h"
@@ -35,10 +40,22 @@ namespace pxl
 
     static std::unordered_map<RendererGeometryTarget, std::shared_ptr<GraphicsPipeline>> s_Pipelines;
 
-    // Texture Data
-    static uint32_t s_TextureUnitIndex = 0;
+    // Compilation Data
+    // NOTE: Shaders and pipelines are compiled as a job graph on the job system. Each pipeline job depends on the counters of the shader jobs it uses.
+    template<typename T>
+    struct CompileJob
+    {
+        std::shared_ptr<JobCounter> Counter;
+        std::shared_ptr<std::shared_ptr<T>> Result; // Only safe to read once the counter is done
+    };
+
+    static std::unordered_map<std::string, CompileJob<Shader>> s_ShaderJobs;
+    static std::unordered_map<RendererGeometryTarget, CompileJob<GraphicsPipeline>> s_PipelineJobs;
+
+    static Stopwatch s_CompileStopwatch(false);
 
-    static std::vector<std::shared_ptr<Texture>> s_TextureUnits;
+    // Texture Data
+    static TextureUnits s_TextureUnits;
     static std::vector<int32_t> s_Samplers;
 
     static std::shared_ptr<Texture> s_WhitePixelTexture = nullptr;
@@ -98,62 +115,154 @@ namespace pxl
     static std::unordered_map<std::shared_ptr<Mesh>, std::shared_ptr<GPUBuffer>> s_MeshIBOs;
     static std::unordered_map<std::shared_ptr<Mesh>, std::shared_ptr<VertexArray>> s_MeshVAOs;
 
+    struct QueuedMeshDraw
+    {
+        std::shared_ptr<Mesh> Source;
+        glm::mat4 Transform;
+    };
+
+    // Mesh draws are queued until the next flush so they can be recorded alongside the rest of the geometry
+    static std::vector<QueuedMeshDraw> s_MeshDraws;
+
     // For OpenGL
     static std::shared_ptr<VertexArray> s_QuadVAO = nullptr;
     static std::shared_ptr<VertexArray> s_CubeVAO = nullptr;
     static std::shared_ptr<VertexArray> s_LineVAO = nullptr;
     static std::shared_ptr<VertexArray> s_StaticQuadVAO = nullptr;
 
+    // The last clear colour given to the renderer API, so a render capture can start with it
+    static glm::vec4 s_ClearColour = glm::vec4(0.0f);
+
+    // Holds the camera matrices of the captured flush being replayed, see ReplayFlush()
+    static FramePacket s_ReplayPacket;
+    static bool s_ReplayPending = false;
+
+    // The null renderer mirrors OpenGL's binding model (vertex arrays, texture units and uniforms) so it runs the same front end code
+    static bool UsesOpenGLBindings()
+    {
+        auto api = Renderer::GetCurrentAPI();
+        return api == RendererAPIType::OpenGL || api == RendererAPIType::Null;
+    }
+
+    // Buffers are created on the calling thread so recording only ever reads them
+    static void CreateMeshBuffers(const std::shared_ptr<Mesh>& mesh)
+    {
+        if (s_MeshVBOs.contains(mesh))
+            return;
+
+        s_MeshVBOs[mesh] = GPUBuffer::Create(GPUBufferUsage::Vertex, GPUBufferDrawHint::Dynamic, static_cast<uint32_t>(mesh->Vertices.size() * sizeof(MeshVertex)), mesh->Vertices.data());
+        s_MeshIBOs[mesh] = GPUBuffer::Create(GPUBufferUsage::Index, GPUBufferDrawHint::Static, static_cast<uint32_t>(mesh->Indices.size() * sizeof(uint32_t)), mesh->Indices.data());
+
+        if (UsesOpenGLBindings())
+        {
+            s_MeshVAOs[mesh] = VertexArray::Create();
+            s_MeshVAOs[mesh]->AddVertexBuffer(s_MeshVBOs[mesh], MeshVertex::GetLayout());
+            s_MeshVAOs[mesh]->SetIndexBuffer(s_MeshIBOs[mesh]);
+        }
+    }
+
     void Renderer::Init(const std::shared_ptr<Window>& window)
     {
         PXL_PROFILE_SCOPE;
 
+        InitAsync(window);
+
+        // Block until every pipeline has been created
+        ResolvePipelineJobs(true);
+    }
+
+    void Renderer::InitAsync(const std::shared_ptr<Window>& window)
+    {
+        PXL_PROFILE_SCOPE;
+
+        PXL_ASSERT_MSG(window->GetGraphicsContext(), "Window has no graphics context for renderer");
+
+        InitAsync(window->GetGraphicsContext(), window->GetRendererAPI());
+    }
+
+    void Renderer::Init(RendererAPIType api, const FramebufferSpecs& targetSpecs)
+    {
+        PXL_PROFILE_SCOPE;
+
+        auto context = GraphicsContext::CreateHeadless(api, targetSpecs);
+
+        PXL_ASSERT_MSG(context, "Failed to create headless graphics context for renderer");
+
+        InitAsync(context, api);
+
+        // Framebuffers can only be created once the renderer knows its API (and Vulkan's allocator exists)
+        s_RenderTarget = Framebuffer::Create(targetSpecs);
+        s_RendererAPI->SetRenderTarget(s_RenderTarget);
+
+        // Block until every pipeline has been created
+        ResolvePipelineJobs(true);
+    }
+
+    void Renderer::ResizeRenderTarget(uint32_t width, uint32_t height)
+    {
+        if (!s_RenderTarget)
+        {
+            PXL_LOG_WARN(LogArea::Renderer, "Renderer has no render target to resize");
+            return;
+        }
+
+        s_RenderTarget->Resize(width, height);
+
+        // Rebinds the recreated framebuffer, and covers it with the viewport and scissor again
+        s_RendererAPI->SetRenderTarget(s_RenderTarget);
+    }
+
+    void Renderer::InitAsync(const std::shared_ptr<GraphicsContext>& context, RendererAPIType api)
+    {
         if (s_Enabled)
         {
             PXL_LOG_WARN(LogArea::Renderer, "Renderer already initialized");
             // TODO: recreate all resources used for the renderer if the renderer api has changed
         }
 
-        PXL_ASSERT_MSG(window->GetGraphicsContext(), "Window has no graphics context for renderer");
-
-        s_ContextHandle = window->GetGraphicsContext();
-        s_RendererAPIType = window->GetRendererAPI();
+        s_ContextHandle = context;
+        s_RendererAPIType = api;
 
         // Evaluate renderer limits
         s_Limits = s_ContextHandle->GetLimits();
-        s_TextureUnits.resize(s_Limits.MaxTextureUnits, nullptr);
+        s_TextureUnits.Resize(s_Limits.MaxTextureUnits);
         s_Samplers.resize(s_Limits.MaxTextureUnits);
 
         // Create renderer API object
-        s_RendererAPI = RendererAPI::Create(s_RendererAPIType, window);
+        s_RendererAPI = RendererAPI::Create(s_RendererAPIType, s_ContextHandle);
 
         PXL_ASSERT_MSG(s_RendererAPI, "Failed to create renderer api object");
 
+        s_PipelinesReady = false;
+        s_CompileStopwatch.Reset();
+        s_CompileStopwatch.Start();
+
         // Compile and create shaders
         switch (s_RendererAPIType)
         {
             case RendererAPIType::OpenGL:
-                ShaderManager::LoadFromGLSL("resources/shaders/opengl/quad_textured_ogl.vert", ShaderStage::Vertex);
-                ShaderManager::LoadFromGLSL("resources/shaders/opengl/quad_textured_ogl.frag", ShaderStage::Fragment);
+            case RendererAPIType::Null:
+                QueueShaderJob("resources/shaders/opengl/quad_textured_ogl.vert", ShaderStage::Vertex);
+                QueueShaderJob("resources/shaders/opengl/quad_textured_ogl.frag", ShaderStage::Fragment);
 
-                ShaderManager::LoadFromGLSL("resources/shaders/opengl/quad_ogl.vert", ShaderStage::Vertex);
-                ShaderManager::LoadFromGLSL("resources/shaders/opengl/quad_ogl.frag", ShaderStage::Fragment);
+                QueueShaderJob("resources/shaders/opengl/quad_ogl.vert", ShaderStage::Vertex);
+                QueueShaderJob("resources/shaders/opengl/quad_ogl.frag", ShaderStage::Fragment);
 
-                ShaderManager::LoadFromGLSL("resources/shaders/opengl/line_ogl.vert", ShaderStage::Vertex);
-                ShaderManager::LoadFromGLSL("resources/shaders/opengl/line_ogl.frag", ShaderStage::Fragment);
+                QueueShaderJob("resources/shaders/opengl/line_ogl.vert", ShaderStage::Vertex);
+                QueueShaderJob("resources/shaders/opengl/line_ogl.frag", ShaderStage::Fragment);
 
-                ShaderManager::LoadFromGLSL("resources/shaders/opengl/mesh_ogl.vert", ShaderStage::Vertex);
+                QueueShaderJob("resources/shaders/opengl/mesh_ogl.vert", ShaderStage::Vertex);
                 break;
 
             case RendererAPIType::Vulkan:
-                ShaderManager::LoadFromGLSL("resources/shaders/vulkan/quad_vk.vert", ShaderStage::Vertex);
-                ShaderManager::LoadFromGLSL("resources/shaders/vulkan/quad_vk.frag", ShaderStage::Fragment);
+                QueueShaderJob("resources/shaders/vulkan/quad_vk.vert", ShaderStage::Vertex);
+                QueueShaderJob("resources/shaders/vulkan/quad_vk.frag", ShaderStage::Fragment);
 
-                ShaderManager::LoadFromSPIRV("resources/shaders/vulkan/compiled/quad_vert.spv", ShaderStage::Vertex);
-                ShaderManager::LoadFromSPIRV("resources/shaders/vulkan/compiled/quad_frag.spv", ShaderStage::Fragment);
+                QueueShaderJob("resources/shaders/vulkan/compiled/quad_vert.spv", ShaderStage::Vertex);
+                QueueShaderJob("resources/shaders/vulkan/compiled/quad_frag.spv", ShaderStage::Fragment);
 
-                ShaderManager::LoadFromSPIRV("resources/shaders/vulkan/compiled/line_vert.spv", ShaderStage::Vertex);
-                ShaderManager::LoadFromSPIRV("resources/shaders/vulkan/compiled/line_frag.spv", ShaderStage::Fragment);
+                QueueShaderJob("resources/shaders/vulkan/compiled/line_vert.spv", ShaderStage::Vertex);
+                QueueShaderJob("resources/shaders/vulkan/compiled/line_frag.spv", ShaderStage::Fragment);
                 break;
         }
 
@@ -185,13 +294,14 @@ namespace pxl
             s_StaticQuadVBO = GPUBuffer::Create(GPUBufferUsage::Vertex, GPUBufferDrawHint::Static, k_MaxQuadVertexCount * sizeof(QuadVertex), nullptr);
 
             GraphicsPipelineSpecs pipelineSpecs;
+            std::pair<std::string, std::string> shaderNames; // Vertex, Fragment
             pipelineSpecs.PrimitiveType = PrimitiveTopology::Triangle;
             pipelineSpecs.PolygonMode = PolygonMode::Fill;
             pipelineSpecs.CullMode = CullMode::None;
             pipelineSpecs.VertexLayout = bufferLayout;
 
             // Prepare other data based on renderer API
-            if (s_RendererAPIType == RendererAPIType::OpenGL)
+            if (UsesOpenGLBindings())
             {
                 s_QuadVAO = VertexArray::Create();
                 s_QuadVAO->AddVertexBuffer(s_QuadVBO, bufferLayout);
@@ -216,8 +326,7 @@ namespace pxl
                     pipeline->SetUniformData("u_VP", UniformDataType::Mat4, &vp);
                 };
 
-                pipelineSpecs.Shaders[ShaderStage::Vertex] = ShaderManager::Get("quad_textured_ogl.vert");
-                pipelineSpecs.Shaders[ShaderStage::Fragment] = ShaderManager::Get("quad_textured_ogl.frag");
+                shaderNames = { "quad_textured_ogl.vert", "quad_textured_ogl.frag" };
             }
             else if (s_RendererAPIType == RendererAPIType::Vulkan)
             {
@@ -238,8 +347,7 @@ namespace pxl
                     pipeline->SetPushConstantData("u_VP", &vp);
                 };
 
-                pipelineSpecs.Shaders[ShaderStage::Vertex] = ShaderManager::Get("quad_vk.vert");
-                pipelineSpecs.Shaders[ShaderStage::Fragment] = ShaderManager::Get("quad_vk.frag");
+                shaderNames = { "quad_vk.vert", "quad_vk.frag" };
 
                 PushConstantLayout pushConstantLayout;
                 pushConstantLayout.Add({ "u_VP", UniformDataType::Mat4, ShaderStage::Vertex });
@@ -247,7 +355,7 @@ namespace pxl
                 pipelineSpecs.PushConstantLayout = pushConstantLayout;
             }
 
-            s_Pipelines[RendererGeometryTarget::Quad] = GraphicsPipeline::Create(pipelineSpecs);
+            QueuePipelineJob(RendererGeometryTarget::Quad, pipelineSpecs, shaderNames);
         }
 
         // --------------------
@@ -277,12 +385,13 @@ namespace pxl
             s_CubeIBO = GPUBuffer::Create(GPUBufferUsage::Index, GPUBufferDrawHint::Static, k_MaxCubeIndexCount * sizeof(uint32_t), s_CubeIndices.data());
 
             GraphicsPipelineSpecs pipelineSpecs;
+            std::pair<std::string, std::string> shaderNames; // Vertex, Fragment
             pipelineSpecs.PrimitiveType = PrimitiveTopology::Triangle;
             pipelineSpecs.CullMode = CullMode::Back;
             pipelineSpecs.VertexLayout = bufferLayout;
 
             // Prepare other data based on renderer API
-            if (s_RendererAPIType == RendererAPIType::OpenGL)
+            if (UsesOpenGLBindings())
             {
                 s_CubeVAO = VertexArray::Create();
                 s_CubeVAO->AddVertexBuffer(s_CubeVBO, bufferLayout);
@@ -293,8 +402,7 @@ namespace pxl
                     s_CubeVAO->Bind();
                 };
 
-                pipelineSpecs.Shaders[ShaderStage::Vertex] = ShaderManager::Get("quad_ogl.vert");
-                pipelineSpecs.Shaders[ShaderStage::Fragment] = ShaderManager::Get("quad_ogl.frag");
+                shaderNames = { "quad_ogl.vert", "quad_ogl.frag" };
             }
             else if (s_RendererAPIType == RendererAPIType::Vulkan)
             {
@@ -304,8 +412,7 @@ namespace pxl
                     s_CubeIBO->Bind();
                 };
 
-                pipelineSpecs.Shaders[ShaderStage::Vertex] = ShaderManager::Get("quad_vert.spv");
-                pipelineSpecs.Shaders[ShaderStage::Fragment] = ShaderManager::Get("quad_frag.spv");
+                shaderNames = { "quad_vert.spv", "quad_frag.spv" };
 
                 PushConstantLayout pushConstantLayout;
                 pushConstantLayout.Add({ "u_VP", UniformDataType::Mat4, ShaderStage::Vertex });
@@ -313,7 +420,7 @@ namespace pxl
                 pipelineSpecs.PushConstantLayout = pushConstantLayout;
             }
 
-            s_Pipelines[RendererGeometryTarget::Cube] = GraphicsPipeline::Create(pipelineSpecs);
+            QueuePipelineJob(RendererGeometryTarget::Cube, pipelineSpecs, shaderNames);
         }
 
         // --------------------
@@ -326,11 +433,12 @@ namespace pxl
             s_LineVBO = GPUBuffer::Create(GPUBufferUsage::Vertex, GPUBufferDrawHint::Dynamic, k_MaxLineVertexCount * sizeof(LineVertex), nullptr);
 
             GraphicsPipelineSpecs pipelineSpecs;
+            std::pair<std::string, std::string> shaderNames; // Vertex, Fragment
             pipelineSpecs.PrimitiveType = PrimitiveTopology::Line;
             pipelineSpecs.VertexLayout = bufferLayout;
 
             // Prepare other data based on renderer API
-            if (s_RendererAPIType == RendererAPIType::OpenGL)
+            if (UsesOpenGLBindings())
             {
                 s_LineVAO = VertexArray::Create();
                 s_LineVAO->AddVertexBuffer(s_LineVBO, bufferLayout);
@@ -340,8 +448,7 @@ namespace pxl
                     s_LineVAO->Bind();
                 };
 
-                pipelineSpecs.Shaders[ShaderStage::Vertex] = ShaderManager::Get("line_ogl.vert");
-                pipelineSpecs.Shaders[ShaderStage::Fragment] = ShaderManager::Get("line_ogl.frag");
+                shaderNames = { "line_ogl.vert", "line_ogl.frag" };
             }
             else if (s_RendererAPIType == RendererAPIType::Vulkan)
             {
@@ -350,8 +457,7 @@ namespace pxl
                     s_LineVBO->Bind();
                 };
 
-                pipelineSpecs.Shaders[ShaderStage::Vertex] = ShaderManager::Get("line_vert.spv");
-                pipelineSpecs.Shaders[ShaderStage::Fragment] = ShaderManager::Get("line_frag.spv");
+                shaderNames = { "line_vert.spv", "line_frag.spv" };
 
                 PushConstantLayout pushConstantLayout;
                 pushConstantLayout.Add({ "u_VP", UniformDataType::Mat4, ShaderStage::Vertex });
@@ -359,7 +465,7 @@ namespace pxl
                 pipelineSpecs.PushConstantLayout = pushConstantLayout;
             }
 
-            s_Pipelines[RendererGeometryTarget::Line] = GraphicsPipeline::Create(pipelineSpecs);
+            QueuePipelineJob(RendererGeometryTarget::Line, pipelineSpecs, shaderNames);
         }
 
         // --------------------
@@ -369,21 +475,20 @@ namespace pxl
             const auto bufferLayout = MeshVertex::GetLayout();
 
             GraphicsPipelineSpecs pipelineSpecs;
+            std::pair<std::string, std::string> shaderNames; // Vertex, Fragment
             pipelineSpecs.PrimitiveType = PrimitiveTopology::Triangle;
             pipelineSpecs.VertexLayout = bufferLayout;
             pipelineSpecs.PolygonMode = PolygonMode::Fill;
             pipelineSpecs.CullMode = CullMode::Back;
 
             // Prepare other data based on renderer API
-            if (s_RendererAPIType == RendererAPIType::OpenGL)
+            if (UsesOpenGLBindings())
             {
-                pipelineSpecs.Shaders[ShaderStage::Vertex] = ShaderManager::Get("mesh_ogl.vert");
-                pipelineSpecs.Shaders[ShaderStage::Fragment] = ShaderManager::Get("quad_ogl.frag");
+                shaderNames = { "mesh_ogl.vert", "quad_ogl.frag" };
             }
             else if (s_RendererAPIType == RendererAPIType::Vulkan)
             {
-                pipelineSpecs.Shaders[ShaderStage::Vertex] = ShaderManager::Get("quad_vk.vert");
-                pipelineSpecs.Shaders[ShaderStage::Fragment] = ShaderManager::Get("quad_vk.frag");
+                shaderNames = { "quad_vk.vert", "quad_vk.frag" };
 
                 PushConstantLayout pushConstantLayout;
                 pushConstantLayout.Add({ "u_VP", UniformDataType::Mat4, ShaderStage::Vertex });
@@ -392,7 +497,7 @@ namespace pxl
                 pipelineSpecs.PushConstantLayout = pushConstantLayout;
             }
 
-            s_Pipelines[RendererGeometryTarget::Mesh] = GraphicsPipeline::Create(pipelineSpecs);
+            QueuePipelineJob(RendererGeometryTarget::Mesh, pipelineSpecs, shaderNames);
         }
 
         // Prepare white pixel texture
@@ -415,15 +520,119 @@ namespace pxl
         s_Enabled = true;
     }
 
+    static JobAffinity GetCompileJobAffinity()
+    {
+        // Vulkan objects can be created from any thread. OpenGL calls must stay on the thread that owns the context, which is the main thread
+        // until the render thread starts (it waits for the pipelines first). Without the job system, jobs run as they're scheduled
+        if (Renderer::GetCurrentAPI() == RendererAPIType::Vulkan || !JobSystem::IsInitialized())
+            return JobAffinity::Any;
+
+        return JobAffinity::MainThread;
+    }
+
+    void Renderer::QueueShaderJob(const std::filesystem::path& path, ShaderStage stage)
+    {
+        auto result = std::make_shared<std::shared_ptr<Shader>>();
+
+        auto counter = JobSystem::Schedule([path, stage, result]()
+        {
+            PXL_PROFILE_SCOPE_NAMED("Shader Compile Job");
+
+            if (path.extension() == ".spv")
+                *result = ShaderManager::LoadFromSPIRV(path, stage);
+            else
+                *result = ShaderManager::LoadFromGLSL(path, stage);
+        }, GetCompileJobAffinity());
+
+        s_ShaderJobs[path.filename().string()] = { counter, result };
+    }
+
+    void Renderer::QueuePipelineJob(RendererGeometryTarget target, const GraphicsPipelineSpecs& specs, const std::pair<std::string, std::string>& shaderNames)
+    {
+        PXL_ASSERT_MSG(s_ShaderJobs.contains(shaderNames.first) && s_ShaderJobs.contains(shaderNames.second), "Pipeline uses a shader that was never queued");
+
+        const auto& vertexJob = s_ShaderJobs.at(shaderNames.first);
+        const auto& fragmentJob = s_ShaderJobs.at(shaderNames.second);
+
+        auto result = std::make_shared<std::shared_ptr<GraphicsPipeline>>();
+
+        // Only starts once this pipeline's shaders are done, other pipelines keep compiling in the meantime
+        auto counter = JobSystem::Schedule([specs, vertexShader = vertexJob.Result, fragmentShader = fragmentJob.Result, result]() mutable
+        {
+            PXL_PROFILE_SCOPE_NAMED("Pipeline Create Job");
+
+            specs.Shaders[ShaderStage::Vertex] = *vertexShader;
+            specs.Shaders[ShaderStage::Fragment] = *fragmentShader;
+
+            *result = GraphicsPipeline::Create(specs);
+        }, { vertexJob.Counter, fragmentJob.Counter }, GetCompileJobAffinity());
+
+        s_PipelineJobs[target] = { counter, result };
+    }
+
+    void Renderer::ResolvePipelineJobs(bool wait)
+    {
+        PXL_PROFILE_SCOPE;
+
+        for (auto it = s_PipelineJobs.begin(); it != s_PipelineJobs.end();)
+        {
+            auto& [target, job] = *it;
+
+            // Waiting runs other jobs meanwhile, including the OpenGL jobs that can only run on the main thread
+            if (wait)
+            {
+                JobSystem::Wait(job.Counter);
+            }
+            else if (!job.Counter->IsDone())
+            {
+                it++;
+                continue;
+            }
+
+            // Don't override a pipeline set by the user while this one was compiling
+            if (!s_Pipelines.contains(target))
+                s_Pipelines[target] = *job.Result;
+
+            it = s_PipelineJobs.erase(it);
+        }
+
+        if (s_PipelineJobs.empty() && !s_PipelinesReady)
+        {
+            s_ShaderJobs.clear();
+            s_PipelinesReady = true;
+
+            PXL_LOG_INFO(LogArea::Renderer, "Finished compiling shaders and pipelines in {:.2f} ms", s_CompileStopwatch.GetElapsedMilliSec());
+        }
+    }
+
     void Renderer::Shutdown()
     {
         if (!s_Enabled)
             return;
 
+        // The render thread and pipeline jobs may still be using the device
+        RenderThread::Stop();
+        ResolvePipelineJobs(true);
+
+        // The capture holds onto the textures it has seen, which have to be released before the device
+        RenderCapture::End();
+
+        // Recorded frames are held in the readback buffers until they've been written
+        FrameRecorder::Stop();
+
         s_Enabled = false;
 
-        s_ContextHandle.reset();
-        s_RendererAPI.reset();
+        // Frame readback buffers are owned by the graphics API too
+        {
+            std::lock_guard lock(s_ReadbackMutex);
+            s_ReadbackPool.reset();
+        }
+
+        // The render target's resources have to be released while the device still exists
+        if (s_RendererAPI)
+            s_RendererAPI->SetRenderTarget(nullptr);
+
+        s_RenderTarget.reset();
 
         // Delete vulkan objects before RAII deletes them in the wrong order
         if (s_RendererAPIType == RendererAPIType::Vulkan)
@@ -432,17 +641,96 @@ namespace pxl
             VulkanDeletionQueue::Flush();
         }
 
+        // The renderer deletes its OpenGL timer queries, which needs the context to still be alive
+        s_RendererAPI.reset();
+        s_ContextHandle.reset();
+
         PXL_LOG_INFO(LogArea::Renderer, "Renderer shutdown");
     }
 
     void Renderer::SetClearColour(const glm::vec4& colour)
     {
+        if (s_RecordingPacket)
+        {
+            s_RecordingPacket->ClearColour = colour;
+            return;
+        }
+
         s_RendererAPI->SetClearColour(colour);
+        s_ClearColour = colour;
     }
 
     void Renderer::SetClearColour(ColourName colour)
     {
-        s_RendererAPI->SetClearColour(Colour::AsVec4(colour));
+        SetClearColour(Colour::AsVec4(colour));
+    }
+
+    bool Renderer::EnableFrameReadback(uint32_t bufferCount)
+    {
+        PXL_ASSERT(s_Enabled);
+
+        bool enabled = false;
+
+        // The buffers belong to the graphics API, so they're created on the thread that renders
+        RenderThread::Submit([&]()
+        {
+            auto pool = s_RendererAPI->CreateReadbackPool(bufferCount);
+            enabled = pool != nullptr;
+
+            std::lock_guard lock(s_ReadbackMutex);
+            s_ReadbackPool = pool;
+        });
+
+        RenderThread::WaitIdle();
+
+        return enabled;
+    }
+
+    void Renderer::DisableFrameReadback()
+    {
+        RenderThread::Submit([]()
+        {
+            std::shared_ptr<FrameReadbackPool> pool = nullptr;
+
+            {
+                std::lock_guard lock(s_ReadbackMutex);
+                std::swap(pool, s_ReadbackPool);
+            }
+
+            // Destroyed outside the lock, since the Vulkan pool waits for its copies to finish
+            pool.reset();
+        });
+
+        RenderThread::WaitIdle();
+    }
+
+    bool Renderer::IsFrameReadbackEnabled()
+    {
+        std::lock_guard lock(s_ReadbackMutex);
+        return s_ReadbackPool != nullptr;
+    }
+
+    void Renderer::RequestReadback()
+    {
+        if (s_RecordingPacket)
+        {
+            s_RecordingPacket->ReadbackRequested = true;
+            return;
+        }
+
+        s_ReadbackRequested = true;
+    }
+
+    std::shared_ptr<ReadbackFrame> Renderer::PollReadback()
+    {
+        std::lock_guard lock(s_ReadbackMutex);
+        return s_ReadbackPool ? s_ReadbackPool->Poll() : nullptr;
+    }
+
+    FrameReadbackStats Renderer::GetReadbackStats()
+    {
+        std::lock_guard lock(s_ReadbackMutex);
+        return s_ReadbackPool ? s_ReadbackPool->GetStats() : FrameReadbackStats();
     }
 
     void Renderer::Begin()
@@ -451,14 +739,45 @@ namespace pxl
 
         PXL_ASSERT(s_Enabled);
 
+        if (!s_PipelinesReady)
+            ResolvePipelineJobs(false);
+
         s_RendererAPI->BeginFrame();
 
+        // Static geometry uploaded before the capture began still has to be in it
+        if (RenderCapture::IsCapturing() && RenderCapture::OnBeginFrame(s_ClearColour))
+        {
+            if (!s_StaticQuadVertices.empty() || !s_StaticCubeVertices.empty())
+                CaptureStaticGeometry();
+        }
+
+        // The stats were reset by the last frame's End(), so this frame starts with the latest frame timing
+        {
+            std::lock_guard lock(s_StatsMutex);
+            s_Stats.FrameTime = s_FrameTiming.FrameTime;
+            s_Stats.FPS = s_FrameTiming.FPS;
+            s_Stats.AverageFrameTime = s_FrameTiming.AverageFrameTime;
+            s_Stats.StutterCount = s_FrameTiming.StutterCount;
+        }
+
+        auto gpuTimings = s_RendererAPI->GetGPUTimings();
+        s_Stats.GPUTime = gpuTimings.FrameTime;
+        s_Stats.GPUSectionTimes = gpuTimings.SectionTimes;
+        s_Stats.GPUTimingSequence = gpuTimings.Sequence;
+
+        if (gpuTimings.Sequence != s_LastGPUTimingSequence)
+        {
+            std::lock_guard lock(s_FrameTimesMutex);
+            s_GPUFrameTimes.Add(gpuTimings.FrameTime);
+            s_LastGPUTimingSequence = gpuTimings.Sequence;
+        }
+
         // Clear the screen
         s_RendererAPI->Clear();
 
         // Set first texture unit as white pixel texture
-        s_TextureUnits[0] = s_WhitePixelTexture;
-        s_TextureUnitIndex++;
+        s_TextureUnits.Clear();
+        s_TextureUnits.GetIndex(s_WhitePixelTexture);
     }
 
     void Renderer::End()
@@ -469,14 +788,55 @@ namespace pxl
 
         Flush();
 
+        if (s_ReplayPending)
+        {
+            s_RenderingPacket = nullptr;
+            s_ReplayPending = false;
+        }
+
         if (GUI::IsInitialized())
         {
             GUI::Update();
-            GUI::Render();
+
+            // The GUI is recorded like any other geometry so it ends up in its own command buffer when recording in parallel
+            s_RendererAPI->ExecuteRecordTasks({ []()
+            {
+                auto startTime = std::chrono::steady_clock::now();
+
+                s_RendererAPI->BeginGPUTimer(GPUTimerSection::GUI);
+                GUI::Render();
+                s_RendererAPI->EndGPUTimer();
+
+                s_Stats.CPUSectionTimes[static_cast<size_t>(GPUTimerSection::GUI)] += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+            } });
         }
 
+        // The copy is recorded by the backend at the end of the frame, after the GUI has been drawn
+        if (s_ReadbackRequested.exchange(false) && s_ReadbackPool)
+            s_ReadbackPool->Queue(s_FrameNumber);
+
+        if (FrameRecorder::IsRecording() && s_ReadbackPool)
+            FrameRecorder::OnEndFrame(*s_ReadbackPool);
+
         s_RendererAPI->EndFrame();
 
+        // Finished copies from earlier frames are made available to PollReadback()
+        if (s_ReadbackPool)
+            s_ReadbackPool->Resolve();
+
+        if (FrameRecorder::IsRecording() && s_ReadbackPool)
+            FrameRecorder::CollectFrames(*s_ReadbackPool);
+
+        s_FrameNumber++;
+
+        if (RenderCapture::IsCapturing())
+            RenderCapture::OnEndFrame();
+
+        {
+            std::lock_guard lock(s_StatsMutex);
+            s_LastFrameStats = s_Stats;
+        }
+
         ResetStats();
     }
 
@@ -502,6 +862,12 @@ namespace pxl
 
     std::shared_ptr<GraphicsPipeline> Renderer::GetPipeline(RendererGeometryTarget target)
     {
+        if (!s_Pipelines.contains(target))
+        {
+            PXL_LOG_WARN(LogArea::Renderer, "Requested pipeline isn't ready yet");
+            return nullptr;
+        }
+
         return s_Pipelines.at(target);
     }
 
@@ -524,6 +890,12 @@ namespace pxl
     {
         PXL_PROFILE_SCOPE;
 
+        if (s_RecordingPacket)
+        {
+            s_RecordingPacket->Quads.push_back(quad);
+            return;
+        }
+
         if (s_QuadCount >= k_MaxQuadCount)
             Flush();
 
@@ -566,6 +938,12 @@ namespace pxl
     {
         PXL_PROFILE_SCOPE;
 
+        if (s_RecordingPacket)
+        {
+            s_RecordingPacket->Cubes.push_back(cube);
+            return;
+        }
+
         if (s_CubeCount >= k_MaxCubeCount)
             Flush();
 
@@ -622,6 +1000,12 @@ namespace pxl
     {
         PXL_PROFILE_SCOPE;
 
+        if (s_RecordingPacket)
+        {
+            s_RecordingPacket->Lines.push_back(line);
+            return;
+        }
+
         if (s_LineCount >= k_MaxLineCount)
             Flush();
 
@@ -658,6 +1042,15 @@ namespace pxl
             return;
         }
 
+        if (s_RecordingPacket)
+        {
+            s_RecordingPacket->Meshes.push_back({ mesh, position, rotation, scale });
+            return;
+        }
+
+        if (!s_PipelinesReady)
+            return;
+
         glm::quat rotationY = glm::angleAxis(glm::radians(rotation.y), glm::vec3(0.0f, 1.0f, 0.0f));
         glm::quat rotationZ = glm::angleAxis(glm::radians(rotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
         glm::quat rotationX = glm::angleAxis(glm::radians(rotation.x), glm::vec3(1.0f, 0.0f, 0.0f));
@@ -666,45 +1059,10 @@ namespace pxl
         glm::mat4 translateMat = glm::translate(glm::mat4(1.0f), position);
         glm::mat4 rotationMat = glm::mat4_cast(rotationQuat);
         glm::mat4 scaleMat = glm::scale(glm::mat4(1.0f), scale);
-        glm::mat4 transform = translateMat * rotationMat * scaleMat;
-
-        auto meshPipeline = s_Pipelines.at(RendererGeometryTarget::Mesh);
-
-        meshPipeline->Bind();
-        meshPipeline->SetUniformData("u_Transform", UniformDataType::Mat4, &transform);
-
-        if (!s_MeshVBOs.contains(mesh))
-        {
-            s_MeshVBOs[mesh] = GPUBuffer::Create(GPUBufferUsage::Vertex, GPUBufferDrawHint::Dynamic, static_cast<uint32_t>(mesh->Vertices.size() * sizeof(MeshVertex)), mesh->Vertices.data());
-            s_MeshIBOs[mesh] = GPUBuffer::Create(GPUBufferUsage::Index, GPUBufferDrawHint::Static, static_cast<uint32_t>(mesh->Indices.size() * sizeof(uint32_t)), mesh->Indices.data());
-
-            if (s_RendererAPIType == RendererAPIType::OpenGL)
-            {
-                s_MeshVAOs[mesh] = VertexArray::Create();
-                s_MeshVAOs[mesh]->AddVertexBuffer(s_MeshVBOs[mesh], MeshVertex::GetLayout());
-                s_MeshVAOs[mesh]->SetIndexBuffer(s_MeshIBOs[mesh]);
-            }
-        }
-
-        if (s_RendererAPIType == RendererAPIType::OpenGL)
-        {
-            s_MeshVAOs[mesh]->Bind();
-        }
-        else
-        {
-            s_MeshVBOs[mesh]->Bind();
-            s_MeshIBOs[mesh]->Bind();
-        }
 
-        s_SetViewProjectionFunc(meshPipeline, s_QuadCamera->GetViewProjectionMatrix());
+        CreateMeshBuffers(mesh);
 
-        s_RendererAPI->DrawIndexed(static_cast<uint32_t>(mesh->Indices.size()));
-
-        s_Stats.PipelineBinds++;
-        s_Stats.DrawCalls++;
-        s_Stats.MeshCount++;
-        s_Stats.MeshVertexCount += static_cast<uint32_t>(mesh->Vertices.size());
-        s_Stats.MeshIndexCount += static_cast<uint32_t>(mesh->Indices.size());
+        s_MeshDraws.push_back({ mesh, translateMat * rotationMat * scaleMat });
     }
 
     void Renderer::ResetStaticGeometry(RendererGeometryTarget target)
@@ -793,62 +1151,57 @@ namespace pxl
 
         const auto layout = QuadVertex::GetLayout();
 
-        if (s_RendererAPIType == RendererAPIType::OpenGL)
+        if (UsesOpenGLBindings())
         {
             s_StaticQuadVAO->AddVertexBuffer(s_StaticQuadVBO, layout);
             s_StaticQuadVAO->SetIndexBuffer(s_StaticQuadIBO);
         }
+
+        if (RenderCapture::IsCapturing())
+            CaptureStaticGeometry();
     }
 
     float Renderer::GetTextureIndex(const std::shared_ptr<Texture>& texture)
     {
-        if (s_TextureUnitIndex >= s_Limits.MaxTextureUnits)
+        if (s_TextureUnits.IsFull())
             Flush();
 
-        float textureIndex = -1.0f;
-        bool foundTexture = false;
-
-        // Find the texture in texture storage
-        for (uint32_t i = 0; i < s_TextureUnitIndex; i++)
-        {
-            if (texture == s_TextureUnits[i])
-            {
-                textureIndex = static_cast<float>(i);
-                foundTexture = true;
-                break;
-            }
-        }
-
-        // If the texture wasn't found, add it to the next texture unit
-        if (!foundTexture)
-        {
-            textureIndex = static_cast<float>(s_TextureUnitIndex);
-            s_TextureUnits[s_TextureUnitIndex] = texture;
-            s_TextureUnitIndex++;
-        }
-
-        return textureIndex;
+        return static_cast<float>(s_TextureUnits.GetIndex(texture));
     }
 
     void Renderer::Flush()
     {
         PXL_PROFILE_SCOPE;
 
+        // Discard geometry until the pipelines have finished compiling, the frame is still cleared and presented
+        if (!s_PipelinesReady)
+        {
+            s_QuadCount = 0;
+            s_CubeCount = 0;
+            s_LineCount = 0;
+            s_MeshDraws.clear();
+            s_TextureUnits.Clear();
+            return;
+        }
+
+        if (RenderCapture::IsCapturing())
+            CaptureFlush();
+
         // ---------------------
         // Prepare textures
         // ---------------------
 
-        if (s_RendererAPIType == RendererAPIType::OpenGL)
+        if (UsesOpenGLBindings())
         {
             PXL_PROFILE_SCOPE_NAMED("Bind Textures");
 
-            for (uint32_t i = 0; i < s_TextureUnitIndex; i++)
+            for (uint32_t i = 0; i < s_TextureUnits.GetCount(); i++)
             {
                 s_TextureUnits[i]->Bind(i);
                 s_Stats.TextureBinds++;
             }
 
-            s_TextureUnitIndex = 0;
+            s_TextureUnits.Clear();
         }
 
         // ---------------------
@@ -860,6 +1213,105 @@ namespace pxl
         auto& linePipeline = s_Pipelines.at(RendererGeometryTarget::Line);
         auto& meshPipeline = s_Pipelines.at(RendererGeometryTarget::Mesh);
 
+        // ---------------------
+        // Upload dynamic geometry
+        // ---------------------
+
+        // NOTE: Uploads happen on this thread before recording starts since they may submit to the graphics queue
+        if (s_QuadCount > 0)
+            s_QuadVBO->SetData(s_QuadCount * 4 * sizeof(QuadVertex), s_QuadVertices.data()); // THIS TAKES SIZE IN BYTES
+
+        if (s_CubeCount > 0)
+            s_CubeVBO->SetData(s_CubeCount * 24 * sizeof(CubeVertex), s_CubeVertices.data()); // THIS TAKES SIZE IN BYTES
+
+        if (s_LineCount > 0)
+            s_LineVBO->SetData(s_LineCount * 2 * sizeof(LineVertex), s_LineVertices.data());
+
+        // ---------------------
+        // Build record tasks
+        // ---------------------
+
+        // Each task records one batch of geometry and counts what it drew into its own statistics, so tasks never share state.
+        // The GPU time of every task is measured under its section
+        std::vector<std::function<void()>> recordTasks;
+        std::vector<Statistics> taskStats;
+
+        auto addRecordTask = [&](GPUTimerSection section, std::function<void(Statistics&)> record)
+        {
+            size_t index = taskStats.size();
+            taskStats.emplace_back();
+            recordTasks.push_back([&taskStats, index, section, record]()
+            {
+                auto startTime = std::chrono::steady_clock::now();
+
+                s_RendererAPI->BeginGPUTimer(section);
+                record(taskStats[index]);
+                s_RendererAPI->EndGPUTimer();
+
+                auto& stats = taskStats[index];
+                stats.CPUSectionTimes[static_cast<size_t>(section)] += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+            });
+        };
+
+        uint32_t quadCount = s_QuadCount;
+        uint32_t cubeCount = s_CubeCount;
+        uint32_t lineCount = s_LineCount;
+
+        // ---------------------
+        // Meshes
+        // ---------------------
+
+        // Meshes are split evenly between the recording threads
+        if (!s_MeshDraws.empty())
+        {
+            PXL_ASSERT_MSG(s_QuadCamera, "Quad camera isn't set");
+            PXL_ASSERT_MSG(meshPipeline, "Mesh pipeline isn't set");
+
+            size_t meshCount = s_MeshDraws.size();
+            size_t batchCount = std::clamp<size_t>(s_RendererAPI->GetRecordingConcurrency(), 1, meshCount);
+            size_t batchSize = (meshCount + batchCount - 1) / batchCount;
+
+            for (size_t first = 0; first < meshCount; first += batchSize)
+            {
+                size_t last = std::min(first + batchSize, meshCount);
+
+                addRecordTask(GPUTimerSection::Meshes, [&, first, last](Statistics& stats)
+                {
+                    PXL_PROFILE_SCOPE_NAMED("Flush Meshes");
+
+                    meshPipeline->Bind();
+
+                    s_SetViewProjectionFunc(meshPipeline, GetViewProjection(RendererGeometryTarget::Mesh));
+
+                    stats.PipelineBinds++;
+
+                    for (size_t i = first; i < last; i++)
+                    {
+                        const auto& draw = s_MeshDraws[i];
+
+                        meshPipeline->SetUniformData("u_Transform", UniformDataType::Mat4, &draw.Transform);
+
+                        if (UsesOpenGLBindings())
+                        {
+                            s_MeshVAOs.at(draw.Source)->Bind();
+                        }
+                        else
+                        {
+                            s_MeshVBOs.at(draw.Source)->Bind();
+                            s_MeshIBOs.at(draw.Source)->Bind();
+                        }
+
+                        s_RendererAPI->DrawIndexed(static_cast<uint32_t>(draw.Source->Indices.size()));
+
+                        stats.DrawCalls++;
+                        stats.MeshCount++;
+                        stats.MeshVertexCount += static_cast<uint32_t>(draw.Source->Vertices.size());
+                        stats.MeshIndexCount += static_cast<uint32_t>(draw.Source->Indices.size());
+                    }
+                });
+            }
+        }
+
         // ---------------------
         // Static Geometry
         // ---------------------
@@ -867,55 +1319,61 @@ namespace pxl
         // Flush static quads if necessary
         if (!s_StaticQuadVertices.empty())
         {
-            PXL_PROFILE_SCOPE_NAMED("Flush Static Quads");
-
             PXL_ASSERT_MSG(s_StaticQuadVBO, "Static quad VBO is invalid, make sure you call StaticGeometryReady()");
 
             PXL_ASSERT_MSG(s_QuadCamera, "Quad camera isn't set");
             PXL_ASSERT_MSG(quadPipeline, "Quad pipeline isn't set");
             PXL_ASSERT_MSG(s_StaticQuadIBO, "Static quad IBO is invalid");
 
-            s_StaticQuadBindFunc();
+            addRecordTask(GPUTimerSection::StaticQuads, [&](Statistics& stats)
+            {
+                PXL_PROFILE_SCOPE_NAMED("Flush Static Quads");
+
+                s_StaticQuadBindFunc();
 
-            quadPipeline->Bind();
+                quadPipeline->Bind();
 
-            s_SetViewProjectionFunc(quadPipeline, s_QuadCamera->GetViewProjectionMatrix());
+                s_SetViewProjectionFunc(quadPipeline, GetViewProjection(RendererGeometryTarget::Quad));
 
-            s_RendererAPI->DrawIndexed(static_cast<uint32_t>(s_StaticQuadIndices.size()));
+                s_RendererAPI->DrawIndexed(static_cast<uint32_t>(s_StaticQuadIndices.size()));
 
-            s_Stats.PipelineBinds++;
-            s_Stats.DrawCalls++;
-            s_Stats.QuadCount += static_cast<uint32_t>(s_StaticQuadIndices.size()) / 3;
-            s_Stats.QuadVertexCount += static_cast<uint32_t>(s_StaticQuadVertices.size());
-            s_Stats.QuadIndexCount += static_cast<uint32_t>(s_StaticQuadIndices.size());
+                stats.PipelineBinds++;
+                stats.DrawCalls++;
+                stats.QuadCount += static_cast<uint32_t>(s_StaticQuadIndices.size()) / 3;
+                stats.QuadVertexCount += static_cast<uint32_t>(s_StaticQuadVertices.size());
+                stats.QuadIndexCount += static_cast<uint32_t>(s_StaticQuadIndices.size());
+            });
         }
 
         // Flush static cubes if necessary
         if (!s_StaticCubeVertices.empty())
         {
-            PXL_PROFILE_SCOPE_NAMED("Flush Static Cubes");
-
             PXL_ASSERT_MSG(s_StaticCubeVBO, "Static cube VBO is invalid, make sure you call StaticGeometryReady()");
 
             PXL_ASSERT_MSG(s_CubeCamera, "Cube camera isn't set");
             PXL_ASSERT_MSG(cubePipeline, "Cube pipeline isn't set");
             PXL_ASSERT_MSG(s_StaticCubeIBO, "Static cube IBO is invalid");
 
-            // TODO: Move this into a StaticCubeBind lambda
-            s_StaticCubeVBO->Bind();
-            s_CubeIBO->Bind();
+            addRecordTask(GPUTimerSection::StaticCubes, [&](Statistics& stats)
+            {
+                PXL_PROFILE_SCOPE_NAMED("Flush Static Cubes");
 
-            cubePipeline->Bind();
+                // TODO: Move this into a StaticCubeBind lambda
+                s_StaticCubeVBO->Bind();
+                s_CubeIBO->Bind();
 
-            s_SetViewProjectionFunc(cubePipeline, s_CubeCamera->GetViewProjectionMatrix());
+                cubePipeline->Bind();
 
-            s_RendererAPI->DrawIndexed(static_cast<uint32_t>(s_StaticCubeIndices.size()));
+                s_SetViewProjectionFunc(cubePipeline, GetViewProjection(RendererGeometryTarget::Cube));
 
-            s_Stats.PipelineBinds++;
-            s_Stats.DrawCalls++;
-            s_Stats.CubeCount += static_cast<uint32_t>(s_StaticCubeIndices.size()) / 36;
-            s_Stats.CubeVertexCount += static_cast<uint32_t>(s_StaticCubeVertices.size());
-            s_Stats.CubeIndexCount += static_cast<uint32_t>(s_StaticCubeIndices.size());
+                s_RendererAPI->DrawIndexed(static_cast<uint32_t>(s_StaticCubeIndices.size()));
+
+                stats.PipelineBinds++;
+                stats.DrawCalls++;
+                stats.CubeCount += static_cast<uint32_t>(s_StaticCubeIndices.size()) / 36;
+                stats.CubeVertexCount += static_cast<uint32_t>(s_StaticCubeVertices.size());
+                stats.CubeIndexCount += static_cast<uint32_t>(s_StaticCubeIndices.size());
+            });
         }
 
         // ---------------------
@@ -923,89 +1381,167 @@ namespace pxl
         // ---------------------
 
         // Flush quads if necessary
-        if (s_QuadCount > 0)
+        if (quadCount > 0)
         {
-            PXL_PROFILE_SCOPE_NAMED("Flush Dynamic Quads");
-
             PXL_ASSERT_MSG(s_QuadCamera, "Quad Camera isn't set");
             PXL_ASSERT_MSG(quadPipeline, "Quad pipeline isn't set");
 
-            s_QuadVBO->SetData(s_QuadCount * 4 * sizeof(QuadVertex), s_QuadVertices.data()); // THIS TAKES SIZE IN BYTES
-
-            s_QuadBufferBindFunc();
+            addRecordTask(GPUTimerSection::Quads, [&, quadCount](Statistics& stats)
+            {
+                PXL_PROFILE_SCOPE_NAMED("Flush Dynamic Quads");
 
-            // NOTE: Ensure we bind the pipeline before setting uniform data
-            quadPipeline->Bind();
+                s_QuadBufferBindFunc();
 
-            if (s_RendererAPIType == RendererAPIType::OpenGL)
-                quadPipeline->SetUniformData("u_Textures", UniformDataType::IntArray, s_Limits.MaxTextureUnits, s_Samplers.data());
+                // NOTE: Ensure we bind the pipeline before setting uniform data
+                quadPipeline->Bind();
 
-            s_SetViewProjectionFunc(quadPipeline, s_QuadCamera->GetViewProjectionMatrix());
+                if (UsesOpenGLBindings())
+                    quadPipeline->SetUniformData("u_Textures", UniformDataType::IntArray, s_Limits.MaxTextureUnits, s_Samplers.data());
 
-            s_RendererAPI->DrawIndexed(s_QuadCount * 6);
+                s_SetViewProjectionFunc(quadPipeline, GetViewProjection(RendererGeometryTarget::Quad));
 
-            s_Stats.PipelineBinds++;
-            s_Stats.DrawCalls++;
-            s_Stats.QuadCount += s_QuadCount;
-            s_Stats.QuadVertexCount += s_QuadCount * 4;
-            s_Stats.QuadIndexCount += s_QuadCount * 6;
+                s_RendererAPI->DrawIndexed(quadCount * 6);
 
-            s_QuadCount = 0;
+                stats.PipelineBinds++;
+                stats.DrawCalls++;
+                stats.QuadCount += quadCount;
+                stats.QuadVertexCount += quadCount * 4;
+                stats.QuadIndexCount += quadCount * 6;
+            });
         }
 
         // Flush cubes if necessary
-        if (s_CubeCount > 0)
+        if (cubeCount > 0)
         {
             PXL_ASSERT_MSG(s_CubeCamera, "Cube camera isn't set");
             PXL_ASSERT_MSG(cubePipeline, "Cube pipeline isn't set");
 
-            s_CubeVBO->SetData(s_CubeCount * 24 * sizeof(CubeVertex), s_CubeVertices.data()); // THIS TAKES SIZE IN BYTES
-
+            addRecordTask(GPUTimerSection::Cubes, [&, cubeCount](Statistics& stats)
             {
-                PXL_PROFILE_SCOPE_NAMED("s_CubeBindFunc()");
-                s_CubeBindFunc();
-            }
+                PXL_PROFILE_SCOPE_NAMED("Flush Dynamic Cubes");
 
-            cubePipeline->Bind();
+                {
+                    PXL_PROFILE_SCOPE_NAMED("s_CubeBindFunc()");
+                    s_CubeBindFunc();
+                }
 
-            s_SetViewProjectionFunc(cubePipeline, s_CubeCamera->GetViewProjectionMatrix());
+                cubePipeline->Bind();
 
-            s_RendererAPI->DrawIndexed(s_CubeCount * 36);
+                s_SetViewProjectionFunc(cubePipeline, GetViewProjection(RendererGeometryTarget::Cube));
 
-            s_Stats.PipelineBinds++;
-            s_Stats.DrawCalls++;
-            s_Stats.CubeCount += s_CubeCount;
-            s_Stats.CubeVertexCount += s_CubeCount * 24;
-            s_Stats.CubeIndexCount += s_CubeCount * 36;
+                s_RendererAPI->DrawIndexed(cubeCount * 36);
 
-            s_CubeCount = 0;
+                stats.PipelineBinds++;
+                stats.DrawCalls++;
+                stats.CubeCount += cubeCount;
+                stats.CubeVertexCount += cubeCount * 24;
+                stats.CubeIndexCount += cubeCount * 36;
+            });
         }
 
         // Flush lines if necessary
-        if (s_LineCount > 0)
+        if (lineCount > 0)
         {
-            PXL_PROFILE_SCOPE_NAMED("Flush Lines");
-
             PXL_ASSERT_MSG(s_LineCamera, "Line camera isn't set");
             PXL_ASSERT_MSG(linePipeline, "Line pipeline isn't set");
 
-            s_LineVBO->SetData(s_LineCount * 2 * sizeof(LineVertex), s_LineVertices.data());
+            addRecordTask(GPUTimerSection::Lines, [&, lineCount](Statistics& stats)
+            {
+                PXL_PROFILE_SCOPE_NAMED("Flush Lines");
 
-            s_LineBindFunc();
+                s_LineBindFunc();
 
-            linePipeline->Bind();
+                linePipeline->Bind();
 
-            s_SetViewProjectionFunc(linePipeline, s_LineCamera->GetViewProjectionMatrix());
+                s_SetViewProjectionFunc(linePipeline, GetViewProjection(RendererGeometryTarget::Line));
 
-            s_RendererAPI->DrawLines(s_LineCount * 2);
+                s_RendererAPI->DrawLines(lineCount * 2);
 
-            s_Stats.PipelineBinds++;
-            s_Stats.DrawCalls++;
-            s_Stats.LineCount += s_LineCount;
-            s_Stats.LineVertexCount += s_LineCount * 2;
+                stats.PipelineBinds++;
+                stats.DrawCalls++;
+                stats.LineCount += lineCount;
+                stats.LineVertexCount += lineCount * 2;
+            });
+        }
 
-            s_LineCount = 0;
+        // ---------------------
+        // Record
+        // ---------------------
+
+        s_RendererAPI->ExecuteRecordTasks(recordTasks);
+
+        for (const auto& stats : taskStats)
+            s_Stats.Add(stats);
+
+        s_QuadCount = 0;
+        s_CubeCount = 0;
+        s_LineCount = 0;
+        s_MeshDraws.clear();
+    }
+
+    glm::mat4 Renderer::GetViewProjection(RendererGeometryTarget target)
+    {
+        if (s_RenderingPacket)
+            return s_RenderingPacket->ViewProjections[static_cast<size_t>(target)];
+
+        switch (target)
+        {
+            case RendererGeometryTarget::Quad: return s_QuadCamera->GetViewProjectionMatrix();
+            case RendererGeometryTarget::Cube: return s_CubeCamera->GetViewProjectionMatrix();
+            case RendererGeometryTarget::Line: return s_LineCamera->GetViewProjectionMatrix();
+            case RendererGeometryTarget::Mesh: return s_QuadCamera->GetViewProjectionMatrix(); // Meshes use the quad camera until mesh cameras are supported
         }
+
+        return glm::mat4(1.0f);
+    }
+
+    void Renderer::CapturePacketCameras(FramePacket& packet)
+    {
+        if (s_QuadCamera)
+        {
+            packet.ViewProjections[static_cast<size_t>(RendererGeometryTarget::Quad)] = s_QuadCamera->GetViewProjectionMatrix();
+            packet.ViewProjections[static_cast<size_t>(RendererGeometryTarget::Mesh)] = s_QuadCamera->GetViewProjectionMatrix();
+        }
+
+        if (s_CubeCamera)
+            packet.ViewProjections[static_cast<size_t>(RendererGeometryTarget::Cube)] = s_CubeCamera->GetViewProjectionMatrix();
+
+        if (s_LineCamera)
+            packet.ViewProjections[static_cast<size_t>(RendererGeometryTarget::Line)] = s_LineCamera->GetViewProjectionMatrix();
+    }
+
+    void Renderer::RenderPacket(const FramePacket& packet)
+    {
+        PXL_PROFILE_SCOPE;
+
+        if (packet.ClearColour)
+        {
+            s_RendererAPI->SetClearColour(packet.ClearColour.value());
+            s_ClearColour = packet.ClearColour.value();
+        }
+
+        if (packet.ReadbackRequested)
+            s_ReadbackRequested = true;
+
+        s_RenderingPacket = &packet;
+
+        Begin();
+
+        for (const auto& quad : packet.Quads)
+            AddQuad(quad);
+
+        for (const auto& cube : packet.Cubes)
+            AddCube(cube);
+
+        for (const auto& line : packet.Lines)
+            AddLine(line);
+
+        for (const auto& draw : packet.Meshes)
+            DrawMesh(draw.Mesh, draw.Position, draw.Rotation, draw.Scale);
+
+        End();
+
+        s_RenderingPacket = nullptr;
     }
 
     glm::mat4 Renderer::CalculateTransform(const glm::vec3& position, const glm::vec3& rotation, const glm::vec3& scale)
@@ -1019,12 +1555,165 @@ namespace pxl
         // clang-format on
     }
 
+    void Renderer::CaptureFlush()
+    {
+        PXL_PROFILE_SCOPE;
+
+        RenderCaptureFlush flush;
+
+        // Targets without a camera have nothing to draw, unless the matrices come from a packet
+        auto getViewProjection = [](RendererGeometryTarget target, const std::shared_ptr<Camera>& camera)
+        {
+            return s_RenderingPacket || camera ? GetViewProjection(target) : glm::mat4(1.0f);
+        };
+
+        flush.ViewProjections[static_cast<size_t>(RendererGeometryTarget::Quad)] = getViewProjection(RendererGeometryTarget::Quad, s_QuadCamera);
+        flush.ViewProjections[static_cast<size_t>(RendererGeometryTarget::Cube)] = getViewProjection(RendererGeometryTarget::Cube, s_CubeCamera);
+        flush.ViewProjections[static_cast<size_t>(RendererGeometryTarget::Line)] = getViewProjection(RendererGeometryTarget::Line, s_LineCamera);
+        flush.ViewProjections[static_cast<size_t>(RendererGeometryTarget::Mesh)] = getViewProjection(RendererGeometryTarget::Mesh, s_QuadCamera);
+
+        for (uint32_t i = 0; i < s_TextureUnits.GetCount(); i++)
+            flush.TextureUnits.push_back(RenderCapture::GetTextureID(s_TextureUnits[i]));
+
+        flush.QuadVertices.assign(s_QuadVertices.begin(), s_QuadVertices.begin() + s_QuadCount * 4);
+        flush.CubeVertices.assign(s_CubeVertices.begin(), s_CubeVertices.begin() + s_CubeCount * 24);
+        flush.LineVertices.assign(s_LineVertices.begin(), s_LineVertices.begin() + s_LineCount * 2);
+
+        for (const auto& draw : s_MeshDraws)
+            flush.MeshDraws.push_back({ RenderCapture::GetMeshID(draw.Source), draw.Transform });
+
+        RenderCapture::OnFlush(flush);
+    }
+
+    void Renderer::CaptureStaticGeometry()
+    {
+        RenderCapture::OnStaticGeometry({ s_StaticQuadVertices, s_StaticQuadIndices, s_StaticCubeVertices, s_StaticCubeIndices });
+    }
+
+    void Renderer::ReplayFlush(const RenderCaptureFlush& flush, const std::vector<std::shared_ptr<Texture>>& textures, const std::vector<std::shared_ptr<Mesh>>& meshes)
+    {
+        PXL_PROFILE_SCOPE;
+
+        if (s_ReplayPending)
+            Flush();
+
+        // Captures from builds with larger batches are cut down to fit
+        s_QuadCount = static_cast<uint32_t>(std::min<size_t>(flush.QuadVertices.size() / 4, k_MaxQuadCount));
+        s_CubeCount = static_cast<uint32_t>(std::min<size_t>(flush.CubeVertices.size() / 24, k_MaxCubeCount));
+        s_LineCount = static_cast<uint32_t>(std::min<size_t>(flush.LineVertices.size() / 2, k_MaxLineCount));
+
+        std::copy_n(flush.QuadVertices.begin(), s_QuadCount * 4, s_QuadVertices.begin());
+        std::copy_n(flush.CubeVertices.begin(), s_CubeCount * 24, s_CubeVertices.begin());
+        std::copy_n(flush.LineVertices.begin(), s_LineCount * 2, s_LineVertices.begin());
+
+        s_TextureUnits.Clear();
+        for (auto id : flush.TextureUnits)
+        {
+            if (!s_TextureUnits.IsFull())
+                s_TextureUnits.GetIndex(textures[id]);
+        }
+
+        s_MeshDraws.clear();
+        for (const auto& draw : flush.MeshDraws)
+        {
+            const auto& mesh = meshes[draw.MeshID];
+
+            CreateMeshBuffers(mesh);
+            s_MeshDraws.push_back({ mesh, draw.Transform });
+        }
+
+        s_ReplayPacket.ViewProjections = flush.ViewProjections;
+        s_RenderingPacket = &s_ReplayPacket;
+        s_ReplayPending = true;
+    }
+
+    void Renderer::ReplayStaticGeometry(const RenderCaptureStaticGeometry& geometry)
+    {
+        s_StaticQuadVertices = geometry.QuadVertices;
+        s_StaticQuadIndices = geometry.QuadIndices;
+        s_StaticCubeVertices = geometry.CubeVertices;
+        s_StaticCubeIndices = geometry.CubeIndices;
+
+        if (!s_StaticQuadVertices.empty() || !s_StaticCubeVertices.empty())
+            StaticGeometryReady();
+    }
+
+    void Renderer::RecordInputLatency(std::chrono::steady_clock::time_point inputTimestamp)
+    {
+        float latency = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - inputTimestamp).count();
+        float average = s_AverageInputLatencyMS.load(std::memory_order_relaxed);
+
+        // Exponential moving average so the value is readable in the GUI
+        average = average == 0.0f ? latency : average + (latency - average) * 0.1f;
+
+        s_InputLatencyMS.store(latency, std::memory_order_relaxed);
+        s_AverageInputLatencyMS.store(average, std::memory_order_relaxed);
+    }
+
+    Renderer::Statistics Renderer::GetLastFrameStats()
+    {
+        std::lock_guard lock(s_StatsMutex);
+        return s_LastFrameStats;
+    }
+
+    float Renderer::GetFPS()
+    {
+        std::lock_guard lock(s_StatsMutex);
+        return s_FrameTiming.FPS;
+    }
+
+    float Renderer::GetFrameTimeMS()
+    {
+        std::lock_guard lock(s_StatsMutex);
+        return s_FrameTiming.FrameTime;
+    }
+
+    FrameTimeHistory Renderer::GetFrameTimeHistory()
+    {
+        std::lock_guard lock(s_FrameTimesMutex);
+        return s_FrameTimes;
+    }
+
+    FrameTimeHistory Renderer::GetGPUFrameTimeHistory()
+    {
+        std::lock_guard lock(s_FrameTimesMutex);
+        return s_GPUFrameTimes;
+    }
+
+    FrameTimeSummary Renderer::GetFrameTimeSummary()
+    {
+        std::lock_guard lock(s_FrameTimesMutex);
+        return s_FrameTimes.GetSummary();
+    }
+
+    FrameTimeSummary Renderer::GetGPUFrameTimeSummary()
+    {
+        std::lock_guard lock(s_FrameTimesMutex);
+        return s_GPUFrameTimes.GetSummary();
+    }
+
     void Renderer::CalculateFPS()
     {
         PXL_PROFILE_SCOPE;
         double currentTime = Platform::GetTime();
-        s_Stats.FrameTime = static_cast<float>(currentTime - s_TimeAtLastFrame) * 1000.0f;
-        s_Stats.FPS = 1000.0f / s_Stats.FrameTime;
+        float frameTime = static_cast<float>(currentTime - s_TimeAtLastFrame) * 1000.0f;
         s_TimeAtLastFrame = currentTime;
+
+        float averageFrameTime = 0.0f;
+        uint32_t stutterCount = 0;
+
+        {
+            std::lock_guard lock(s_FrameTimesMutex);
+            s_FrameTimes.Add(frameTime);
+            averageFrameTime = s_FrameTimes.GetMean();
+            stutterCount = s_FrameTimes.GetStutterCount();
+        }
+
+        // The render thread may be part way through a frame, so the timing is picked up by the next frame's Begin()
+        std::lock_guard lock(s_StatsMutex);
+        s_FrameTiming.FrameTime = frameTime;
+        s_FrameTiming.FPS = 1000.0f / frameTime;
+        s_FrameTiming.AverageFrameTime = averageFrameTime;
+        s_FrameTiming.StutterCount = stutterCount;
     }
 }
\ No newline at end of file
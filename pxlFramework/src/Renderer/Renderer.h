@@ -1,13 +1,21 @@
 #pragma once
 
+#include <atomic>
+
 #include "Camera.h"
 #include "Core/Colour.h"
 #include "Core/Window.h"
+#include "FramePacket.h"
+#include "FrameReadback.h"
+#include "FrameTimeHistory.h"
+#include "Framebuffer.h"
+#include "GPUTimer.h"
 #include "GraphicsContext.h"
 #include "Pipeline.h"
 #include "Primitives/Cube.h"
 #include "Primitives/Line.h"
 #include "Primitives/Quad.h"
+#include "RenderCapture.h"
 #include "RendererAPI.h"
 #include "RendererAPIType.h"
 #include "RendererData.h"
@@ -28,16 +36,53 @@ namespace pxl
     {
     public:
         static void Init(const std::shared_ptr<Window>& window);
+
+        // Initializes the renderer without waiting for the built-in pipelines to finish compiling.
+        // Frames are cleared and presented as normal, but geometry is discarded until ArePipelinesReady() is true.
+        // NOTE: Vulkan compiles on the job system's workers, OpenGL compiles on the main thread between frames since it needs the context.
+        static void InitAsync(const std::shared_ptr<Window>& window);
+
+        // Initializes the renderer without a window, every frame is drawn into an offscreen framebuffer with the given specs instead (see GetRenderTarget()).
+        // OpenGL uses a surfaceless EGL context where possible and Vulkan creates its device without a surface, so no display is needed
+        static void Init(RendererAPIType api, const FramebufferSpecs& targetSpecs);
+
         static void Shutdown();
 
         static bool IsInitialized() { return s_Enabled; }
+        static bool ArePipelinesReady() { return s_PipelinesReady; }
 
         static RendererAPIType GetCurrentAPI() { return s_RendererAPIType; }
         static std::shared_ptr<GraphicsContext> GetGraphicsContext() { return s_ContextHandle; }
 
+        // The framebuffer frames are drawn into when initialized without a window, otherwise nullptr
+        static std::shared_ptr<Framebuffer> GetRenderTarget() { return s_RenderTarget; }
+
+        // Resizes the render target along with the viewport and scissor
+        static void ResizeRenderTarget(uint32_t width, uint32_t height);
+
         static void SetClearColour(const glm::vec4& colour);
         static void SetClearColour(ColourName colour);
 
+        // Reads frames back through a pool of buffers so RequestReadback() never waits on the GPU (see FrameReadbackPool).
+        // More buffers let the GPU and whatever consumes the frames fall further behind before requests are skipped. Returns false if the backend can't read frames back
+        static bool EnableFrameReadback(uint32_t bufferCount = 3);
+        static void DisableFrameReadback();
+        static bool IsFrameReadbackEnabled();
+
+        // Copies the frame being recorded, GUI included, once it has been drawn. Collect it with PollReadback() a few frames later.
+        // Requests made while every buffer is busy are skipped and counted in GetReadbackStats()
+        static void RequestReadback();
+
+        // Takes the oldest frame that has finished reading back, or nullptr if none are ready. Never waits on the GPU and can be called from any thread
+        static std::shared_ptr<ReadbackFrame> PollReadback();
+
+        static FrameReadbackStats GetReadbackStats();
+
+        // Records each geometry target into its own secondary command buffer on a separate thread.
+        // NOTE: Only Vulkan supports this, OpenGL always records on the main thread
+        static void SetParallelRecording(bool value) { s_RendererAPI->SetParallelRecording(value); }
+        static bool IsParallelRecording() { return s_RendererAPI->IsParallelRecording(); }
+
         static void ResizeViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) { s_RendererAPI->SetViewport(x, y, width, height); }
         static void ResizeScissor(uint32_t x, uint32_t y, uint32_t width, uint32_t height) { s_RendererAPI->SetScissor(x, y, width, height); }
 
@@ -64,6 +109,7 @@ namespace pxl
         static void AddLine(const Line& line);
         static void AddLine(const glm::vec3& startPos, const glm::vec3& endPos, const glm::vec3& rotation, const glm::vec4& colour);
 
+        // NOTE: Meshes are drawn when the renderer flushes, before any other geometry
         static void DrawMesh(const std::shared_ptr<Mesh>& mesh, const glm::vec3& position, const glm::vec3& rotation, const glm::vec3& scale);
 
         // Reset the static geometry data of the give GeometryTarget
@@ -81,6 +127,8 @@ namespace pxl
         { // clang-format off
             float FrameTime;
             float FPS;
+            float AverageFrameTime; // Rolling mean over the frame time history
+            uint32_t StutterCount;  // Frames that took over twice the median frame time, since startup
             uint32_t DrawCalls;
             uint32_t QuadCount;
             uint32_t QuadVertexCount;
@@ -96,28 +144,108 @@ namespace pxl
             uint32_t TextureBinds;
             uint32_t PipelineBinds;
 
+            // GPU timings, these lag a few frames behind since the results are only read once the GPU has finished the frame
+            float GPUTime;
+            std::array<float, k_GPUTimerSectionCount> GPUSectionTimes;
+            uint64_t GPUTimingSequence; // Increases when new GPU timings are read back, frames with the same sequence share them
+
+            // CPU time spent recording each section, summed across threads when recording in parallel
+            std::array<float, k_GPUTimerSectionCount> CPUSectionTimes;
+
+            // Accumulates the geometry counts of another set of statistics, the frame timings are left untouched
+            void Add(const Statistics& other)
+            {
+                DrawCalls += other.DrawCalls;
+                QuadCount += other.QuadCount;
+                QuadVertexCount += other.QuadVertexCount;
+                QuadIndexCount += other.QuadIndexCount;
+                CubeCount += other.CubeCount;
+                CubeVertexCount += other.CubeVertexCount;
+                CubeIndexCount += other.CubeIndexCount;
+                LineCount += other.LineCount;
+                LineVertexCount += other.LineVertexCount;
+                MeshCount += other.MeshCount;
+                MeshVertexCount += other.MeshVertexCount;
+                MeshIndexCount += other.MeshIndexCount;
+                TextureBinds += other.TextureBinds;
+                PipelineBinds += other.PipelineBinds;
+
+                for (size_t i = 0; i < k_GPUTimerSectionCount; i++)
+                    CPUSectionTimes[i] += other.CPUSectionTimes[i];
+            }
+
             uint32_t GetTotalTriangleCount() { return (QuadIndexCount / 3) + (CubeIndexCount / 3) + (MeshIndexCount / 3); }
             uint32_t GetTotalVertexCount() { return QuadVertexCount + CubeVertexCount + LineVertexCount + MeshVertexCount; }
             uint32_t GetTotalIndexCount() { return QuadIndexCount + CubeIndexCount + MeshIndexCount; }
+            float GetGPUSectionTime(GPUTimerSection section) const { return GPUSectionTimes[static_cast<size_t>(section)]; }
+            float GetCPUSectionTime(GPUTimerSection section) const { return CPUSectionTimes[static_cast<size_t>(section)]; }
         }; // clang-format on
 
-        // Gets the statistics of the current frame
+        // Gets the statistics of the current frame. These are written while the frame is drawn, so only read them on the thread that renders (eg. from the GUI)
         static const Statistics& GetStats() { return s_Stats; }
 
-        static float GetFPS() { return s_Stats.FPS; }
-        static float GetFrameTimeMS() { return s_Stats.FrameTime; }
+        // Gets the statistics of the last completed frame, since the current frame's counts are reset once it ends. Safe to call from any thread
+        static Statistics GetLastFrameStats();
+
+        // The main thread's frame timing, safe to call from any thread
+        static float GetFPS();
+        static float GetFrameTimeMS();
+
+        // Copies of the most recent CPU frame times, and GPU frame times when GPU timing is supported
+        static FrameTimeHistory GetFrameTimeHistory();
+        static FrameTimeHistory GetGPUFrameTimeHistory();
+
+        // Mean, percentiles and 1% lows of the recent frame times. These sort the history, so avoid calling them more than once a frame
+        static FrameTimeSummary GetFrameTimeSummary();
+        static FrameTimeSummary GetGPUFrameTimeSummary();
+
+        // Time from input being processed to the frame it affected being presented
+        static float GetInputLatencyMS() { return s_InputLatencyMS.load(std::memory_order_relaxed); }
+        static float GetAverageInputLatencyMS() { return s_AverageInputLatencyMS.load(std::memory_order_relaxed); }
+
+        // Builds the model matrix geometry is transformed by. Rotations are in degrees and applied in Y, Z, X order
+        static glm::mat4 CalculateTransform(const glm::vec3& position, const glm::vec3& rotation, const glm::vec3& scale);
 
     private:
         friend class Application;
+        friend class FrameRecorder;
+        friend class RenderThread;
+        friend class RenderCaptureReplayer;
+        static void InitAsync(const std::shared_ptr<GraphicsContext>& context, RendererAPIType api);
+
         static void CalculateFPS();
         static void Begin();
         static void End();
 
         static void Flush();
 
+        static void QueueShaderJob(const std::filesystem::path& path, ShaderStage stage);
+        static void QueuePipelineJob(RendererGeometryTarget target, const GraphicsPipelineSpecs& specs, const std::pair<std::string, std::string>& shaderNames);
+
+        // Moves finished pipeline jobs into use, optionally blocking until all of them are done
+        static void ResolvePipelineJobs(bool wait);
+
         static float GetTextureIndex(const std::shared_ptr<Texture>& texture);
 
-        static glm::mat4 CalculateTransform(const glm::vec3& position, const glm::vec3& rotation, const glm::vec3& scale);
+        // The camera matrix a geometry target is drawn with, taken from the packet being rendered if there is one
+        static glm::mat4 GetViewProjection(RendererGeometryTarget target);
+
+        // Snapshots the camera matrices so the render thread doesn't read cameras the main thread is updating
+        static void CapturePacketCameras(FramePacket& packet);
+
+        // Draws a packet recorded on another thread, from Begin() to End()
+        static void RenderPacket(const FramePacket& packet);
+
+        // Writes what the next flush will draw to the running render capture
+        static void CaptureFlush();
+        static void CaptureStaticGeometry();
+
+        // Loads a captured flush in place of batched geometry. It's drawn by the next replayed flush or by End(), the same as when it was captured
+        static void ReplayFlush(const RenderCaptureFlush& flush, const std::vector<std::shared_ptr<Texture>>& textures, const std::vector<std::shared_ptr<Mesh>>& meshes);
+        static void ReplayStaticGeometry(const RenderCaptureStaticGeometry& geometry);
+
+        // Called once a frame has been presented, may be called from the render thread
+        static void RecordInputLatency(std::chrono::steady_clock::time_point inputTimestamp);
 
         static void ResetStats()
         {
@@ -126,12 +254,24 @@ namespace pxl
 
     private:
         static inline bool s_Enabled = false;
+        static inline bool s_PipelinesReady = false;
+
+        // While set, draw calls on this thread are recorded into the packet rather than batched (see RenderThread)
+        static inline thread_local FramePacket* s_RecordingPacket = nullptr;
+        static inline const FramePacket* s_RenderingPacket = nullptr;
 
         static inline RendererAPIType s_RendererAPIType = RendererAPIType::None;
 
         static inline std::unique_ptr<RendererAPI> s_RendererAPI = nullptr;
 
         static inline std::shared_ptr<GraphicsContext> s_ContextHandle = nullptr;
+        static inline std::shared_ptr<Framebuffer> s_RenderTarget = nullptr;
+
+        // Only replaced on the thread that renders, the mutex guards it against PollReadback() from other threads
+        static inline std::shared_ptr<FrameReadbackPool> s_ReadbackPool = nullptr;
+        static inline std::mutex s_ReadbackMutex;
+        static inline std::atomic<bool> s_ReadbackRequested = false;
+        static inline uint64_t s_FrameNumber = 0;
 
         static inline std::shared_ptr<Camera> s_QuadCamera = nullptr;
         static inline std::shared_ptr<Camera> s_CubeCamera = nullptr;
@@ -141,6 +281,30 @@ namespace pxl
         static inline double s_TimeAtLastFrame = 0.0f;
 
         static inline Statistics s_Stats = {};
+
+        // Guards the last frame's statistics and the frame timing, which are read from both threads when rendering on the render thread
+        static inline std::mutex s_StatsMutex;
+        static inline Statistics s_LastFrameStats = {};
+
+        // Measured on the main thread by CalculateFPS(), then copied into the statistics of each frame as it begins
+        struct FrameTiming
+        {
+            float FrameTime = 0.0f;
+            float FPS = 0.0f;
+            float AverageFrameTime = 0.0f;
+            uint32_t StutterCount = 0;
+        };
+
+        static inline FrameTiming s_FrameTiming = {};
+
+        // CPU frame times are added on the main thread and GPU frame times on the thread that renders, either may be read from the other
+        static inline std::mutex s_FrameTimesMutex;
+        static inline FrameTimeHistory s_FrameTimes;
+        static inline FrameTimeHistory s_GPUFrameTimes;
+        static inline uint64_t s_LastGPUTimingSequence = 0;
+
+        static inline std::atomic<float> s_InputLatencyMS = 0.0f;
+        static inline std::atomic<float> s_AverageInputLatencyMS = 0.0f;
         static inline RendererLimits s_Limits = {};
     };
 }
\ No newline at end of file
@@ -1,17 +1,19 @@
 #include "RendererAPI.h"
 
+#include "Null/NullRenderer.h"
 #include "OpenGL/OpenGLRenderer.h"
 #include "Vulkan/VulkanRenderer.h"
 
 namespace pxl
 {
-    std::unique_ptr<RendererAPI> RendererAPI::Create(RendererAPIType api, const std::shared_ptr<Window>& window)
+    std::unique_ptr<RendererAPI> RendererAPI::Create(RendererAPIType api, const std::shared_ptr<GraphicsContext>& context)
     {
         switch (api)
         {
             case RendererAPIType::None:   break;
             case RendererAPIType::OpenGL: return std::make_unique<OpenGLRenderer>();
-            case RendererAPIType::Vulkan: return std::make_unique<VulkanRenderer>(static_pointer_cast<VulkanGraphicsContext>(window->GetGraphicsContext()));
+            case RendererAPIType::Vulkan: return std::make_unique<VulkanRenderer>(static_pointer_cast<VulkanGraphicsContext>(context));
+            case RendererAPIType::Null:   return std::make_unique<NullRenderer>();
         }
 
         PXL_LOG_ERROR(LogArea::Renderer, "Failed to create RendererAPI");
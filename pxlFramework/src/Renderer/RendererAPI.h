@@ -2,7 +2,10 @@
 
 #include <glm/vec4.hpp>
 
-#include "Core/Window.h"
+#include "FrameReadback.h"
+#include "Framebuffer.h"
+#include "GPUTimer.h"
+#include "GraphicsContext.h"
 #include "RendererAPIType.h"
 
 namespace pxl
@@ -25,6 +28,36 @@ namespace pxl
         virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
         virtual void SetScissor(uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
 
-        static std::unique_ptr<RendererAPI> Create(RendererAPIType api, const std::shared_ptr<Window>& window);
+        // Runs a set of recording tasks, each of which binds and draws one batch of geometry.
+        // The results are always submitted in task order. By default the tasks are simply run in order on the calling thread.
+        virtual void ExecuteRecordTasks(const std::vector<std::function<void()>>& tasks)
+        {
+            for (const auto& task : tasks)
+                task();
+        }
+
+        // How many tasks a workload should be split into to keep every recording thread busy
+        virtual uint32_t GetRecordingConcurrency() const { return 1; }
+
+        virtual void SetParallelRecording([[maybe_unused]] bool value) {}
+        virtual bool IsParallelRecording() const { return false; }
+
+        // Times the GPU work recorded between Begin and End on the calling thread. Timers can't be nested,
+        // and timers for the same section are added together
+        virtual void BeginGPUTimer([[maybe_unused]] GPUTimerSection section) {}
+        virtual void EndGPUTimer() {}
+
+        // The timings of the most recent frame the GPU has finished, which is usually a few frames behind the current one
+        virtual GPUTimings GetGPUTimings() const { return {}; }
+
+        // Draws every following frame into the framebuffer instead of the context's window, and sets the viewport and scissor to cover it.
+        // A null target goes back to drawing to the window
+        virtual void SetRenderTarget([[maybe_unused]] const std::shared_ptr<Framebuffer>& target) {}
+
+        // Creates the buffers frames are read back into. Queued readbacks are copied at the end of EndFrame, whether drawing to a window or a render target.
+        // Returns nullptr if the backend can't read frames back
+        virtual std::shared_ptr<FrameReadbackPool> CreateReadbackPool([[maybe_unused]] uint32_t bufferCount) { return nullptr; }
+
+        static std::unique_ptr<RendererAPI> Create(RendererAPIType api, const std::shared_ptr<GraphicsContext>& context);
     };
 }
\ No newline at end of file
@@ -7,5 +7,6 @@ namespace pxl
         None,
         OpenGL,
         Vulkan,
+        Null, // Does no GPU work, commands are counted by the NullCommandRecorder instead
     };
 }
\ No newline at end of file
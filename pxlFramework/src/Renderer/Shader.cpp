@@ -1,12 +1,13 @@
 #include "Shader.h"
 
+#include "Null/NullShader.h"
 #include "OpenGL/OpenGLShader.h"
 #include "Renderer.h"
 #include "Vulkan/VulkanShader.h"
 
 namespace pxl
 {
-    std::shared_ptr<Shader> Shader::Create(ShaderStage stage, const std::string& glslSrc)
+    std::shared_ptr<Shader> Shader::Create(ShaderStage stage, const std::string& glslSrc, const ShaderCompileOptions& options)
     {
         switch (Renderer::GetCurrentAPI())
         {
@@ -15,10 +16,13 @@ namespace pxl
                 break;
 
             case RendererAPIType::OpenGL:
-                return std::make_shared<OpenGLShader>(stage, glslSrc);
+                return std::make_shared<OpenGLShader>(stage, glslSrc, options);
 
             case RendererAPIType::Vulkan:
-                return std::make_shared<VulkanShader>(stage, glslSrc);
+                return std::make_shared<VulkanShader>(stage, glslSrc, options);
+
+            case RendererAPIType::Null:
+                return std::make_shared<NullShader>(stage);
         }
 
         return nullptr;
@@ -38,6 +42,9 @@ namespace pxl
 
             case RendererAPIType::Vulkan:
                 return std::make_shared<VulkanShader>(stage, sprvBin);
+
+            case RendererAPIType::Null:
+                return std::make_shared<NullShader>(stage);
         }
 
         return nullptr;
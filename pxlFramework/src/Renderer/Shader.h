@@ -10,6 +10,15 @@ namespace pxl
         Tessellation,
     };
 
+    struct ShaderCompileOptions
+    {
+        // Preprocessor macros (name, value) defined before the shader source is compiled
+        std::vector<std::pair<std::string, std::string>> Defines;
+
+        // Run the SPIR-V optimizer when compiling GLSL for Vulkan
+        bool Optimize = false;
+    };
+
     class Shader
     {
     public:
@@ -19,7 +28,7 @@ namespace pxl
 
         virtual ShaderStage GetShaderStage() const = 0;
 
-        static std::shared_ptr<Shader> Create(ShaderStage stage, const std::string& glslSrc);
+        static std::shared_ptr<Shader> Create(ShaderStage stage, const std::string& glslSrc, const ShaderCompileOptions& options = {});
         static std::shared_ptr<Shader> Create(ShaderStage stage, const std::vector<char>& sprvBin);
     };
 }
\ No newline at end of file
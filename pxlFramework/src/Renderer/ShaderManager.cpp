@@ -5,12 +5,13 @@
 namespace pxl
 {
 
-    std::shared_ptr<Shader> ShaderManager::LoadFromGLSL(const std::filesystem::path& path, ShaderStage stage)
+    std::shared_ptr<Shader> ShaderManager::LoadFromGLSL(const std::filesystem::path& path, ShaderStage stage, const ShaderCompileOptions& options)
     {
-        auto shader = Shader::Create(stage, FileSystem::LoadGLSL(path));
+        auto shader = Shader::Create(stage, FileSystem::LoadGLSL(path), options);
 
         PXL_ASSERT(shader);
 
+        std::lock_guard lock(s_CacheMutex);
         s_ShaderCache[path.filename().string()] = shader;
 
         return shader;
@@ -22,6 +23,7 @@ namespace pxl
 
         PXL_ASSERT(shader);
 
+        std::lock_guard lock(s_CacheMutex);
         s_ShaderCache[path.filename().string()] = shader;
 
         return shader;
@@ -29,6 +31,8 @@ namespace pxl
 
     std::shared_ptr<Shader> ShaderManager::Get(const std::string& filename)
     {
+        std::lock_guard lock(s_CacheMutex);
+
         PXL_ASSERT_MSG(s_ShaderCache.contains(filename), "Shader cache doesn't contain shader");
 
         return s_ShaderCache[filename];
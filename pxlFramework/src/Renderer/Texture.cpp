@@ -1,5 +1,6 @@
 #include "Texture.h"
 
+#include "Null/NullTexture.h"
 #include "OpenGL/OpenGLTexture.h"
 #include "Renderer.h"
 
@@ -26,6 +27,9 @@ namespace pxl
             case RendererAPIType::Vulkan:
                 PXL_LOG_ERROR(LogArea::Renderer, "Can't create Texture for Vulkan renderer api.");
                 break;
+
+            case RendererAPIType::Null:
+                return std::make_shared<NullTexture>(image, specs);
         }
 
         return nullptr;
@@ -52,6 +56,9 @@ namespace pxl
             case RendererAPIType::Vulkan:
                 PXL_LOG_ERROR(LogArea::Renderer, "Can't create Texture for Vulkan renderer api.");
                 break;
+
+            case RendererAPIType::Null:
+                return std::make_shared<NullTexture>(image, specs);
         }
 
         return nullptr;
@@ -114,6 +121,9 @@ namespace pxl
             case RendererAPIType::Vulkan:
                 PXL_LOG_ERROR(LogArea::Renderer, "Can't create error Texture for Vulkan renderer api");
                 return nullptr;
+
+            case RendererAPIType::Null:
+                return std::make_shared<NullTexture>(image, specs);
             default:
                 return nullptr;
         }
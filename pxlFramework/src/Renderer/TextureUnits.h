@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Texture.h"
+
+namespace pxl
+{
+    /// @brief The textures used by the current batch, in texture unit order.
+    /// Textures are looked up by pointer so a texture used by many quads only takes one unit
+    class TextureUnits
+    {
+    public:
+        void Resize(uint32_t count) { m_Textures.resize(count, nullptr); }
+
+        // Returns the unit the texture is in, adding it to the next free unit if it isn't in one yet. Check IsFull() first
+        uint32_t GetIndex(const std::shared_ptr<Texture>& texture)
+        {
+            for (uint32_t i = 0; i < m_Count; i++)
+            {
+                if (m_Textures[i] == texture)
+                    return i;
+            }
+
+            PXL_ASSERT_MSG(!IsFull(), "No texture units left for texture");
+
+            m_Textures[m_Count] = texture;
+            return m_Count++;
+        }
+
+        // Makes every unit available again, the textures are kept alive until their unit is reused
+        void Clear() { m_Count = 0; }
+
+        bool IsFull() const { return m_Count >= m_Textures.size(); }
+
+        uint32_t GetCount() const { return m_Count; }
+        uint32_t GetCapacity() const { return static_cast<uint32_t>(m_Textures.size()); }
+
+        const std::shared_ptr<Texture>& operator[](uint32_t unit) const { return m_Textures[unit]; }
+
+    private:
+        std::vector<std::shared_ptr<Texture>> m_Textures;
+        uint32_t m_Count = 0;
+    };
+}
\ No newline at end of file
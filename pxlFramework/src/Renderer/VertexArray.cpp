@@ -1,5 +1,6 @@
 #include "VertexArray.h"
 
+#include "Null/NullVertexArray.h"
 #include "OpenGL/OpenGLVertexArray.h"
 #include "Renderer.h"
 
@@ -17,6 +18,8 @@ namespace pxl
             case RendererAPIType::Vulkan:
                 PXL_LOG_ERROR(LogArea::Renderer, "Can't create Vertex Array for Vulkan renderer api.");
                 return nullptr;
+
+            case RendererAPIType::Null: return std::make_shared<NullVertexArray>();
         }
 
         return nullptr;
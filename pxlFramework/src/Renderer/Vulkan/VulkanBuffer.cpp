@@ -5,6 +5,7 @@
 #include "VulkanContext.h"
 #include "VulkanDevice.h"
 #include "VulkanHelpers.h"
+#include "VulkanRenderer.h"
 
 namespace pxl
 {
@@ -83,9 +84,7 @@ namespace pxl
     {
         PXL_PROFILE_SCOPE;
 
-        auto commandBuffer = std::static_pointer_cast<VulkanGraphicsContext>(Renderer::GetGraphicsContext())->GetSwapchain()->GetCurrentFrame().CommandBuffer;
-
-        m_BindFunc(commandBuffer);
+        m_BindFunc(VulkanRenderer::GetActiveCommandBuffer());
     }
 
     void VulkanBuffer::Bind(VkCommandBuffer commandBuffer)
@@ -23,8 +23,60 @@ namespace pxl
             m_Surface = VK_NULL_HANDLE;
         });
 
+        CreateDevice();
+
+        // Get swapchain suitable surface format (for renderpass)
+        auto surfaceFormats = VulkanHelpers::GetSurfaceFormats(m_Device->GetVkPhysical(), m_Surface);
+        m_SurfaceFormat = VulkanHelpers::GetSuitableSurfaceFormat(surfaceFormats);
+
+        // TODO: See what I can do about this
+        // Create default render pass for swapchain framebuffers
+        m_DefaultRenderPass = std::make_shared<VulkanRenderPass>(m_Device, m_SurfaceFormat.format); // should get the format of the swapchain not the surface
+
+        // Create swap chain
+        VkExtent2D swapchainExtent = {};
+        swapchainExtent.width = window->GetFramebufferSize().Width;
+        swapchainExtent.height = window->GetFramebufferSize().Height;
+        m_Swapchain = std::make_shared<VulkanSwapchain>(m_Device, m_Surface, m_SurfaceFormat, swapchainExtent, m_DefaultRenderPass);
+    }
+
+    VulkanGraphicsContext::VulkanGraphicsContext(const FramebufferSpecs& targetSpecs)
+    {
+        // There's no window to query surface extensions from, and none are needed without a surface
+        VulkanInstance::InitDefault({});
+
+        PXL_ASSERT(VulkanInstance::Get());
+
+        CreateDevice();
+
+        PXL_ASSERT_MSG(m_Device, "Failed to create a Vulkan device for headless rendering");
+
+        m_DefaultRenderPass = GetOffscreenRenderPass(targetSpecs.DepthAttachment);
+    }
+
+    void VulkanGraphicsContext::Present()
+    {
+        PXL_PROFILE_SCOPE;
+
+        // Headless frames stay in the render target
+        if (m_Swapchain)
+            m_Swapchain->QueuePresent();
+    }
+
+    std::shared_ptr<VulkanRenderPass> VulkanGraphicsContext::GetOffscreenRenderPass(bool depthAttachment)
+    {
+        auto& renderPass = m_OffscreenRenderPasses[depthAttachment ? 1 : 0];
+
+        if (!renderPass)
+            renderPass = std::make_shared<VulkanRenderPass>(m_Device, k_OffscreenColourFormat, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, depthAttachment ? k_OffscreenDepthFormat : VK_FORMAT_UNDEFINED);
+
+        return renderPass;
+    }
+
+    void VulkanGraphicsContext::CreateDevice()
+    {
         // Get available physical devices
-        auto physicalDevices = VulkanHelpers::GetAvailablePhysicalDevices(vulkanInstance);
+        auto physicalDevices = VulkanHelpers::GetAvailablePhysicalDevices(VulkanInstance::Get());
 
         if (physicalDevices.empty())
         {
@@ -45,27 +97,7 @@ namespace pxl
         }
 
         // Create Logical Device for selected Physical Device
+        // NOTE: The surface is null for headless contexts
         m_Device = std::make_shared<VulkanDevice>(selectedGPU, m_Surface);
-
-        // Get swapchain suitable surface format (for renderpass)
-        auto surfaceFormats = VulkanHelpers::GetSurfaceFormats(selectedGPU, m_Surface);
-        m_SurfaceFormat = VulkanHelpers::GetSuitableSurfaceFormat(surfaceFormats);
-
-        // TODO: See what I can do about this
-        // Create default render pass for swapchain framebuffers
-        m_DefaultRenderPass = std::make_shared<VulkanRenderPass>(m_Device, m_SurfaceFormat.format); // should get the format of the swapchain not the surface
-
-        // Create swap chain
-        VkExtent2D swapchainExtent = {};
-        swapchainExtent.width = window->GetFramebufferSize().Width;
-        swapchainExtent.height = window->GetFramebufferSize().Height;
-        m_Swapchain = std::make_shared<VulkanSwapchain>(m_Device, m_Surface, m_SurfaceFormat, swapchainExtent, m_DefaultRenderPass);
-    }
-
-    void VulkanGraphicsContext::Present()
-    {
-        PXL_PROFILE_SCOPE;
-
-        m_Swapchain->QueuePresent();
     }
 }
\ No newline at end of file
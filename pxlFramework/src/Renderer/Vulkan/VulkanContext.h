@@ -3,6 +3,7 @@
 #include <volk/volk.h>
 
 #include "Core/Window.h"
+#include "Renderer/Framebuffer.h"
 #include "Renderer/GraphicsContext.h"
 #include "VulkanDevice.h"
 #include "VulkanHelpers.h"
@@ -16,18 +17,32 @@ namespace pxl
     public:
         VulkanGraphicsContext(const std::shared_ptr<Window>& window);
 
+        // Creates a context without a surface or swapchain, its default render pass draws into offscreen framebuffers with the given attachments
+        VulkanGraphicsContext(const FramebufferSpecs& targetSpecs);
+
         virtual void Present() override;
 
-        virtual bool GetVSync() const override { return m_Swapchain->GetVSync(); }
+        virtual bool GetVSync() const override { return m_Swapchain ? m_Swapchain->GetVSync() : false; }
         virtual void SetVSync(bool value) override
         {
+            if (!m_Swapchain)
+                return;
+
             m_Swapchain->SetVSync(value);
             m_Swapchain->Invalidate();
         }
-        virtual void ToggleVSync() { SetVSync(!m_Swapchain->GetVSync()); }
+        virtual void ToggleVSync() { SetVSync(!GetVSync()); }
 
         virtual void SetAsCurrent() override {};
 
+        virtual void WaitForPreviousFrame() override
+        {
+            if (m_Swapchain)
+                m_Swapchain->WaitForPreviousFrame();
+            else
+                m_Device->QueueWaitIdle(QueueType::Graphics);
+        }
+
         virtual std::shared_ptr<GraphicsDevice> GetDevice() const override { return m_Device; }
 
         virtual RendererLimits GetLimits() override { return RendererLimits(); }
@@ -35,11 +50,21 @@ namespace pxl
         VkSurfaceKHR GetSurface() const { return m_Surface; }
         VkSurfaceFormatKHR GetSurfaceFormat() const { return m_SurfaceFormat; }
 
+        // Headless contexts have no swapchain
         std::shared_ptr<VulkanSwapchain> GetSwapchain() const { return m_Swapchain; }
 
         // TODO: move
         std::shared_ptr<VulkanRenderPass> GetDefaultRenderPass() const { return m_DefaultRenderPass; } // Geometry Render Pass?
 
+        // The render pass offscreen framebuffers are drawn with, created the first time it's needed
+        std::shared_ptr<VulkanRenderPass> GetOffscreenRenderPass(bool depthAttachment);
+
+        static constexpr VkFormat k_OffscreenColourFormat = VK_FORMAT_R8G8B8A8_UNORM;
+        static constexpr VkFormat k_OffscreenDepthFormat = VK_FORMAT_D32_SFLOAT;
+
+    private:
+        void CreateDevice();
+
     private:
         std::shared_ptr<VulkanDevice> m_Device = nullptr;
         std::shared_ptr<VulkanSwapchain> m_Swapchain = nullptr;
@@ -49,5 +74,8 @@ namespace pxl
 
         // IDK
         std::shared_ptr<VulkanRenderPass> m_DefaultRenderPass = nullptr; // TODO: move this to VulkanRendererAPI
+
+        // With and without a depth attachment
+        std::array<std::shared_ptr<VulkanRenderPass>, 2> m_OffscreenRenderPasses = {};
     };
 }
\ No newline at end of file
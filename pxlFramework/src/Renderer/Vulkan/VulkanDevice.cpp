@@ -2,6 +2,7 @@
 
 #include <volk/volk.h>
 
+#include "Core/Config.h"
 #include "VulkanHelpers.h"
 
 namespace pxl
@@ -14,10 +15,21 @@ namespace pxl
 
         m_GraphicsQueueFamily = VulkanHelpers::GetSuitableGraphicsQueueFamily(queueFamilies, physicalDevice, surface);
 
+        // Prefer dedicated compute/transfer families so their work can overlap with rendering
+        m_ComputeQueueFamily = VulkanHelpers::GetDedicatedComputeQueueFamily(queueFamilies);
+        m_TransferQueueFamily = VulkanHelpers::GetDedicatedTransferQueueFamily(queueFamilies);
+
+        // Graphics queue families always support compute and transfer operations
+        if (!m_ComputeQueueFamily.has_value())
+            m_ComputeQueueFamily = m_GraphicsQueueFamily;
+
+        if (!m_TransferQueueFamily.has_value())
+            m_TransferQueueFamily = m_ComputeQueueFamily;
+
         // TODO: Evaluate compatible gpu features
 
         // Create the logical device
-        CreateLogicalDevice(m_PhysicalDevice);
+        CreateLogicalDevice(m_PhysicalDevice, surface != VK_NULL_HANDLE);
 
         VulkanDeletionQueue::Add([&]()
         {
@@ -29,21 +41,50 @@ namespace pxl
         // NOTE: Currently, this assumes that only one global device is used for the application.
         volkLoadDevice(m_LogicalDevice);
 
-        // Get graphics/present queue from device
+        // Load the pipeline cache from disk, it's saved again on shutdown
+        m_PipelineCache = std::make_unique<VulkanPipelineCache>(m_LogicalDevice, m_PhysicalDevice, FrameworkConfig::GetCacheDirectory());
+
+        VulkanDeletionQueue::Add([&]()
+        {
+            m_PipelineCache->Save();
+            m_PipelineCache->Destroy();
+        });
+
+        // Get queues from device
         m_GraphicsQueue = VulkanHelpers::GetQueueHandle(m_LogicalDevice, m_GraphicsQueueFamily);
+        m_ComputeQueue = VulkanHelpers::GetQueueHandle(m_LogicalDevice, m_ComputeQueueFamily);
+        m_TransferQueue = VulkanHelpers::GetQueueHandle(m_LogicalDevice, m_TransferQueueFamily);
+
+        // Create a command pool for each unique queue family
+        m_GraphicsCommandPool = CreateCommandPool(m_GraphicsQueueFamily.value());
 
-        // Create graphics command pool
+        m_ComputeCommandPool = HasDedicatedComputeQueue() ? CreateCommandPool(m_ComputeQueueFamily.value()) : m_GraphicsCommandPool;
+
+        if (m_TransferQueueFamily == m_GraphicsQueueFamily)
+            m_TransferCommandPool = m_GraphicsCommandPool;
+        else if (m_TransferQueueFamily == m_ComputeQueueFamily)
+            m_TransferCommandPool = m_ComputeCommandPool;
+        else
+            m_TransferCommandPool = CreateCommandPool(m_TransferQueueFamily.value());
+
+        PXL_LOG_INFO(LogArea::Vulkan, "Queue families - Graphics: {}, Compute: {}, Transfer: {}", m_GraphicsQueueFamily.value(), m_ComputeQueueFamily.value(), m_TransferQueueFamily.value());
+    }
+
+    VkCommandPool VulkanDevice::CreateCommandPool(uint32_t queueFamily)
+    {
         VkCommandPoolCreateInfo commandPoolInfo = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
         commandPoolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-        commandPoolInfo.queueFamilyIndex = m_GraphicsQueueFamily.value();
+        commandPoolInfo.queueFamilyIndex = queueFamily;
 
-        VK_CHECK(vkCreateCommandPool(m_LogicalDevice, &commandPoolInfo, nullptr, &m_GraphicsCommandPool));
+        VkCommandPool commandPool = VK_NULL_HANDLE;
+        VK_CHECK(vkCreateCommandPool(m_LogicalDevice, &commandPoolInfo, nullptr, &commandPool));
 
-        VulkanDeletionQueue::Add([&]()
+        VulkanDeletionQueue::Add([this, commandPool]()
         {
-            vkDestroyCommandPool(m_LogicalDevice, m_GraphicsCommandPool, nullptr);
-            m_GraphicsCommandPool = VK_NULL_HANDLE;
+            vkDestroyCommandPool(m_LogicalDevice, commandPool, nullptr);
         });
+
+        return commandPool;
     }
 
     std::vector<VkCommandBuffer> VulkanDevice::AllocateCommandBuffers(QueueType queueType, VkCommandBufferLevel level, uint32_t count)
@@ -75,7 +116,27 @@ namespace pxl
 
         auto queue = GetQueueFromQueueType(queueType);
 
-        VK_CHECK(vkQueueSubmit(queue, 1, submitInfos.data(), signalFence));
+        VK_CHECK(vkQueueSubmit(queue, static_cast<uint32_t>(submitInfos.size()), submitInfos.data(), signalFence));
+    }
+
+    void VulkanDevice::SubmitCommandBuffers(const std::vector<VkCommandBuffer>& commandBuffers, QueueType queueType,
+        const std::vector<VkSemaphore>& waitSemaphores, const std::vector<VkPipelineStageFlags>& waitStages,
+        const std::vector<VkSemaphore>& signalSemaphores, VkFence signalFence)
+    {
+        PXL_PROFILE_SCOPE;
+
+        PXL_ASSERT_MSG(waitSemaphores.size() == waitStages.size(), "Each wait semaphore must have a corresponding wait stage");
+
+        VkSubmitInfo submitInfo = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+        submitInfo.commandBufferCount = static_cast<uint32_t>(commandBuffers.size());
+        submitInfo.pCommandBuffers = commandBuffers.data();
+        submitInfo.waitSemaphoreCount = static_cast<uint32_t>(waitSemaphores.size());
+        submitInfo.pWaitSemaphores = waitSemaphores.data();
+        submitInfo.pWaitDstStageMask = waitStages.data();
+        submitInfo.signalSemaphoreCount = static_cast<uint32_t>(signalSemaphores.size());
+        submitInfo.pSignalSemaphores = signalSemaphores.data();
+
+        SubmitCommandBuffer(submitInfo, queueType, signalFence);
     }
 
     VkResult VulkanDevice::SubmitPresent(const VkPresentInfoKHR& presentInfo)
@@ -85,24 +146,35 @@ namespace pxl
         return vkQueuePresentKHR(m_GraphicsQueue, &presentInfo);
     }
 
-    void VulkanDevice::CreateLogicalDevice(VkPhysicalDevice gpu)
+    void VulkanDevice::CreateLogicalDevice(VkPhysicalDevice gpu, bool presentable)
     {
         PXL_ASSERT_MSG(gpu != VK_NULL_HANDLE, "Failed to create logical device, physical device was null")
 
         // Specify Device Queue Create Infos
         std::vector<VkDeviceQueueCreateInfo> queueInfos;
 
-        if (m_GraphicsQueueFamily.has_value())
+        // Each queue family may only appear once, so fallback families are skipped
+        float queuePriority = 1.0f;
+        std::vector<uint32_t> uniqueQueueFamilies;
+
+        for (const auto& queueFamily : { m_GraphicsQueueFamily, m_ComputeQueueFamily, m_TransferQueueFamily })
         {
-            float queuePriority = 1.0f;
-            VkDeviceQueueCreateInfo graphicsQueueCreateInfo = { VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO };
-            graphicsQueueCreateInfo.queueFamilyIndex = m_GraphicsQueueFamily.value();
-            graphicsQueueCreateInfo.queueCount = 1;
-            graphicsQueueCreateInfo.pQueuePriorities = &queuePriority;
-            queueInfos.push_back(graphicsQueueCreateInfo);
+            if (!queueFamily.has_value() || std::find(uniqueQueueFamilies.begin(), uniqueQueueFamilies.end(), queueFamily.value()) != uniqueQueueFamilies.end())
+                continue;
+
+            uniqueQueueFamilies.push_back(queueFamily.value());
+
+            VkDeviceQueueCreateInfo queueCreateInfo = { VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO };
+            queueCreateInfo.queueFamilyIndex = queueFamily.value();
+            queueCreateInfo.queueCount = 1;
+            queueCreateInfo.pQueuePriorities = &queuePriority;
+            queueInfos.push_back(queueCreateInfo);
         }
 
-        std::vector<const char*> deviceExtensions = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
+        // Headless devices have no swapchain, and software or compute-only drivers may not support it
+        std::vector<const char*> deviceExtensions;
+        if (presentable)
+            deviceExtensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
 
         auto availableExtensions = VulkanHelpers::GetDeviceExtensions(m_PhysicalDevice);
 
@@ -167,7 +239,8 @@ namespace pxl
         switch (type)
         {
             case QueueType::Graphics: return m_GraphicsQueue;
-            case QueueType::Compute:  PXL_LOG_ERROR(LogArea::Vulkan, "Compute queues are unsupported");
+            case QueueType::Compute:  return m_ComputeQueue;
+            case QueueType::Transfer: return m_TransferQueue;
         }
 
         return VK_NULL_HANDLE;
@@ -178,12 +251,25 @@ namespace pxl
         switch (type)
         {
             case QueueType::Graphics: return m_GraphicsCommandPool;
-            case QueueType::Compute:  PXL_LOG_ERROR(LogArea::Vulkan, "Compute command pools are unsupported");
+            case QueueType::Compute:  return m_ComputeCommandPool;
+            case QueueType::Transfer: return m_TransferCommandPool;
         }
 
         return VK_NULL_HANDLE;
     }
 
+    uint32_t VulkanDevice::GetQueueFamily(QueueType type) const
+    {
+        switch (type)
+        {
+            case QueueType::Graphics: return m_GraphicsQueueFamily.value();
+            case QueueType::Compute:  return m_ComputeQueueFamily.value();
+            case QueueType::Transfer: return m_TransferQueueFamily.value();
+        }
+
+        return 0;
+    }
+
     void VulkanDevice::LogDeviceLimits()
     {
         VkPhysicalDeviceProperties properties;
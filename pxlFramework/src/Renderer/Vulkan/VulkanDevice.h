@@ -4,12 +4,14 @@
 
 #include "Renderer/GraphicsDevice.h"
 #include "VulkanHelpers.h"
+#include "VulkanPipelineCache.h"
 
 namespace pxl
 {
     class VulkanDevice : public GraphicsDevice
     {
     public:
+        // A null surface creates a device without presentation support, which can only render offscreen
         VulkanDevice(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface);
 
         virtual void* GetLogical() const override { return m_LogicalDevice; }
@@ -20,18 +22,41 @@ namespace pxl
 
         virtual const GraphicsDeviceLimits& GetLimits() const override { return m_DeviceLimits; }
 
+        // Creates a command pool for the queue family, it's destroyed with the device
+        VkCommandPool CreateCommandPool(uint32_t queueFamily);
+
         std::vector<VkCommandBuffer> AllocateCommandBuffers(QueueType queueType, VkCommandBufferLevel level, uint32_t count);
 
         void SubmitCommandBuffer(const VkSubmitInfo& submitInfo, QueueType queueType, VkFence signalFence = VK_NULL_HANDLE);
         void SubmitCommandBuffers(const std::vector<VkSubmitInfo>& submitInfos, QueueType queueType, VkFence signalFence);
 
+        /// @brief Submits command buffers to a queue, waiting on and signalling the specified semaphores.
+        /// Use this to synchronise work between queues, e.g. a transfer upload that the graphics queue depends on
+        /// @param waitStages The pipeline stage each wait semaphore blocks, must match waitSemaphores in size
+        void SubmitCommandBuffers(const std::vector<VkCommandBuffer>& commandBuffers, QueueType queueType,
+            const std::vector<VkSemaphore>& waitSemaphores, const std::vector<VkPipelineStageFlags>& waitStages,
+            const std::vector<VkSemaphore>& signalSemaphores, VkFence signalFence = VK_NULL_HANDLE);
+
         VkResult SubmitPresent(const VkPresentInfoKHR& presentInfo);
 
         VkQueue GetGraphicsQueue() const { return m_GraphicsQueue; }
-        VkQueue GetComputeQueue() const { return VK_NULL_HANDLE; }
+        VkQueue GetComputeQueue() const { return m_ComputeQueue; }
+        VkQueue GetTransferQueue() const { return m_TransferQueue; }
 
         uint32_t GetGraphicsQueueFamily() const { return m_GraphicsQueueFamily.value(); }
-        uint32_t GetComputeQueueFamily() const { return 0; }
+        uint32_t GetComputeQueueFamily() const { return m_ComputeQueueFamily.value(); }
+        uint32_t GetTransferQueueFamily() const { return m_TransferQueueFamily.value(); }
+
+        uint32_t GetQueueFamily(QueueType type) const;
+
+        // Whether the queue type is backed by its own queue family rather than falling back to the graphics queue.
+        // Transfers fall back to the compute family first, which doesn't count as dedicated either
+        bool HasDedicatedComputeQueue() const { return m_ComputeQueueFamily != m_GraphicsQueueFamily; }
+        bool HasDedicatedTransferQueue() const { return m_TransferQueueFamily != m_GraphicsQueueFamily && m_TransferQueueFamily != m_ComputeQueueFamily; }
+
+        // All pipeline creation should go through this cache so it persists between runs
+        VkPipelineCache GetPipelineCache() const { return m_PipelineCache->GetVKPipelineCache(); }
+        bool IsPipelineCacheWarm() const { return m_PipelineCache->IsWarm(); }
 
         VkDevice GetVkLogical() const { return m_LogicalDevice; }
         VkPhysicalDevice GetVkPhysical() const { return m_PhysicalDevice; }
@@ -39,7 +64,7 @@ namespace pxl
         void LogDeviceLimits(); // could be CheckDeviceLimits later so I can ensure correct device compatibility
 
     private:
-        void CreateLogicalDevice(VkPhysicalDevice gpu);
+        void CreateLogicalDevice(VkPhysicalDevice gpu, bool presentable);
 
         VkQueue GetQueueFromQueueType(QueueType type) const;
         VkCommandPool GetCommandPoolFromQueueType(QueueType type) const;
@@ -50,13 +75,20 @@ namespace pxl
 
         GraphicsDeviceLimits m_DeviceLimits = {};
 
+        std::unique_ptr<VulkanPipelineCache> m_PipelineCache = nullptr;
+
+        // NOTE: Compute and transfer fall back to the graphics family if the device has no dedicated families
         std::optional<uint32_t> m_GraphicsQueueFamily;
-        std::optional<uint32_t> m_ComputeQueueFamily; // TODO: unused
+        std::optional<uint32_t> m_ComputeQueueFamily;
+        std::optional<uint32_t> m_TransferQueueFamily;
 
         VkQueue m_GraphicsQueue = VK_NULL_HANDLE;
-        VkQueue m_ComputeQueue = VK_NULL_HANDLE; // TODO: unused
+        VkQueue m_ComputeQueue = VK_NULL_HANDLE;
+        VkQueue m_TransferQueue = VK_NULL_HANDLE;
 
+        // Command pools are per queue family, so fallback queue types share the graphics pool
         VkCommandPool m_GraphicsCommandPool = VK_NULL_HANDLE;
-        VkCommandPool m_ComputeCommandPool = VK_NULL_HANDLE; // TODO: unused
+        VkCommandPool m_ComputeCommandPool = VK_NULL_HANDLE;
+        VkCommandPool m_TransferCommandPool = VK_NULL_HANDLE;
     };
 }
@@ -0,0 +1,164 @@
+#include "VulkanFrameReadback.h"
+
+#include "VulkanAllocator.h"
+#include "VulkanHelpers.h"
+
+namespace pxl
+{
+    VulkanFrameReadbackPool::VulkanFrameReadbackPool(const std::shared_ptr<VulkanDevice>& device, uint32_t bufferCount)
+        : FrameReadbackPool(bufferCount), m_Device(device)
+    {
+        m_Buffers.resize(bufferCount);
+
+        for (auto& buffer : m_Buffers)
+            buffer.Fence = VulkanHelpers::CreateFence(m_Device->GetVkLogical());
+    }
+
+    VulkanFrameReadbackPool::~VulkanFrameReadbackPool()
+    {
+        // Copies may still be in flight
+        m_Device->QueueWaitIdle(QueueType::Graphics);
+
+        for (auto& buffer : m_Buffers)
+        {
+            if (buffer.Buffer.Buffer)
+                buffer.Buffer.Destroy();
+
+            vkDestroyFence(m_Device->GetVkLogical(), buffer.Fence, nullptr);
+        }
+    }
+
+    void VulkanFrameReadbackPool::RecordCopy(VkCommandBuffer commandBuffer, VkImage image, VkFormat format, VkExtent2D extent, VkImageLayout layout)
+    {
+        PXL_PROFILE_SCOPE;
+
+        auto index = TakeQueuedBuffer();
+
+        if (!index)
+            return;
+
+        auto pixelFormat = GetPixelFormat(format);
+        PXL_ASSERT_MSG(pixelFormat, "Frames can only be read back from 8 bit RGBA and BGRA images");
+
+        auto& buffer = m_Buffers[*index];
+        Reserve(buffer, static_cast<size_t>(extent.width) * extent.height * 4);
+
+        // Swapchain images are left ready to present, so they have to be moved into a layout that can be copied from and back again
+        bool transition = layout != VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+
+        VkImageMemoryBarrier imageBarrier = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+        imageBarrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+        imageBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        imageBarrier.oldLayout = layout;
+        imageBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        imageBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        imageBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        imageBarrier.image = image;
+        imageBarrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &imageBarrier);
+
+        // Rows are tightly packed
+        VkBufferImageCopy region = {};
+        region.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+        region.imageOffset = { 0, 0, 0 };
+        region.imageExtent = { extent.width, extent.height, 1 };
+
+        vkCmdCopyImageToBuffer(commandBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, buffer.Buffer.Buffer, 1, &region);
+
+        if (transition)
+        {
+            // Presentation waits on the frame's semaphore, so nothing else has to wait on this
+            imageBarrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+            imageBarrier.dstAccessMask = 0;
+            imageBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            imageBarrier.newLayout = layout;
+
+            vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1, &imageBarrier);
+        }
+
+        VkBufferMemoryBarrier bufferBarrier = { VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER };
+        bufferBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        bufferBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+        bufferBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        bufferBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        bufferBarrier.buffer = buffer.Buffer.Buffer;
+        bufferBarrier.offset = 0;
+        bufferBarrier.size = VK_WHOLE_SIZE;
+
+        vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &bufferBarrier, 0, nullptr);
+
+        // The image's rows are top to bottom since the renderer flips the viewport to match OpenGL
+        m_Copies[*index] = { static_cast<const uint8_t*>(buffer.Buffer.AllocInfo.pMappedData), Size2D(extent.width, extent.height), pixelFormat.value(), true };
+        m_RecordedBuffer = index;
+    }
+
+    void VulkanFrameReadbackPool::SubmitFence()
+    {
+        if (!m_RecordedBuffer)
+            return;
+
+        auto& buffer = m_Buffers[*m_RecordedBuffer];
+        m_RecordedBuffer.reset();
+
+        // Submissions to a queue complete in order, so an empty submit after the frame signals once the copy is done
+        VkSubmitInfo submitInfo = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+        m_Device->SubmitCommandBuffer(submitInfo, QueueType::Graphics, buffer.Fence);
+    }
+
+    bool VulkanFrameReadbackPool::IsCopyFinished(uint32_t index)
+    {
+        auto& buffer = m_Buffers[index];
+        auto device = m_Device->GetVkLogical();
+
+        if (vkGetFenceStatus(device, buffer.Fence) != VK_SUCCESS)
+            return false;
+
+        VK_CHECK(vkResetFences(device, 1, &buffer.Fence));
+
+        // Host visible memory isn't always coherent
+        VK_CHECK(vmaInvalidateAllocation(VulkanAllocator::Get(), buffer.Buffer.Allocation, 0, VK_WHOLE_SIZE));
+
+        return true;
+    }
+
+    std::optional<ReadbackPixelFormat> VulkanFrameReadbackPool::GetPixelFormat(VkFormat format)
+    {
+        switch (format)
+        {
+            case VK_FORMAT_R8G8B8A8_UNORM:
+            case VK_FORMAT_R8G8B8A8_SRGB:
+                return ReadbackPixelFormat::RGBA8;
+
+            case VK_FORMAT_B8G8R8A8_UNORM:
+            case VK_FORMAT_B8G8R8A8_SRGB:
+                return ReadbackPixelFormat::BGRA8;
+
+            default:
+                return std::nullopt;
+        }
+    }
+
+    void VulkanFrameReadbackPool::Reserve(ReadbackBuffer& buffer, size_t size)
+    {
+        if (buffer.Capacity >= size)
+            return;
+
+        // The buffer's last copy has already finished, since it was free to be queued
+        if (buffer.Buffer.Buffer)
+            buffer.Buffer.Destroy();
+
+        VkBufferCreateInfo bufferInfo = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+        bufferInfo.size = static_cast<VkDeviceSize>(size);
+        bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        // Random access prefers cached memory, which is much faster for the CPU to read than write combined memory
+        VmaAllocationCreateInfo allocInfo = {};
+        allocInfo.usage = VMA_MEMORY_USAGE_AUTO;
+        allocInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+
+        VK_CHECK(vmaCreateBuffer(VulkanAllocator::Get(), &bufferInfo, &allocInfo, &buffer.Buffer.Buffer, &buffer.Buffer.Allocation, &buffer.Buffer.AllocInfo));
+        buffer.Capacity = size;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <volk/volk.h>
+
+#include "Renderer/FrameReadback.h"
+#include "VulkanBuffer.h"
+#include "VulkanDevice.h"
+
+namespace pxl
+{
+    /// @brief Reads frames back into persistently mapped host visible buffers. The copy is recorded at the end of the frame's command buffer,
+    /// and each buffer has its own fence, signalled by an empty submit after the frame, since frame fences are reset as soon as the frame is reused
+    class VulkanFrameReadbackPool : public FrameReadbackPool
+    {
+    public:
+        VulkanFrameReadbackPool(const std::shared_ptr<VulkanDevice>& device, uint32_t bufferCount);
+        virtual ~VulkanFrameReadbackPool() override;
+
+        // Records a copy of the image into the queued buffer, if there is one. Must be recorded outside the render pass,
+        // with the image in the layout the render pass left it in (which it's left in again afterwards)
+        void RecordCopy(VkCommandBuffer commandBuffer, VkImage image, VkFormat format, VkExtent2D extent, VkImageLayout layout);
+
+        // Signals the fence of the copy recorded this frame, call once the frame's command buffer has been submitted
+        void SubmitFence();
+
+        // The format the pixels of an image are read back as, if it can be read back at all
+        static std::optional<ReadbackPixelFormat> GetPixelFormat(VkFormat format);
+
+    protected:
+        virtual bool IsCopyFinished(uint32_t buffer) override;
+
+    private:
+        struct ReadbackBuffer
+        {
+            VulkanStagingBuffer Buffer = {};
+            VkFence Fence = VK_NULL_HANDLE;
+            size_t Capacity = 0;
+        };
+
+        // Recreates the buffer if the frame has grown since it was last used
+        void Reserve(ReadbackBuffer& buffer, size_t size);
+
+    private:
+        std::shared_ptr<VulkanDevice> m_Device = nullptr;
+
+        std::vector<ReadbackBuffer> m_Buffers;
+        std::optional<uint32_t> m_RecordedBuffer;
+    };
+}
\ No newline at end of file
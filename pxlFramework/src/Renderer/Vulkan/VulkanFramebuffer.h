@@ -2,7 +2,6 @@
 
 #include <volk/volk.h>
 
-#include "Renderer/Framebuffer.h"
 #include "VulkanRenderPass.h"
 
 namespace pxl
@@ -14,7 +13,8 @@ namespace pxl
         VkFormat Format;
     };
 
-    class VulkanFramebuffer : public Framebuffer
+    // Wraps a VkFramebuffer around existing image views, see VulkanOffscreenFramebuffer for a framebuffer that owns its attachments
+    class VulkanFramebuffer
     {
     public:
         VulkanFramebuffer(const std::shared_ptr<VulkanDevice>& device, const std::shared_ptr<VulkanRenderPass>& renderPass, VkExtent2D extent);
@@ -22,7 +22,7 @@ namespace pxl
 
         void Destroy();
 
-        virtual void Resize(uint32_t width, uint32_t height) override
+        void Resize(uint32_t width, uint32_t height)
         {
             m_Extent.width = width;
             m_Extent.height = height;
@@ -137,9 +137,10 @@ namespace pxl
             // Find suitable graphics queue family
             if ((queueFamilies[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) != 0 && !foundGraphicsQueue)
             {
-                // Check if this graphics queue family supports presentation to a surface
-                VkBool32 surfaceSupport;
-                vkGetPhysicalDeviceSurfaceSupportKHR(gpu, i, surface, &surfaceSupport);
+                // Check if this graphics queue family supports presentation to a surface, any graphics family will do without one
+                VkBool32 surfaceSupport = VK_TRUE;
+                if (surface)
+                    vkGetPhysicalDeviceSurfaceSupportKHR(gpu, i, surface, &surfaceSupport);
 
                 if (surfaceSupport == VK_TRUE)
                 {
@@ -162,6 +163,40 @@ namespace pxl
         return graphicsQueueIndex;
     }
 
+    std::optional<uint32_t> VulkanHelpers::GetDedicatedComputeQueueFamily(const std::vector<VkQueueFamilyProperties>& queueFamilies)
+    {
+        // An async compute family supports compute but not graphics, so work submitted to it can overlap with rendering
+        for (uint32_t i = 0; i < queueFamilies.size(); i++)
+        {
+            auto flags = queueFamilies[i].queueFlags;
+            if ((flags & VK_QUEUE_COMPUTE_BIT) != 0 && (flags & VK_QUEUE_GRAPHICS_BIT) == 0)
+            {
+                PXL_LOG_INFO(LogArea::Vulkan, "Found dedicated compute queue family {}", i);
+                return i;
+            }
+        }
+
+        PXL_LOG_INFO(LogArea::Vulkan, "Physical device has no dedicated compute queue family");
+        return std::nullopt;
+    }
+
+    std::optional<uint32_t> VulkanHelpers::GetDedicatedTransferQueueFamily(const std::vector<VkQueueFamilyProperties>& queueFamilies)
+    {
+        // A transfer-only family is usually backed by the GPU's copy/DMA engines
+        for (uint32_t i = 0; i < queueFamilies.size(); i++)
+        {
+            auto flags = queueFamilies[i].queueFlags;
+            if ((flags & VK_QUEUE_TRANSFER_BIT) != 0 && (flags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) == 0)
+            {
+                PXL_LOG_INFO(LogArea::Vulkan, "Found dedicated transfer queue family {}", i);
+                return i;
+            }
+        }
+
+        PXL_LOG_INFO(LogArea::Vulkan, "Physical device has no dedicated transfer queue family");
+        return std::nullopt;
+    }
+
     VkSurfaceFormatKHR VulkanHelpers::GetSuitableSurfaceFormat(const std::vector<VkSurfaceFormatKHR>& surfaceFormats)
     {
         // Select most suitable surface format
@@ -244,7 +279,9 @@ namespace pxl
 
     void VulkanDeletionQueue::Flush()
     {
-        for (auto it = s_Queue.end() - 1; it != s_Queue.begin(); it--)
+        std::lock_guard lock(s_Mutex);
+
+        for (auto it = s_Queue.rbegin(); it != s_Queue.rend(); it++)
             (*(it))();
 
         s_Queue.clear();
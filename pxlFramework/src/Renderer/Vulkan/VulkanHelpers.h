@@ -25,6 +25,8 @@ namespace pxl
         static VkSurfaceCapabilitiesKHR GetSurfaceCapabilities(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface);
 
         static std::optional<uint32_t> GetSuitableGraphicsQueueFamily(const std::vector<VkQueueFamilyProperties>& queueFamilies, VkPhysicalDevice gpu, VkSurfaceKHR surface);
+        static std::optional<uint32_t> GetDedicatedComputeQueueFamily(const std::vector<VkQueueFamilyProperties>& queueFamilies);
+        static std::optional<uint32_t> GetDedicatedTransferQueueFamily(const std::vector<VkQueueFamilyProperties>& queueFamilies);
         static VkSurfaceFormatKHR GetSuitableSurfaceFormat(const std::vector<VkSurfaceFormatKHR>& surfaceFormats);
         static VkQueue GetQueueHandle(VkDevice device, const std::optional<uint32_t>& queueIndex);
         static VkPhysicalDevice GetFirstDiscreteGPU(const std::vector<VkPhysicalDevice>& physicalDevices);
@@ -36,12 +38,18 @@ namespace pxl
     class VulkanDeletionQueue
     {
     public:
-        static void Add(std::function<void()> function) { s_Queue.push_back(function); }
+        // NOTE: Thread-safe, since Vulkan objects can be created on worker threads
+        static void Add(std::function<void()> function)
+        {
+            std::lock_guard lock(s_Mutex);
+            s_Queue.push_back(function);
+        }
 
         static void Flush();
 
     private:
         static inline std::vector<std::function<void()>> s_Queue;
+        static inline std::mutex s_Mutex;
     };
 
 #ifdef PXL_DEBUG
@@ -5,11 +5,11 @@
 
 namespace pxl
 {
-    VulkanImage::VulkanImage(uint32_t width, uint32_t height, VkFormat format)
+    VulkanImage::VulkanImage(uint32_t width, uint32_t height, VkFormat format, VkImageUsageFlags usage)
         : m_Device(static_cast<VkDevice>(Renderer::GetGraphicsContext()->GetDevice()->GetLogical())), m_Width(width), m_Height(height), m_Format(format)
     {
         // Create a vulkan image AND image view
-        CreateImage(m_Width, m_Height, m_Format);
+        CreateImage(m_Width, m_Height, m_Format, usage);
         CreateImageView(m_Format, m_Image);
     }
 
@@ -22,22 +22,63 @@ namespace pxl
 
     void VulkanImage::Destroy()
     {
+        // The view has to be destroyed before the image it views
+        if (m_ImageView)
+        {
+            vkDestroyImageView(m_Device, m_ImageView, nullptr);
+            m_ImageView = VK_NULL_HANDLE;
+        }
+
+        // Swapchain images are owned by the swapchain
         if (m_Image)
         {
-            vkDestroyImage(m_Device, m_Image, nullptr);
+            vmaDestroyImage(VulkanAllocator::Get(), m_Image, m_Allocation);
             m_Image = VK_NULL_HANDLE;
+            m_Allocation = nullptr;
         }
+    }
 
-        if (m_ImageView)
+    VkImageAspectFlags VulkanImage::GetAspectFlags(VkFormat format)
+    {
+        switch (format)
         {
-            vkDestroyImageView(m_Device, m_ImageView, nullptr);
-            m_ImageView = VK_NULL_HANDLE;
+            case VK_FORMAT_D16_UNORM:
+            case VK_FORMAT_X8_D24_UNORM_PACK32:
+            case VK_FORMAT_D32_SFLOAT:
+                return VK_IMAGE_ASPECT_DEPTH_BIT;
+
+            case VK_FORMAT_D16_UNORM_S8_UINT:
+            case VK_FORMAT_D24_UNORM_S8_UINT:
+            case VK_FORMAT_D32_SFLOAT_S8_UINT:
+                return VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
+
+            default:
+                return VK_IMAGE_ASPECT_COLOR_BIT;
         }
     }
 
-    void VulkanImage::CreateImage([[maybe_unused]] uint32_t width, [[maybe_unused]] uint32_t height, [[maybe_unused]] VkFormat format)
+    void VulkanImage::CreateImage(uint32_t width, uint32_t height, VkFormat format, VkImageUsageFlags usage)
     {
-        // TODO: Create VkImage object
+        VkImageCreateInfo imageInfo = { VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO };
+        imageInfo.imageType = VK_IMAGE_TYPE_2D;
+        imageInfo.format = format;
+        imageInfo.extent = { width, height, 1 };
+        imageInfo.mipLevels = 1;
+        imageInfo.arrayLayers = 1;
+        imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+        imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        imageInfo.usage = usage;
+        imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+        VmaAllocationCreateInfo allocInfo = {};
+        allocInfo.usage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE;
+
+        // Attachments are recreated whenever they're resized, so give them their own memory instead of fragmenting a shared block
+        if (usage & (VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT))
+            allocInfo.flags = VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT;
+
+        VK_CHECK(vmaCreateImage(VulkanAllocator::Get(), &imageInfo, &allocInfo, &m_Image, &m_Allocation, nullptr));
     }
 
     void VulkanImage::CreateImageView(VkFormat format, VkImage image)
@@ -51,7 +92,7 @@ namespace pxl
         imageViewInfo.components.g = VK_COMPONENT_SWIZZLE_IDENTITY;
         imageViewInfo.components.b = VK_COMPONENT_SWIZZLE_IDENTITY;
         imageViewInfo.components.a = VK_COMPONENT_SWIZZLE_IDENTITY;
-        imageViewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT; // subresourceRange determines how the image should be accessed
+        imageViewInfo.subresourceRange.aspectMask = GetAspectFlags(format); // subresourceRange determines how the image should be accessed
         imageViewInfo.subresourceRange.baseMipLevel = 0;
         imageViewInfo.subresourceRange.levelCount = 1;
         imageViewInfo.subresourceRange.baseArrayLayer = 0;
@@ -2,6 +2,7 @@
 
 #include <volk/volk.h>
 
+#include "VulkanAllocator.h"
 #include "VulkanDevice.h"
 
 namespace pxl
@@ -10,15 +11,20 @@ namespace pxl
     class VulkanImage
     {
     public:
-        VulkanImage(uint32_t width, uint32_t height, VkFormat format);
+        VulkanImage(uint32_t width, uint32_t height, VkFormat format, VkImageUsageFlags usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
         VulkanImage(const std::shared_ptr<VulkanDevice>& device, uint32_t width, uint32_t height, VkFormat format, VkImage swapchainImage);
 
         void Destroy();
 
+        VkImage GetImage() const { return m_Image; }
         VkImageView GetImageView() const { return m_ImageView; }
+        VkFormat GetFormat() const { return m_Format; }
+
+        // The aspect of the image that views and copies address, depending on whether it's a depth format
+        static VkImageAspectFlags GetAspectFlags(VkFormat format);
 
     private:
-        void CreateImage(uint32_t width, uint32_t height, VkFormat format);
+        void CreateImage(uint32_t width, uint32_t height, VkFormat format, VkImageUsageFlags usage);
         void CreateImageView(VkFormat format, VkImage image);
 
     private:
@@ -28,6 +34,7 @@ namespace pxl
         VkFormat m_Format = VK_FORMAT_UNDEFINED;
 
         VkImage m_Image = VK_NULL_HANDLE;
+        VmaAllocation m_Allocation = nullptr;
         VkImageView m_ImageView = VK_NULL_HANDLE;
 
         bool m_IsSwapchainImage = false; // Currently unused
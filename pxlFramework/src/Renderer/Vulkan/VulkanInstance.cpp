@@ -77,4 +77,23 @@ namespace pxl
         }
 #endif
     }
+
+    void VulkanInstance::InitDefault(const std::vector<const char*>& extensions)
+    {
+        if (s_Instance)
+            return;
+
+        // Initialize volk
+        VK_CHECK(volkInitialize());
+
+        std::vector<const char*> layers;
+
+#ifdef PXL_DEBUG
+        // Get validation layer (Vulkan debugging)
+        auto availableLayers = VulkanHelpers::GetAvailableInstanceLayers();
+        layers.push_back(VulkanHelpers::GetValidationLayer(availableLayers));
+#endif
+
+        Init(extensions, layers);
+    }
 }
\ No newline at end of file
@@ -9,6 +9,10 @@ namespace pxl
     public:
         static void Init(const std::vector<const char*>& extensions, const std::vector<const char*>& layers);
 
+        // Loads the Vulkan library and creates the instance with the validation layer in debug builds, if it hasn't been created already.
+        // NOTE: Windows can only be created if the instance was created with the surface extensions GLFW requires
+        static void InitDefault(const std::vector<const char*>& extensions);
+
         static VkInstance Get() { return s_Instance; }
 
     private:
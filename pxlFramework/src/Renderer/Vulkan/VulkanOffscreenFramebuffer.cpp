@@ -0,0 +1,200 @@
+#include "VulkanOffscreenFramebuffer.h"
+
+#include "Renderer/Renderer.h"
+#include "VulkanAllocator.h"
+#include "VulkanContext.h"
+#include "VulkanHelpers.h"
+
+namespace pxl
+{
+    VulkanOffscreenFramebuffer::VulkanOffscreenFramebuffer(const FramebufferSpecs& specs)
+        : m_Specs(specs)
+    {
+        auto context = static_pointer_cast<VulkanGraphicsContext>(Renderer::GetGraphicsContext());
+
+        m_Device = static_pointer_cast<VulkanDevice>(context->GetDevice());
+        m_RenderPass = context->GetOffscreenRenderPass(m_Specs.DepthAttachment);
+
+        m_CommandBuffer = m_Device->AllocateCommandBuffers(QueueType::Graphics, VK_COMMAND_BUFFER_LEVEL_PRIMARY, 1).at(0);
+        m_Fence = VulkanHelpers::CreateFence(m_Device->GetVkLogical());
+
+        Create();
+    }
+
+    VulkanOffscreenFramebuffer::~VulkanOffscreenFramebuffer()
+    {
+        // Frames in flight may still be drawing into the images
+        m_Device->WaitIdle();
+
+        Destroy();
+
+        vkDestroyFence(m_Device->GetVkLogical(), m_Fence, nullptr);
+    }
+
+    void VulkanOffscreenFramebuffer::Resize(uint32_t width, uint32_t height)
+    {
+        if (width == 0 || height == 0)
+        {
+            PXL_LOG_WARN(LogArea::Vulkan, "Can't resize framebuffer to {}x{}", width, height);
+            return;
+        }
+
+        m_Device->WaitIdle();
+
+        Destroy();
+
+        m_Specs.Size = { width, height };
+
+        Create();
+    }
+
+    std::shared_ptr<Image> VulkanOffscreenFramebuffer::ReadPixels()
+    {
+        PXL_PROFILE_SCOPE;
+
+        // Wait for the frames drawing into the colour image, the copy is then ordered after them by the barrier below
+        m_Device->QueueWaitIdle(QueueType::Graphics);
+
+        SubmitAndWait([&](VkCommandBuffer commandBuffer)
+        {
+            // The render pass already left the image in TRANSFER_SRC_OPTIMAL, this only makes its writes visible to the copy
+            VkImageMemoryBarrier imageBarrier = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+            imageBarrier.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+            imageBarrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+            imageBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            imageBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            imageBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            imageBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            imageBarrier.image = m_ColourImage->GetImage();
+            imageBarrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+            vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &imageBarrier);
+
+            // Rows are tightly packed
+            VkBufferImageCopy region = {};
+            region.bufferOffset = 0;
+            region.bufferRowLength = 0;
+            region.bufferImageHeight = 0;
+            region.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+            region.imageOffset = { 0, 0, 0 };
+            region.imageExtent = { m_Specs.Size.Width, m_Specs.Size.Height, 1 };
+
+            vkCmdCopyImageToBuffer(commandBuffer, m_ColourImage->GetImage(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, m_ReadbackBuffer.Buffer, 1, &region);
+
+            VkBufferMemoryBarrier bufferBarrier = { VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER };
+            bufferBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            bufferBarrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+            bufferBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            bufferBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            bufferBarrier.buffer = m_ReadbackBuffer.Buffer;
+            bufferBarrier.offset = 0;
+            bufferBarrier.size = VK_WHOLE_SIZE;
+
+            vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &bufferBarrier, 0, nullptr);
+        });
+
+        // Host visible memory isn't always coherent
+        VK_CHECK(vmaInvalidateAllocation(VulkanAllocator::Get(), m_ReadbackBuffer.Allocation, 0, VK_WHOLE_SIZE));
+
+        auto rowSize = static_cast<size_t>(m_Specs.Size.Width) * 4;
+        auto height = static_cast<size_t>(m_Specs.Size.Height);
+        auto mappedData = static_cast<const uint8_t*>(m_ReadbackBuffer.AllocInfo.pMappedData);
+
+        // The image's rows are top to bottom (the renderer flips the viewport to match OpenGL), but images are kept bottom to top
+        std::vector<uint8_t> pixels(rowSize * height);
+        for (size_t y = 0; y < height; y++)
+            memcpy(pixels.data() + y * rowSize, mappedData + (height - 1 - y) * rowSize, rowSize);
+
+        return std::make_shared<Image>(std::move(pixels), m_Specs.Size, ImageFormat::RGBA8);
+    }
+
+    void VulkanOffscreenFramebuffer::Create()
+    {
+        auto width = m_Specs.Size.Width;
+        auto height = m_Specs.Size.Height;
+
+        // Create the attachments
+        m_ColourImage = std::make_unique<VulkanImage>(width, height, VulkanGraphicsContext::k_OffscreenColourFormat,
+            VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_SAMPLED_BIT);
+
+        m_Framebuffer = std::make_unique<VulkanFramebuffer>(m_Device, m_RenderPass, GetExtent());
+        m_Framebuffer->AddAttachment(m_ColourImage->GetImageView(), m_ColourImage->GetFormat());
+
+        if (m_Specs.DepthAttachment)
+        {
+            m_DepthImage = std::make_unique<VulkanImage>(width, height, VulkanGraphicsContext::k_OffscreenDepthFormat, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT);
+            m_Framebuffer->AddAttachment(m_DepthImage->GetImageView(), m_DepthImage->GetFormat());
+        }
+
+        m_Framebuffer->Recreate();
+
+        // Create the readback buffer
+        VkBufferCreateInfo bufferInfo = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+        bufferInfo.size = static_cast<VkDeviceSize>(width) * height * 4;
+        bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        VmaAllocationCreateInfo allocInfo = {};
+        allocInfo.usage = VMA_MEMORY_USAGE_AUTO;
+        allocInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+
+        VK_CHECK(vmaCreateBuffer(VulkanAllocator::Get(), &bufferInfo, &allocInfo, &m_ReadbackBuffer.Buffer, &m_ReadbackBuffer.Allocation, &m_ReadbackBuffer.AllocInfo));
+
+        // Put the colour image in the layout the render pass leaves it in, so it can be read back before anything is drawn into it
+        SubmitAndWait([&](VkCommandBuffer commandBuffer)
+        {
+            VkImageMemoryBarrier barrier = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+            barrier.srcAccessMask = 0;
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+            barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image = m_ColourImage->GetImage();
+            barrier.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+            vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+        });
+    }
+
+    void VulkanOffscreenFramebuffer::Destroy()
+    {
+        if (m_Framebuffer)
+            m_Framebuffer->Destroy();
+
+        if (m_ColourImage)
+            m_ColourImage->Destroy();
+
+        if (m_DepthImage)
+            m_DepthImage->Destroy();
+
+        if (m_ReadbackBuffer.Buffer)
+            m_ReadbackBuffer.Destroy();
+
+        m_Framebuffer.reset();
+        m_ColourImage.reset();
+        m_DepthImage.reset();
+    }
+
+    void VulkanOffscreenFramebuffer::SubmitAndWait(const std::function<void(VkCommandBuffer)>& record)
+    {
+        VkCommandBufferBeginInfo beginInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+        VK_CHECK(vkBeginCommandBuffer(m_CommandBuffer, &beginInfo));
+
+        record(m_CommandBuffer);
+
+        VK_CHECK(vkEndCommandBuffer(m_CommandBuffer));
+
+        VkSubmitInfo submitInfo = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &m_CommandBuffer;
+
+        m_Device->SubmitCommandBuffer(submitInfo, QueueType::Graphics, m_Fence);
+
+        auto device = m_Device->GetVkLogical();
+        VK_CHECK(vkWaitForFences(device, 1, &m_Fence, VK_TRUE, UINT64_MAX));
+        VK_CHECK(vkResetFences(device, 1, &m_Fence));
+    }
+}
\ No newline at end of file
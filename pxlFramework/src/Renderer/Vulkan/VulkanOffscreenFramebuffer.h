@@ -0,0 +1,57 @@
+#pragma once
+
+#include <volk/volk.h>
+
+#include "Renderer/Framebuffer.h"
+#include "VulkanBuffer.h"
+#include "VulkanDevice.h"
+#include "VulkanFramebuffer.h"
+#include "VulkanImage.h"
+#include "VulkanRenderPass.h"
+
+namespace pxl
+{
+    /// @brief A framebuffer that owns its colour and depth images. Its render pass leaves the colour image in
+    /// VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL so it can be copied back to the CPU once a frame has been drawn into it
+    class VulkanOffscreenFramebuffer : public Framebuffer
+    {
+    public:
+        VulkanOffscreenFramebuffer(const FramebufferSpecs& specs);
+        virtual ~VulkanOffscreenFramebuffer() override;
+
+        virtual void Resize(uint32_t width, uint32_t height) override;
+
+        virtual const FramebufferSpecs& GetSpecs() const override { return m_Specs; }
+
+        virtual std::shared_ptr<Image> ReadPixels() override;
+
+        VkFramebuffer GetVKFramebuffer() const { return m_Framebuffer->GetVKFramebuffer(); }
+        std::shared_ptr<VulkanRenderPass> GetRenderPass() const { return m_RenderPass; }
+        VkExtent2D GetExtent() const { return { m_Specs.Size.Width, m_Specs.Size.Height }; }
+
+        VkImage GetColourImage() const { return m_ColourImage->GetImage(); }
+
+    private:
+        void Create();
+        void Destroy();
+
+        // Records a one off command buffer and blocks until the GPU has executed it
+        void SubmitAndWait(const std::function<void(VkCommandBuffer)>& record);
+
+    private:
+        FramebufferSpecs m_Specs;
+
+        std::shared_ptr<VulkanDevice> m_Device = nullptr;
+        std::shared_ptr<VulkanRenderPass> m_RenderPass = nullptr;
+
+        std::unique_ptr<VulkanImage> m_ColourImage = nullptr;
+        std::unique_ptr<VulkanImage> m_DepthImage = nullptr;
+        std::unique_ptr<VulkanFramebuffer> m_Framebuffer = nullptr;
+
+        // Host visible copy of the colour image, sized to match it
+        VulkanStagingBuffer m_ReadbackBuffer = {};
+
+        VkCommandBuffer m_CommandBuffer = VK_NULL_HANDLE;
+        VkFence m_Fence = VK_NULL_HANDLE;
+    };
+}
\ No newline at end of file
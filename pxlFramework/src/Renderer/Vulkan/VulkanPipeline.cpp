@@ -1,17 +1,26 @@
 #include "VulkanPipeline.h"
 
+#include "Core/Stopwatch.h"
 #include "Renderer/Renderer.h"
 #include "VulkanBuffer.h"
 #include "VulkanContext.h"
 #include "VulkanHelpers.h"
+#include "VulkanRenderer.h"
 
 namespace pxl
 {
     VulkanGraphicsPipeline::VulkanGraphicsPipeline(const GraphicsPipelineSpecs& specs, const std::shared_ptr<VulkanRenderPass>& renderPass)
         : m_Device(static_cast<VkDevice>(Renderer::GetGraphicsContext()->GetDevice()->GetLogical())), m_Shaders(specs.Shaders), m_RenderPass(renderPass), m_Specs(specs)
     {
+        auto device = std::static_pointer_cast<VulkanDevice>(Renderer::GetGraphicsContext()->GetDevice());
+        m_PipelineCache = device->GetPipelineCache();
+
+        Stopwatch stopwatch;
+
         Recreate();
 
+        PXL_LOG_INFO(LogArea::Vulkan, "Created graphics pipeline in {:.3f} ms ({} pipeline cache)", stopwatch.GetElapsedMilliSec(), device->IsPipelineCacheWarm() ? "warm" : "cold");
+
         VulkanDeletionQueue::Add([&]()
         {
             Destroy();
@@ -22,10 +31,8 @@ namespace pxl
     {
         PXL_PROFILE_SCOPE;
 
-        m_CurrentCommandBuffer = static_pointer_cast<VulkanGraphicsContext>(Renderer::GetGraphicsContext())->GetSwapchain()->GetCurrentFrame().CommandBuffer;
-
         // Bind Pipeline
-        vkCmdBindPipeline(m_CurrentCommandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_Pipeline);
+        vkCmdBindPipeline(VulkanRenderer::GetActiveCommandBuffer(), VK_PIPELINE_BIND_POINT_GRAPHICS, m_Pipeline);
     }
 
     void VulkanGraphicsPipeline::Recreate()
@@ -97,7 +104,13 @@ namespace pxl
         // multisamplingInfo.alphaToOneEnable = VK_FALSE; // Optional
 
         // Depth/Stencil testing
-        // TODO LATER
+        // NOTE: Matches the OpenGL renderer's default state, but only render passes with a depth attachment use it (the swapchain's has none)
+        VkPipelineDepthStencilStateCreateInfo depthStencilInfo = { VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO };
+        depthStencilInfo.depthTestEnable = VK_TRUE;
+        depthStencilInfo.depthWriteEnable = VK_TRUE;
+        depthStencilInfo.depthCompareOp = VK_COMPARE_OP_LESS;
+        depthStencilInfo.depthBoundsTestEnable = VK_FALSE;
+        depthStencilInfo.stencilTestEnable = VK_FALSE;
 
         // Colour Blending
         VkPipelineColorBlendAttachmentState colorBlendAttachment = {}; // ColorBlendAttachment is per framebuffer, and ColorBlendState is global // no sType for this struct
@@ -161,7 +174,7 @@ namespace pxl
         graphicsPipelineInfo.pViewportState = &viewportState;
         graphicsPipelineInfo.pRasterizationState = &rasterizationInfo;
         graphicsPipelineInfo.pMultisampleState = &multisamplingInfo;
-        graphicsPipelineInfo.pDepthStencilState = nullptr;
+        graphicsPipelineInfo.pDepthStencilState = m_RenderPass->HasDepthAttachment() ? &depthStencilInfo : nullptr;
         graphicsPipelineInfo.pColorBlendState = &colorBlending;
         graphicsPipelineInfo.pDynamicState = &dynamicStateInfo;
         graphicsPipelineInfo.layout = m_Layout;
@@ -170,7 +183,7 @@ namespace pxl
         graphicsPipelineInfo.basePipelineHandle = m_Pipeline; // } Used for deriving off previous graphics pipelines, which is less expensive.
         graphicsPipelineInfo.basePipelineIndex = -1;          // } VK_PIPELINE_CREATE_DERIVATIVE_BIT must be defined in the flags for this to work.
 
-        VK_CHECK(vkCreateGraphicsPipelines(m_Device, VK_NULL_HANDLE, 1, &graphicsPipelineInfo, nullptr, &m_Pipeline)); // A pipeline cache can be passed to reuse data across multiple calls to vkCreateGraphicsPipelines
+        VK_CHECK(vkCreateGraphicsPipelines(m_Device, m_PipelineCache, 1, &graphicsPipelineInfo, nullptr, &m_Pipeline));
     }
 
     void VulkanGraphicsPipeline::SetUniformData([[maybe_unused]] const std::string& name, [[maybe_unused]] UniformDataType type, [[maybe_unused]] const void* data)
@@ -185,7 +198,7 @@ namespace pxl
     void VulkanGraphicsPipeline::SetPushConstantData(const std::string& name, const void* data)
     {
         auto range = m_PushConstantRanges.at(name);
-        vkCmdPushConstants(m_CurrentCommandBuffer, m_Layout, range.stageFlags, range.offset, range.size, data);
+        vkCmdPushConstants(VulkanRenderer::GetActiveCommandBuffer(), m_Layout, range.stageFlags, range.offset, range.size, data);
     }
 
     void VulkanGraphicsPipeline::Destroy()
@@ -54,8 +54,8 @@ namespace pxl
     private:
         VkDevice m_Device = VK_NULL_HANDLE;
         VkPipeline m_Pipeline = VK_NULL_HANDLE;
+        VkPipelineCache m_PipelineCache = VK_NULL_HANDLE;
         VkPipelineLayout m_Layout = VK_NULL_HANDLE;
-        VkCommandBuffer m_CurrentCommandBuffer = VK_NULL_HANDLE;
         std::shared_ptr<VulkanRenderPass> m_RenderPass = nullptr;
         GraphicsPipelineSpecs m_Specs = {};
 
@@ -0,0 +1,108 @@
+#include "VulkanPipelineCache.h"
+
+#include <fstream>
+
+#include "VulkanHelpers.h"
+
+namespace pxl
+{
+    VulkanPipelineCache::VulkanPipelineCache(VkDevice device, VkPhysicalDevice physicalDevice, const std::filesystem::path& directory)
+        : m_Device(device)
+    {
+        vkGetPhysicalDeviceProperties(physicalDevice, &m_DeviceProperties);
+
+        // Key the file on the device and driver so a driver update or different GPU never reuses stale data
+        auto fileName = std::format("pipelines_{:04x}_{:04x}_{}.bin", m_DeviceProperties.vendorID, m_DeviceProperties.deviceID, m_DeviceProperties.driverVersion);
+        m_FilePath = directory / fileName;
+
+        auto cacheData = LoadCacheData();
+        m_Warm = !cacheData.empty();
+
+        VkPipelineCacheCreateInfo cacheInfo = { VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO };
+        cacheInfo.initialDataSize = cacheData.size();
+        cacheInfo.pInitialData = cacheData.empty() ? nullptr : cacheData.data();
+
+        VK_CHECK(vkCreatePipelineCache(m_Device, &cacheInfo, nullptr, &m_PipelineCache));
+
+        PXL_LOG_INFO(LogArea::Vulkan, "Created pipeline cache ({}, {} bytes)", m_Warm ? "warm" : "cold", cacheData.size());
+    }
+
+    void VulkanPipelineCache::Save()
+    {
+        PXL_PROFILE_SCOPE;
+
+        if (!m_PipelineCache)
+            return;
+
+        size_t dataSize = 0;
+        VK_CHECK(vkGetPipelineCacheData(m_Device, m_PipelineCache, &dataSize, nullptr));
+
+        std::vector<char> data(dataSize);
+        VK_CHECK(vkGetPipelineCacheData(m_Device, m_PipelineCache, &dataSize, data.data()));
+
+        std::error_code error;
+        std::filesystem::create_directories(m_FilePath.parent_path(), error);
+
+        std::ofstream file(m_FilePath, std::ios::binary | std::ios::trunc);
+
+        if (!file.is_open())
+        {
+            PXL_LOG_WARN(LogArea::Vulkan, "Failed to save pipeline cache to '{}'", m_FilePath.string());
+            return;
+        }
+
+        file.write(data.data(), dataSize);
+
+        PXL_LOG_INFO(LogArea::Vulkan, "Saved pipeline cache to '{}' ({} bytes)", m_FilePath.string(), dataSize);
+    }
+
+    void VulkanPipelineCache::Destroy()
+    {
+        if (m_PipelineCache)
+        {
+            vkDestroyPipelineCache(m_Device, m_PipelineCache, nullptr);
+            m_PipelineCache = VK_NULL_HANDLE;
+        }
+    }
+
+    std::vector<char> VulkanPipelineCache::LoadCacheData()
+    {
+        if (!std::filesystem::exists(m_FilePath))
+            return {};
+
+        std::ifstream file(m_FilePath, std::ios::ate | std::ios::binary);
+
+        if (!file.is_open())
+            return {};
+
+        size_t fileSize = static_cast<size_t>(file.tellg());
+        std::vector<char> data(fileSize);
+
+        file.seekg(0);
+        file.read(data.data(), fileSize);
+
+        if (!IsCacheDataValid(data))
+        {
+            PXL_LOG_WARN(LogArea::Vulkan, "Discarding invalid or incompatible pipeline cache '{}'", m_FilePath.string());
+            return {};
+        }
+
+        return data;
+    }
+
+    bool VulkanPipelineCache::IsCacheDataValid(const std::vector<char>& data) const
+    {
+        // Drivers should reject mismatched data themselves, but some don't, so validate the header before handing it over
+        if (data.size() < sizeof(VkPipelineCacheHeaderVersionOne))
+            return false;
+
+        VkPipelineCacheHeaderVersionOne header;
+        memcpy(&header, data.data(), sizeof(header));
+
+        return header.headerSize >= sizeof(VkPipelineCacheHeaderVersionOne)
+            && header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+            && header.vendorID == m_DeviceProperties.vendorID
+            && header.deviceID == m_DeviceProperties.deviceID
+            && memcmp(header.pipelineCacheUUID, m_DeviceProperties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+    }
+}
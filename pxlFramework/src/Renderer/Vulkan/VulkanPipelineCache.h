@@ -0,0 +1,38 @@
+#pragma once
+
+#include <volk/volk.h>
+
+namespace pxl
+{
+    /// @brief Wraps a VkPipelineCache that is persisted to disk between runs so pipeline creation
+    /// can skip driver compilation for pipelines that have been built before
+    class VulkanPipelineCache
+    {
+    public:
+        /// @param directory The directory the cache file is loaded from and saved to
+        VulkanPipelineCache(VkDevice device, VkPhysicalDevice physicalDevice, const std::filesystem::path& directory);
+
+        /// @brief Writes the current cache data to disk
+        void Save();
+
+        void Destroy();
+
+        VkPipelineCache GetVKPipelineCache() const { return m_PipelineCache; }
+
+        // Whether valid cache data was loaded from disk on creation
+        bool IsWarm() const { return m_Warm; }
+
+    private:
+        std::vector<char> LoadCacheData();
+        bool IsCacheDataValid(const std::vector<char>& data) const;
+
+    private:
+        VkDevice m_Device = VK_NULL_HANDLE;
+        VkPipelineCache m_PipelineCache = VK_NULL_HANDLE;
+        VkPhysicalDeviceProperties m_DeviceProperties = {};
+
+        std::filesystem::path m_FilePath;
+
+        bool m_Warm = false;
+    };
+}
@@ -4,8 +4,8 @@
 
 namespace pxl
 {
-    VulkanRenderPass::VulkanRenderPass(const std::shared_ptr<VulkanDevice>& device, VkFormat format)
-        : m_Device(static_cast<VkDevice>(device->GetLogical()))
+    VulkanRenderPass::VulkanRenderPass(const std::shared_ptr<VulkanDevice>& device, VkFormat format, VkImageLayout finalLayout, VkFormat depthFormat)
+        : m_Device(static_cast<VkDevice>(device->GetLogical())), m_HasDepthAttachment(depthFormat != VK_FORMAT_UNDEFINED)
     {
         // Specify colour attachment/ref
         VkAttachmentDescription colourAttachment = {};
@@ -16,31 +16,64 @@ namespace pxl
         colourAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE; // currently not using stencil testing
         colourAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
         colourAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;     // What the image layout is before the render pass begins
-        colourAttachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR; // What the final image will be used for, in this case, presenting to the screen
+        colourAttachment.finalLayout = finalLayout;                     // What the final image will be used for, usually presenting to the screen
 
         VkAttachmentReference colourAttachmentRef = {};
         colourAttachmentRef.attachment = 0;                                    // references an attachment description by index in an array, in this case we have 1 attachment so we specify 0
         colourAttachmentRef.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL; // Specifies the layout of the attachment during a subpass that references this
 
+        // Specify depth attachment/ref, its contents are only needed while the render pass runs
+        VkAttachmentDescription depthAttachment = {};
+        depthAttachment.format = depthFormat;
+        depthAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+        depthAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        depthAttachment.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        depthAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        depthAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        depthAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        depthAttachment.finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+        VkAttachmentReference depthAttachmentRef = {};
+        depthAttachmentRef.attachment = 1;
+        depthAttachmentRef.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+        std::vector<VkAttachmentDescription> attachments = { colourAttachment };
+        if (m_HasDepthAttachment)
+            attachments.push_back(depthAttachment);
+
         // Specify sub pass
         VkSubpassDescription subPass = {};
         subPass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
         subPass.colorAttachmentCount = 1;
         subPass.pColorAttachments = &colourAttachmentRef; // These attachments can be referenced in the fragment shader with 'layout(location = 0) out vec4 outColor'
+        subPass.pDepthStencilAttachment = m_HasDepthAttachment ? &depthAttachmentRef : nullptr;
 
         // Specify sub pass dependencies
         VkSubpassDependency subPassDependency = {};
         subPassDependency.srcSubpass = VK_SUBPASS_EXTERNAL;
         subPassDependency.dstSubpass = 0;                                               // our first and only subpass // must be higher than source pass
         subPassDependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT; // which stage to wait on
-        subPassDependency.srcAccessMask = 0;                                            // does this mean no mask?
+        subPassDependency.srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;         // Offscreen frames in flight share one image, so the last frame's writes must be finished before this one clears it
         subPassDependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
         subPassDependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT; // involves writing of the color attachment, this prevents the image transition from happening until it's actually necessary. so we wait on the color attachment output stage.
 
+        // The depth attachment is cleared at the start of every frame, which must wait for the previous frame's depth tests
+        if (m_HasDepthAttachment)
+        {
+            subPassDependency.srcStageMask |= VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+            subPassDependency.dstStageMask |= VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+            subPassDependency.srcAccessMask |= VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+            subPassDependency.dstAccessMask |= VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+        }
+
+        // Offscreen frames are left to be copied from (frame readback), which the next frame's clear must wait for. Only an execution dependency is needed for a read
+        if (finalLayout == VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL)
+            subPassDependency.srcStageMask |= VK_PIPELINE_STAGE_TRANSFER_BIT;
+
         // Specify render pass
         VkRenderPassCreateInfo renderPassInfo = { VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO };
-        renderPassInfo.attachmentCount = 1;
-        renderPassInfo.pAttachments = &colourAttachment;
+        renderPassInfo.attachmentCount = static_cast<uint32_t>(attachments.size());
+        renderPassInfo.pAttachments = attachments.data();
         renderPassInfo.subpassCount = 1;
         renderPassInfo.pSubpasses = &subPass;
         renderPassInfo.dependencyCount = 1;
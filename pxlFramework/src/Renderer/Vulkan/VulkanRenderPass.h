@@ -11,18 +11,24 @@ namespace pxl
     class VulkanRenderPass
     {
     public:
-        VulkanRenderPass(const std::shared_ptr<VulkanDevice>& device, VkFormat format);
+        // The colour attachment ends in finalLayout, offscreen render passes use VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL so they can be read back.
+        // A depth attachment is only added if depthFormat isn't VK_FORMAT_UNDEFINED
+        VulkanRenderPass(const std::shared_ptr<VulkanDevice>& device, VkFormat format, VkImageLayout finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR, VkFormat depthFormat = VK_FORMAT_UNDEFINED);
 
         void Destroy();
 
         VkRenderPass GetVKRenderPass() { return m_RenderPass; }
 
+        bool HasDepthAttachment() const { return m_HasDepthAttachment; }
+
     private:
         VkRenderPass m_RenderPass = VK_NULL_HANDLE;
 
         std::vector<VkSubpassDescription> m_Subpasses;
         std::vector<VkSubpassDependency> m_SubpassDependencies;
 
+        bool m_HasDepthAttachment = false;
+
         // for destruction
         VkDevice m_Device = VK_NULL_HANDLE;
     };
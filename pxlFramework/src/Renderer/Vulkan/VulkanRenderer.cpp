@@ -1,5 +1,6 @@
 #include "VulkanRenderer.h"
 
+#include "Core/JobSystem.h"
 #include "VulkanAllocator.h"
 #include "VulkanHelpers.h"
 #include "VulkanInstance.h"
@@ -16,8 +17,15 @@ namespace pxl
 
         m_DefaultRenderPass = m_ContextHandle->GetDefaultRenderPass();
 
+        m_ClearValues[0].color = { 0.0f, 0.0f, 0.0f, 1.0f };
+        m_ClearValues[1].depthStencil = { 1.0f, 0 };
+
+        // Headless contexts have no swapchain, their viewport is set once a render target is
+        auto swapchain = m_ContextHandle->GetSwapchain();
+        m_FramesInFlight = swapchain ? swapchain->GetMaxFramesInFlight() : k_OffscreenFramesInFlight;
+
         // Set Dynamic State
-        auto swapchainExtent = m_ContextHandle->GetSwapchain()->GetSwapchainSpecs().Extent;
+        auto swapchainExtent = swapchain ? swapchain->GetSwapchainSpecs().Extent : VkExtent2D { 0, 0 };
 
         // Setup Viewport
         // NOTE: We invert the viewport here to match OpenGL - also note that this is only possible on Vulkan 1.1 or higher without extensions
@@ -31,6 +39,63 @@ namespace pxl
         // Setup Scissor
         m_Scissor.offset = { 0, 0 };
         m_Scissor.extent = { swapchainExtent.width, swapchainExtent.height };
+
+        m_RecordingPools.resize(m_FramesInFlight);
+
+        CreateTimerQueryPools(m_FramesInFlight);
+    }
+
+    void VulkanRenderer::SetRenderTarget(const std::shared_ptr<Framebuffer>& target)
+    {
+        // Wait for the frames using the previous target
+        m_Device->QueueWaitIdle(QueueType::Graphics);
+
+        m_RenderTarget = static_pointer_cast<VulkanOffscreenFramebuffer>(target);
+
+        if (!m_RenderTarget)
+            return;
+
+        if (m_OffscreenFrames.empty())
+            CreateOffscreenFrames(m_FramesInFlight);
+
+        auto size = m_RenderTarget->GetSpecs().Size;
+        SetViewport(0, 0, size.Width, size.Height);
+        SetScissor(0, 0, size.Width, size.Height);
+    }
+
+    std::shared_ptr<FrameReadbackPool> VulkanRenderer::CreateReadbackPool(uint32_t bufferCount)
+    {
+        auto swapchain = m_ContextHandle->GetSwapchain();
+
+        if (swapchain && (!swapchain->SupportsReadback() || !VulkanFrameReadbackPool::GetPixelFormat(swapchain->GetSwapchainSpecs().Format)))
+        {
+            PXL_LOG_WARN(LogArea::Vulkan, "Frames can't be read back, the swapchain images can't be copied from or aren't 8 bit RGBA/BGRA");
+            return nullptr;
+        }
+
+        auto pool = std::make_shared<VulkanFrameReadbackPool>(m_Device, bufferCount);
+        m_ReadbackPool = pool;
+        return pool;
+    }
+
+    void VulkanRenderer::CreateOffscreenFrames(uint32_t count)
+    {
+        auto device = m_Device->GetVkLogical();
+        auto commandBuffers = m_Device->AllocateCommandBuffers(QueueType::Graphics, VK_COMMAND_BUFFER_LEVEL_PRIMARY, count);
+
+        m_OffscreenFrames.resize(count);
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            m_OffscreenFrames[i].CommandBuffer = commandBuffers[i];
+            m_OffscreenFrames[i].InFlightFence = VulkanHelpers::CreateFence(device, true);
+        }
+
+        VulkanDeletionQueue::Add([device, frames = m_OffscreenFrames]()
+        {
+            for (const auto& frame : frames)
+                vkDestroyFence(device, frame.InFlightFence, nullptr);
+        });
     }
 
     void VulkanRenderer::SetViewport(uint32_t x, [[maybe_unused]] uint32_t y, uint32_t width, uint32_t height)
@@ -54,7 +119,7 @@ namespace pxl
     {
         PXL_PROFILE_SCOPE;
 
-        vkCmdDraw(m_CurrentFrame.CommandBuffer, vertexCount, 1, 0, 0);
+        vkCmdDraw(s_ActiveCommandBuffer, vertexCount, 1, 0, 0);
     }
 
     void VulkanRenderer::DrawLines(uint32_t vertexCount)
@@ -70,7 +135,7 @@ namespace pxl
     {
         PXL_PROFILE_SCOPE;
 
-        vkCmdDrawIndexed(m_CurrentFrame.CommandBuffer, indexCount, 1, 0, 0, 0);
+        vkCmdDrawIndexed(s_ActiveCommandBuffer, indexCount, 1, 0, 0, 0);
     }
 
     void VulkanRenderer::BeginFrame()
@@ -81,21 +146,59 @@ namespace pxl
         auto swapchain = m_ContextHandle->GetSwapchain();
 
         // Get the next frame to render to
-        m_CurrentFrame = swapchain->GetCurrentFrame();
+        if (m_RenderTarget)
+        {
+            m_CurrentFrameIndex = (m_CurrentFrameIndex + 1) % m_FramesInFlight;
+            m_CurrentFrame = m_OffscreenFrames[m_CurrentFrameIndex];
+        }
+        else
+        {
+            m_CurrentFrame = swapchain->GetCurrentFrame();
+            m_CurrentFrameIndex = swapchain->GetCurrentFrameIndex();
+        }
 
         // Wait until the command buffers and semaphores are ready again
         VK_CHECK(vkWaitForFences(device, 1, &m_CurrentFrame.InFlightFence, VK_TRUE, UINT64_MAX)); // using UINT64_MAX pretty much means an infinite timeout (18 quintillion nanoseconds = 584 years)
 
-        // Ensure swapchain is valid
-        if (swapchain->IsInvalid())
-            swapchain->Recreate();
-
-        // Get next available image index
-        swapchain->AcquireNextAvailableImageIndex();
-        uint32_t imageIndex = swapchain->GetCurrentImageIndex();
+        VkExtent2D renderExtent = {};
+
+        if (m_RenderTarget)
+        {
+            m_CurrentFramebuffer = m_RenderTarget->GetVKFramebuffer();
+            m_CurrentRenderPass = m_RenderTarget->GetRenderPass()->GetVKRenderPass();
+            renderExtent = m_RenderTarget->GetExtent();
+        }
+        else
+        {
+            // Ensure swapchain is valid
+            if (swapchain->IsInvalid())
+                swapchain->Recreate();
+
+            // Get next available image index
+            swapchain->AcquireNextAvailableImageIndex();
+            uint32_t imageIndex = swapchain->GetCurrentImageIndex();
+
+            m_CurrentFramebuffer = swapchain->GetFramebuffer(imageIndex)->GetVKFramebuffer();
+            m_CurrentRenderPass = m_DefaultRenderPass->GetVKRenderPass();
+            renderExtent = swapchain->GetSwapchainSpecs().Extent;
+        }
 
         VK_CHECK(vkResetFences(device, 1, &m_CurrentFrame.InFlightFence));
 
+        // The frame's fence has signalled, so its timestamps can be read without stalling
+        if (m_TimestampsSupported)
+            ResolveTimerQueries(m_TimerPools[m_CurrentFrameIndex]);
+
+        // The GPU is done with this frame's secondary command buffers, so they can be recorded again
+        for (auto& pool : m_RecordingPools[m_CurrentFrameIndex])
+        {
+            VK_CHECK(vkResetCommandPool(device, pool.CommandPool, 0));
+            pool.UsedCount = 0;
+        }
+
+        m_ParallelRecording = m_ParallelRecordingRequested;
+        s_ActiveCommandBuffer = m_CurrentFrame.CommandBuffer;
+
         // Begin command buffer recording
         VkCommandBufferBeginInfo commandBufferBeginInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
         commandBufferBeginInfo.flags = 0;                  // Optional
@@ -103,23 +206,37 @@ namespace pxl
 
         VK_CHECK(vkBeginCommandBuffer(m_CurrentFrame.CommandBuffer, &commandBufferBeginInfo));
 
+        // NOTE: Queries can only be reset outside of a render pass
+        if (m_TimestampsSupported)
+        {
+            auto& timerPool = m_TimerPools[m_CurrentFrameIndex];
+            vkCmdResetQueryPool(m_CurrentFrame.CommandBuffer, timerPool.QueryPool, 0, (k_MaxGPUTimersPerFrame + 1) * 2);
+            vkCmdWriteTimestamp(m_CurrentFrame.CommandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, timerPool.QueryPool, 0);
+            timerPool.UsedCount = 0;
+        }
+
         // --------------------------
         // Begin Geometry Render Pass
         // --------------------------
 
         VkRenderPassBeginInfo renderPassBeginInfo = { VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO };
-        renderPassBeginInfo.renderPass = m_DefaultRenderPass->GetVKRenderPass(); // shouldnt be here if I want to support different render passes in the future.
-        renderPassBeginInfo.framebuffer = swapchain->GetFramebuffer(imageIndex)->GetVKFramebuffer();
+        renderPassBeginInfo.renderPass = m_CurrentRenderPass;
+        renderPassBeginInfo.framebuffer = m_CurrentFramebuffer;
         renderPassBeginInfo.renderArea.offset = { 0, 0 };
-        renderPassBeginInfo.renderArea.extent = swapchain->GetSwapchainSpecs().Extent;
-        renderPassBeginInfo.clearValueCount = 1;
-        renderPassBeginInfo.pClearValues = &m_ClearValue;
-
-        vkCmdBeginRenderPass(m_CurrentFrame.CommandBuffer, &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
-
-        // Set dynamic state objects
-        vkCmdSetViewport(m_CurrentFrame.CommandBuffer, 0, 1, &m_Viewport);
-        vkCmdSetScissor(m_CurrentFrame.CommandBuffer, 0, 1, &m_Scissor);
+        renderPassBeginInfo.renderArea.extent = renderExtent;
+        renderPassBeginInfo.clearValueCount = static_cast<uint32_t>(m_ClearValues.size()); // The depth clear value is ignored by render passes without a depth attachment
+        renderPassBeginInfo.pClearValues = m_ClearValues.data();
+
+        // NOTE: When recording in parallel, the primary command buffer may only execute secondary command buffers inside the render pass
+        auto subpassContents = m_ParallelRecording ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : VK_SUBPASS_CONTENTS_INLINE;
+        vkCmdBeginRenderPass(m_CurrentFrame.CommandBuffer, &renderPassBeginInfo, subpassContents);
+
+        // Set dynamic state objects (secondary command buffers set their own since dynamic state isn't inherited)
+        if (!m_ParallelRecording)
+        {
+            vkCmdSetViewport(m_CurrentFrame.CommandBuffer, 0, 1, &m_Viewport);
+            vkCmdSetScissor(m_CurrentFrame.CommandBuffer, 0, 1, &m_Scissor);
+        }
     }
 
     void VulkanRenderer::EndFrame()
@@ -129,6 +246,34 @@ namespace pxl
         // End render pass
         vkCmdEndRenderPass(m_CurrentFrame.CommandBuffer);
 
+        if (m_TimestampsSupported)
+        {
+            auto& timerPool = m_TimerPools[m_CurrentFrameIndex];
+            vkCmdWriteTimestamp(m_CurrentFrame.CommandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, timerPool.QueryPool, 1);
+            timerPool.SubmittedCount = std::min(timerPool.UsedCount.load(), k_MaxGPUTimersPerFrame);
+            timerPool.Submitted = true;
+        }
+
+        // Copied after the frame's end timestamp so reading back doesn't count towards the GPU frame time
+        auto readbackPool = m_ReadbackPool.lock();
+
+        if (readbackPool)
+        {
+            if (m_RenderTarget)
+            {
+                readbackPool->RecordCopy(m_CurrentFrame.CommandBuffer, m_RenderTarget->GetColourImage(), VulkanGraphicsContext::k_OffscreenColourFormat,
+                    m_RenderTarget->GetExtent(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+            }
+            else
+            {
+                auto swapchain = m_ContextHandle->GetSwapchain();
+                const auto& specs = swapchain->GetSwapchainSpecs();
+
+                readbackPool->RecordCopy(m_CurrentFrame.CommandBuffer, swapchain->GetImage(swapchain->GetCurrentImageIndex()), specs.Format,
+                    specs.Extent, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
+            }
+        }
+
         // Finish recording the command buffer
         VK_CHECK(vkEndCommandBuffer(m_CurrentFrame.CommandBuffer));
 
@@ -139,14 +284,222 @@ namespace pxl
         VkSemaphore signalSemaphores[] = { m_CurrentFrame.RenderFinishedSemaphore };
 
         VkPipelineStageFlags waitStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT }; // which stages of the pipeline to wait on
-        commandBufferSubmitInfo.waitSemaphoreCount = 1;
+        // Offscreen frames aren't presented, so there's no swapchain image to wait for or hand over
+        bool presenting = !m_RenderTarget;
+
+        commandBufferSubmitInfo.waitSemaphoreCount = presenting ? 1 : 0;
         commandBufferSubmitInfo.pWaitSemaphores = waitSemaphores; // semaphores to wait on before execution
         commandBufferSubmitInfo.pWaitDstStageMask = waitStages;   // TODO: Understand this a little bit more
         commandBufferSubmitInfo.commandBufferCount = 1;
         commandBufferSubmitInfo.pCommandBuffers = &m_CurrentFrame.CommandBuffer;
-        commandBufferSubmitInfo.signalSemaphoreCount = 1;
+        commandBufferSubmitInfo.signalSemaphoreCount = presenting ? 1 : 0;
         commandBufferSubmitInfo.pSignalSemaphores = signalSemaphores; // semaphores to signal when finished
 
         m_Device->SubmitCommandBuffer(commandBufferSubmitInfo, QueueType::Graphics, m_CurrentFrame.InFlightFence);
+
+        if (readbackPool)
+            readbackPool->SubmitFence();
+    }
+
+    void VulkanRenderer::ExecuteRecordTasks(const std::vector<std::function<void()>>& tasks)
+    {
+        PXL_PROFILE_SCOPE;
+
+        if (!m_ParallelRecording)
+        {
+            RendererAPI::ExecuteRecordTasks(tasks);
+            return;
+        }
+
+        if (tasks.empty())
+            return;
+
+        auto taskCount = static_cast<uint32_t>(tasks.size());
+
+        // Pools have to exist before any thread starts recording so the pool list is never resized while in use
+        PrepareRecordingPools(taskCount);
+
+        std::vector<VkCommandBuffer> secondaryCommandBuffers(taskCount);
+
+        // Every task records into its own pool, so tasks can be spread across the job system freely
+        JobSystem::ParallelFor(taskCount, [&](uint32_t begin, uint32_t end)
+        {
+            for (uint32_t i = begin; i < end; i++)
+                secondaryCommandBuffers[i] = RecordSecondary(i, tasks[i]);
+        }, 1);
+
+        vkCmdExecuteCommands(m_CurrentFrame.CommandBuffer, taskCount, secondaryCommandBuffers.data());
+    }
+
+    void VulkanRenderer::PrepareRecordingPools(uint32_t count)
+    {
+        auto& pools = m_RecordingPools[m_CurrentFrameIndex];
+
+        while (pools.size() < count)
+        {
+            RecordingPool pool;
+            pool.CommandPool = m_Device->CreateCommandPool(m_Device->GetGraphicsQueueFamily());
+            pools.push_back(pool);
+        }
+    }
+
+    VkCommandBuffer VulkanRenderer::RecordSecondary(uint32_t taskIndex, const std::function<void()>& task)
+    {
+        PXL_PROFILE_SCOPE;
+
+        auto& pool = m_RecordingPools[m_CurrentFrameIndex][taskIndex];
+
+        // Reuse a command buffer from an earlier frame if there's one available
+        if (pool.UsedCount == pool.CommandBuffers.size())
+        {
+            VkCommandBufferAllocateInfo allocInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+            allocInfo.commandPool = pool.CommandPool;
+            allocInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+            allocInfo.commandBufferCount = 1;
+
+            VkCommandBuffer newCommandBuffer = VK_NULL_HANDLE;
+            VK_CHECK(vkAllocateCommandBuffers(m_Device->GetVkLogical(), &allocInfo, &newCommandBuffer));
+            pool.CommandBuffers.push_back(newCommandBuffer);
+        }
+
+        VkCommandBuffer commandBuffer = pool.CommandBuffers[pool.UsedCount++];
+
+        VkCommandBufferInheritanceInfo inheritanceInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO };
+        inheritanceInfo.renderPass = m_CurrentRenderPass;
+        inheritanceInfo.subpass = 0;
+        inheritanceInfo.framebuffer = m_CurrentFramebuffer;
+
+        VkCommandBufferBeginInfo beginInfo = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT | VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+        VK_CHECK(vkBeginCommandBuffer(commandBuffer, &beginInfo));
+
+        vkCmdSetViewport(commandBuffer, 0, 1, &m_Viewport);
+        vkCmdSetScissor(commandBuffer, 0, 1, &m_Scissor);
+
+        // Anything the task binds or draws is recorded into this command buffer
+        auto previousCommandBuffer = s_ActiveCommandBuffer;
+        s_ActiveCommandBuffer = commandBuffer;
+
+        task();
+
+        s_ActiveCommandBuffer = previousCommandBuffer;
+
+        VK_CHECK(vkEndCommandBuffer(commandBuffer));
+
+        return commandBuffer;
+    }
+
+    void VulkanRenderer::BeginGPUTimer(GPUTimerSection section)
+    {
+        s_ActiveTimer = UINT32_MAX;
+
+        if (!m_TimestampsSupported)
+            return;
+
+        auto& pool = m_TimerPools[m_CurrentFrameIndex];
+        uint32_t timer = pool.UsedCount.fetch_add(1, std::memory_order_relaxed);
+
+        // Timers past the end of the pool are just not measured
+        if (timer >= k_MaxGPUTimersPerFrame)
+            return;
+
+        pool.Sections[timer] = section;
+        vkCmdWriteTimestamp(s_ActiveCommandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, pool.QueryPool, (timer + 1) * 2);
+
+        s_ActiveTimer = timer;
+    }
+
+    void VulkanRenderer::EndGPUTimer()
+    {
+        if (s_ActiveTimer == UINT32_MAX)
+            return;
+
+        vkCmdWriteTimestamp(s_ActiveCommandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_TimerPools[m_CurrentFrameIndex].QueryPool, (s_ActiveTimer + 1) * 2 + 1);
+
+        s_ActiveTimer = UINT32_MAX;
+    }
+
+    void VulkanRenderer::CreateTimerQueryPools(uint32_t count)
+    {
+        auto physicalDevice = static_cast<VkPhysicalDevice>(m_Device->GetPhysical());
+
+        VkPhysicalDeviceProperties properties;
+        vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+
+        uint32_t queueFamilyCount = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, nullptr);
+        std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+        vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, queueFamilies.data());
+
+        // A queue family with 0 valid timestamp bits doesn't support timestamps at all
+        uint32_t validBits = queueFamilies[m_Device->GetGraphicsQueueFamily()].timestampValidBits;
+
+        if (validBits == 0 || properties.limits.timestampPeriod == 0.0f)
+        {
+            PXL_LOG_WARN(LogArea::Vulkan, "Graphics queue doesn't support timestamp queries, GPU timings will be unavailable");
+            return;
+        }
+
+        m_TimestampsSupported = true;
+        m_TimestampPeriod = properties.limits.timestampPeriod;
+        m_TimestampMask = validBits >= 64 ? UINT64_MAX : (1ull << validBits) - 1;
+
+        m_TimerPools = std::vector<TimerQueryPool>(count);
+
+        for (auto& pool : m_TimerPools)
+        {
+            VkQueryPoolCreateInfo createInfo = { VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO };
+            createInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+            createInfo.queryCount = (k_MaxGPUTimersPerFrame + 1) * 2;
+
+            VK_CHECK(vkCreateQueryPool(m_Device->GetVkLogical(), &createInfo, nullptr, &pool.QueryPool));
+        }
+
+        // The pools themselves can't be copied since they hold atomics, so only their handles are kept
+        std::vector<VkQueryPool> queryPools;
+        for (const auto& pool : m_TimerPools)
+            queryPools.push_back(pool.QueryPool);
+
+        VulkanDeletionQueue::Add([device = m_Device->GetVkLogical(), queryPools]()
+        {
+            for (auto queryPool : queryPools)
+                vkDestroyQueryPool(device, queryPool, nullptr);
+        });
+    }
+
+    void VulkanRenderer::ResolveTimerQueries(TimerQueryPool& pool)
+    {
+        PXL_PROFILE_SCOPE;
+
+        if (!pool.Submitted)
+            return;
+
+        pool.Submitted = false;
+
+        uint32_t queryCount = (pool.SubmittedCount + 1) * 2;
+        std::vector<uint64_t> timestamps(queryCount);
+
+        auto result = vkGetQueryPoolResults(m_Device->GetVkLogical(), pool.QueryPool, 0, queryCount, timestamps.size() * sizeof(uint64_t), timestamps.data(), sizeof(uint64_t), VK_QUERY_RESULT_64_BIT);
+
+        // Keep the previous timings rather than waiting if the results somehow aren't available yet
+        if (result != VK_SUCCESS)
+            return;
+
+        auto toMilliseconds = [&](uint32_t beginQuery)
+        {
+            uint64_t ticks = (timestamps[beginQuery + 1] - timestamps[beginQuery]) & m_TimestampMask;
+            return static_cast<float>(static_cast<double>(ticks) * m_TimestampPeriod / 1'000'000.0);
+        };
+
+        GPUTimings timings;
+        timings.FrameTime = toMilliseconds(0);
+
+        for (uint32_t i = 0; i < pool.SubmittedCount; i++)
+            timings.SectionTimes[static_cast<size_t>(pool.Sections[i])] += toMilliseconds((i + 1) * 2);
+
+        timings.Sequence = m_GPUTimings.Sequence + 1;
+        m_GPUTimings = timings;
     }
 }
\ No newline at end of file
@@ -2,8 +2,13 @@
 
 #include <volk/volk.h>
 
+#include <atomic>
+
+#include "Core/JobSystem.h"
 #include "Renderer/RendererAPI.h"
 #include "VulkanContext.h"
+#include "VulkanFrameReadback.h"
+#include "VulkanOffscreenFramebuffer.h"
 #include "VulkanRenderPass.h"
 
 namespace pxl
@@ -17,7 +22,7 @@ namespace pxl
         virtual void EndFrame() override;
 
         virtual void Clear() override {};
-        virtual void SetClearColour(const glm::vec4& colour) override { m_ClearValue.color = { colour.r, colour.g, colour.b, colour.a }; }
+        virtual void SetClearColour(const glm::vec4& colour) override { m_ClearValues[0].color = { colour.r, colour.g, colour.b, colour.a }; }
 
         virtual void DrawArrays(uint32_t vertexCount) override;
         virtual void DrawLines(uint32_t vertexCount) override;
@@ -26,18 +31,97 @@ namespace pxl
         virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
         virtual void SetScissor(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
 
+        virtual void ExecuteRecordTasks(const std::vector<std::function<void()>>& tasks) override;
+        virtual uint32_t GetRecordingConcurrency() const override { return m_ParallelRecording ? JobSystem::GetThreadCount() : 1; }
+
+        // NOTE: Takes effect at the start of the next frame since the render pass contents can't change mid-pass
+        virtual void SetParallelRecording(bool value) override { m_ParallelRecordingRequested = value; }
+        virtual bool IsParallelRecording() const override { return m_ParallelRecording; }
+
+        virtual void BeginGPUTimer(GPUTimerSection section) override;
+        virtual void EndGPUTimer() override;
+        virtual GPUTimings GetGPUTimings() const override { return m_GPUTimings; }
+
+        // NOTE: Frames drawn into a render target aren't presented, so this is only meant for headless contexts
+        virtual void SetRenderTarget(const std::shared_ptr<Framebuffer>& target) override;
+
+        // NOTE: Frames drawn to a window can only be read back if the surface lets swapchain images be copied from
+        virtual std::shared_ptr<FrameReadbackPool> CreateReadbackPool(uint32_t bufferCount) override;
+
         VkViewport GetViewport() const { return m_Viewport; }
         VkRect2D GetScissor() const { return m_Scissor; }
 
+        // The command buffer draw commands should be recorded into on the calling thread.
+        // This is the frame's primary command buffer, or a secondary command buffer while inside a parallel recording task
+        static VkCommandBuffer GetActiveCommandBuffer() { return s_ActiveCommandBuffer; }
+
+    private:
+        // Each record task has its own command pool per frame in flight, since pools can't be used from multiple threads at once
+        struct RecordingPool
+        {
+            VkCommandPool CommandPool = VK_NULL_HANDLE;
+            std::vector<VkCommandBuffer> CommandBuffers; // Secondary command buffers, reused every time the pool is reset
+            uint32_t UsedCount = 0;
+        };
+
+        // Each frame in flight has its own timestamp queries, which are read back once the frame's fence has signalled.
+        // Queries 0 and 1 time the whole frame, then each timer uses a begin and end query after that
+        struct TimerQueryPool
+        {
+            VkQueryPool QueryPool = VK_NULL_HANDLE;
+            std::array<GPUTimerSection, k_MaxGPUTimersPerFrame> Sections = {};
+            std::atomic<uint32_t> UsedCount = 0; // Timers may be started from several recording threads at once
+            uint32_t SubmittedCount = 0;
+            bool Submitted = false;
+        };
+
+        void PrepareRecordingPools(uint32_t count);
+        VkCommandBuffer RecordSecondary(uint32_t taskIndex, const std::function<void()>& task);
+
+        void CreateOffscreenFrames(uint32_t count);
+
+        void CreateTimerQueryPools(uint32_t count);
+        void ResolveTimerQueries(TimerQueryPool& pool);
+
     private:
         std::shared_ptr<VulkanDevice> m_Device = nullptr;
         std::shared_ptr<VulkanGraphicsContext> m_ContextHandle = nullptr;
 
-        VkClearValue m_ClearValue = { 0.0f, 0.0f, 0.0f, 1.0f };
+        std::array<VkClearValue, 2> m_ClearValues = {}; // Colour, depth
         VkViewport m_Viewport = {};
         VkRect2D m_Scissor = {};
 
         VulkanFrame m_CurrentFrame = {};
+        uint32_t m_CurrentFrameIndex = 0;
+        uint32_t m_FramesInFlight = 0;
+
+        // The framebuffer and render pass of the frame being recorded
+        VkFramebuffer m_CurrentFramebuffer = VK_NULL_HANDLE;
+        VkRenderPass m_CurrentRenderPass = VK_NULL_HANDLE;
+
+        // Offscreen rendering, the frames only use their command buffer and fence since there's no swapchain image to wait for.
+        // They share the render target's attachments, the render pass's dependency keeps one frame's clear from overlapping the last frame's writes
+        std::shared_ptr<VulkanOffscreenFramebuffer> m_RenderTarget = nullptr;
+        std::vector<VulkanFrame> m_OffscreenFrames;
+        static constexpr uint32_t k_OffscreenFramesInFlight = 2;
+
+        std::weak_ptr<VulkanFrameReadbackPool> m_ReadbackPool;
+
+        // Parallel Recording
+        bool m_ParallelRecording = false;
+        bool m_ParallelRecordingRequested = false;
+        std::vector<std::vector<RecordingPool>> m_RecordingPools; // [frame in flight][task index]
+
+        static inline thread_local VkCommandBuffer s_ActiveCommandBuffer = VK_NULL_HANDLE;
+
+        // GPU Timing
+        bool m_TimestampsSupported = false;
+        float m_TimestampPeriod = 1.0f; // Nanoseconds per timestamp tick
+        uint64_t m_TimestampMask = UINT64_MAX;
+        std::vector<TimerQueryPool> m_TimerPools; // [frame in flight]
+        GPUTimings m_GPUTimings = {};
+
+        static inline thread_local uint32_t s_ActiveTimer = UINT32_MAX;
 
         std::shared_ptr<VulkanRenderPass> m_DefaultRenderPass = nullptr;
     };
@@ -3,6 +3,7 @@
 #include <shaderc/shaderc.hpp>
 
 #include "Renderer/Renderer.h"
+#include "VulkanShaderCache.h"
 
 namespace pxl
 {
@@ -17,11 +18,11 @@ namespace pxl
         });
     }
 
-    VulkanShader::VulkanShader(ShaderStage stage, const std::string& glslSrc)
+    VulkanShader::VulkanShader(ShaderStage stage, const std::string& glslSrc, const ShaderCompileOptions& options)
         : m_Device(static_cast<VkDevice>(Renderer::GetGraphicsContext()->GetDevice()->GetLogical())), m_ShaderStage(stage)
     {
         // When given glsl source code, compile it to SPIR-V so vulkan can use it
-        auto sprvBin = CompileToSPIRV(glslSrc, stage);
+        auto sprvBin = GetSPIRV(glslSrc, stage, options);
 
         m_ShaderModule = CreateShaderModule(m_Device, sprvBin);
 
@@ -78,14 +79,42 @@ namespace pxl
         return shaderModule;
     }
 
-    std::vector<uint32_t> VulkanShader::CompileToSPIRV(const std::string& glslSrc, ShaderStage stage)
+    std::vector<uint32_t> VulkanShader::GetSPIRV(const std::string& glslSrc, ShaderStage stage, const ShaderCompileOptions& options)
     {
-        // TODO: add SPIRV optimization support
+        PXL_PROFILE_SCOPE;
+
+        if (!VulkanShaderCache::IsEnabled())
+            return CompileToSPIRV(glslSrc, stage, options);
+
+        auto key = VulkanShaderCache::GetKey(glslSrc, stage, options);
+
+        if (auto cachedSPIRV = VulkanShaderCache::Load(key))
+        {
+            PXL_LOG_INFO(LogArea::Vulkan, "Loaded SPIR-V from shader cache ({:016x})", key);
+            return cachedSPIRV.value();
+        }
+
+        auto spirv = CompileToSPIRV(glslSrc, stage, options);
 
+        if (!spirv.empty())
+            VulkanShaderCache::Store(key, spirv);
+
+        return spirv;
+    }
+
+    std::vector<uint32_t> VulkanShader::CompileToSPIRV(const std::string& glslSrc, ShaderStage stage, const ShaderCompileOptions& options)
+    {
         PXL_PROFILE_SCOPE;
 
         shaderc::Compiler compiler;
-        shaderc::CompileOptions options;
+        shaderc::CompileOptions compileOptions;
+
+        for (const auto& [name, value] : options.Defines)
+            compileOptions.AddMacroDefinition(name, value);
+
+        if (options.Optimize)
+            compileOptions.SetOptimizationLevel(shaderc_optimization_level_performance);
+
         shaderc_shader_kind shaderKind = shaderc_shader_kind::shaderc_vertex_shader;
 
         switch (stage)
@@ -109,7 +138,7 @@ namespace pxl
 
         PXL_LOG_INFO(LogArea::Vulkan, "Compiling GLSL shader to SPIR-V...");
 
-        auto result = compiler.CompileGlslToSpv(glslSrc, shaderKind, "main", options);
+        auto result = compiler.CompileGlslToSpv(glslSrc, shaderKind, "main", compileOptions);
 
         if (result.GetCompilationStatus() != shaderc_compilation_status_success)
         {
@@ -11,7 +11,7 @@ namespace pxl
     {
     public:
         VulkanShader(ShaderStage stage, const std::vector<char>& sprvBin);
-        VulkanShader(ShaderStage stage, const std::string& glslSrc);
+        VulkanShader(ShaderStage stage, const std::string& glslSrc, const ShaderCompileOptions& options = {});
 
         virtual void Reload() override;
 
@@ -25,7 +25,10 @@ namespace pxl
         static VkShaderModule CreateShaderModule(VkDevice device, const std::vector<char>& code);
         static VkShaderModule CreateShaderModule(VkDevice device, const std::vector<uint32_t>& code);
 
-        static std::vector<uint32_t> CompileToSPIRV(const std::string& glslSrc, ShaderStage stage);
+        // Returns SPIR-V from the shader cache if possible, otherwise compiles it and populates the cache
+        static std::vector<uint32_t> GetSPIRV(const std::string& glslSrc, ShaderStage stage, const ShaderCompileOptions& options);
+
+        static std::vector<uint32_t> CompileToSPIRV(const std::string& glslSrc, ShaderStage stage, const ShaderCompileOptions& options);
 
     private:
         VkDevice m_Device = VK_NULL_HANDLE;
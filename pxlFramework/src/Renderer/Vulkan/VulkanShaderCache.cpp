@@ -0,0 +1,125 @@
+#include "VulkanShaderCache.h"
+
+#include <shaderc/shaderc.hpp>
+#include <volk/volk.h>
+
+// shaderc has no version query of its own, but it's built from glslang and ships with the Vulkan SDK
+#if __has_include(<glslang/build_info.h>)
+    #include <glslang/build_info.h>
+#endif
+
+#include <fstream>
+
+#include "Core/Config.h"
+#include "Utils/Hash.h"
+
+namespace pxl
+{
+    // Bump this if the way shaders are compiled changes in a way the key doesn't capture
+    static constexpr uint32_t k_ShaderCacheVersion = 1;
+
+    static constexpr uint32_t k_SPIRVMagicNumber = 0x07230203;
+
+    uint64_t VulkanShaderCache::GetKey(const std::string& glslSrc, ShaderStage stage, const ShaderCompileOptions& options)
+    {
+        unsigned int spirvVersion = 0, spirvRevision = 0;
+        shaderc_get_spv_version(&spirvVersion, &spirvRevision);
+
+        uint64_t key = Hash::FNV1a(glslSrc);
+        key = Hash::FNV1aValue(stage, key);
+        key = Hash::FNV1aValue(options.Optimize, key);
+        key = Hash::FNV1aValue(k_ShaderCacheVersion, key);
+
+        // The SPIR-V version shaderc targets, which doesn't change between most shaderc builds
+        key = Hash::FNV1aValue(spirvVersion, key);
+        key = Hash::FNV1aValue(spirvRevision, key);
+
+        // The compiler build itself, so upgrading the SDK invalidates the cache
+        key = Hash::FNV1aValue(VK_HEADER_VERSION_COMPLETE, key);
+#ifdef GLSLANG_VERSION_MAJOR
+        key = Hash::FNV1aValue(GLSLANG_VERSION_MAJOR, key);
+        key = Hash::FNV1aValue(GLSLANG_VERSION_MINOR, key);
+        key = Hash::FNV1aValue(GLSLANG_VERSION_PATCH, key);
+#endif
+
+        // Length prefixed, so { "AB", "" } and { "A", "B" } don't hash the same
+        for (const auto& [name, value] : options.Defines)
+        {
+            key = Hash::FNV1aValue(name.size(), key);
+            key = Hash::FNV1a(name, key);
+            key = Hash::FNV1aValue(value.size(), key);
+            key = Hash::FNV1a(value, key);
+        }
+
+        return key;
+    }
+
+    std::optional<std::vector<uint32_t>> VulkanShaderCache::Load(uint64_t key)
+    {
+        PXL_PROFILE_SCOPE;
+
+        auto path = GetFilePath(key);
+
+        std::ifstream file(path, std::ios::ate | std::ios::binary);
+
+        if (!file.is_open())
+            return std::nullopt;
+
+        size_t fileSize = static_cast<size_t>(file.tellg());
+
+        if (fileSize == 0 || fileSize % sizeof(uint32_t) != 0)
+        {
+            PXL_LOG_WARN(LogArea::Vulkan, "Ignoring corrupt cached SPIR-V '{}'", path.string());
+            return std::nullopt;
+        }
+
+        std::vector<uint32_t> spirv(fileSize / sizeof(uint32_t));
+
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(spirv.data()), fileSize);
+
+        if (!file || spirv[0] != k_SPIRVMagicNumber)
+        {
+            PXL_LOG_WARN(LogArea::Vulkan, "Ignoring corrupt cached SPIR-V '{}'", path.string());
+            return std::nullopt;
+        }
+
+        return spirv;
+    }
+
+    void VulkanShaderCache::Store(uint64_t key, const std::vector<uint32_t>& spirv)
+    {
+        PXL_PROFILE_SCOPE;
+
+        auto path = GetFilePath(key);
+
+        std::error_code error;
+        std::filesystem::create_directories(path.parent_path(), error);
+
+        // Write to a temporary file first so a crash mid-write can't leave a truncated binary behind
+        auto tempPath = path;
+        tempPath += ".tmp";
+
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+
+            if (!file.is_open())
+            {
+                PXL_LOG_WARN(LogArea::Vulkan, "Failed to write SPIR-V to shader cache '{}'", path.string());
+                return;
+            }
+
+            file.write(reinterpret_cast<const char*>(spirv.data()), spirv.size() * sizeof(uint32_t));
+        }
+
+        std::filesystem::rename(tempPath, path, error);
+
+        if (error)
+            PXL_LOG_WARN(LogArea::Vulkan, "Failed to write SPIR-V to shader cache '{}': {}", path.string(), error.message());
+    }
+
+    std::filesystem::path VulkanShaderCache::GetFilePath(uint64_t key)
+    {
+        return FrameworkConfig::GetCacheDirectory() / "shaders" / std::format("{:016x}.spv", key);
+    }
+}
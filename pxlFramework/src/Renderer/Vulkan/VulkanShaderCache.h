@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Renderer/Shader.h"
+
+namespace pxl
+{
+    /// @brief An on-disk cache of SPIR-V compiled from GLSL, so warm startups don't need to invoke shaderc.
+    /// Binaries are keyed by a hash of the source, stage, compile options and compiler version.
+    class VulkanShaderCache
+    {
+    public:
+        static uint64_t GetKey(const std::string& glslSrc, ShaderStage stage, const ShaderCompileOptions& options);
+
+        // Returns the cached SPIR-V for the key, or nullopt on a cache miss
+        static std::optional<std::vector<uint32_t>> Load(uint64_t key);
+        static void Store(uint64_t key, const std::vector<uint32_t>& spirv);
+
+        static bool IsEnabled() { return s_Enabled; }
+        static void SetEnabled(bool value) { s_Enabled = value; }
+
+    private:
+        static std::filesystem::path GetFilePath(uint64_t key);
+
+    private:
+        static inline bool s_Enabled = true;
+    };
+}
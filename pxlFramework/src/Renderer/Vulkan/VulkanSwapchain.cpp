@@ -1,5 +1,6 @@
 #include "VulkanSwapchain.h"
 
+#include "Core/Config.h"
 #include "VulkanHelpers.h"
 
 namespace pxl
@@ -10,6 +11,13 @@ namespace pxl
         m_SwapchainSpecs.Extent = imageExtent;
         m_SwapchainSpecs.Format = surfaceFormat.format;
         m_SwapchainSpecs.ColorSpace = surfaceFormat.colorSpace;
+
+        // Fewer frames in flight means less queued work between input and present, at the cost of CPU/GPU overlap
+        const auto& settings = FrameworkConfig::GetSettings();
+        auto latencySettings = LatencySettings::FromMode(settings.LatencyModeSetting, settings.FramesInFlight);
+        m_MaxFramesInFlight = latencySettings.FramesInFlight;
+        m_PreferMailbox = latencySettings.PreferMailbox;
+
         m_SwapchainSpecs.PresentMode = GetSuitablePresentMode();
         m_SwapchainSpecs.ImageCount = GetSuitableImageCount();
 
@@ -43,13 +51,22 @@ namespace pxl
 
     void VulkanSwapchain::CreateSwapchain()
     {
-        m_SwapchainSpecs.PresentMode = m_VSync ? VK_PRESENT_MODE_FIFO_KHR : GetSuitablePresentMode();
+        m_SwapchainSpecs.PresentMode = GetSuitablePresentMode();
         m_SwapchainSpecs.ImageCount = GetSuitableImageCount();
 
         CheckExtentSupport(m_SwapchainSpecs.Extent);
 
         auto oldSwapchain = m_Swapchain;
 
+        // Frames can only be read back if the images can be copied from
+        auto surfaceCapabilities = VulkanHelpers::GetSurfaceCapabilities(static_cast<VkPhysicalDevice>(m_Device->GetPhysical()), m_Surface);
+        m_SupportsReadback = (surfaceCapabilities.supportedUsageFlags & VK_IMAGE_USAGE_TRANSFER_SRC_BIT) != 0;
+
+        VkImageUsageFlags imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+
+        if (m_SupportsReadback)
+            imageUsage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+
         // Create Swapchain
         VkSwapchainCreateInfoKHR swapchainInfo = { VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR };
         swapchainInfo.pNext = nullptr;
@@ -60,7 +77,7 @@ namespace pxl
         swapchainInfo.imageColorSpace = m_SwapchainSpecs.ColorSpace;
         swapchainInfo.imageExtent = m_SwapchainSpecs.Extent;
         swapchainInfo.imageArrayLayers = 1;                             // NOTE (from vk spec): For non-stereoscopic-3D applications, this value is 1.
-        swapchainInfo.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT; // The image will be used as a colour attachment. It wouldnt make sense to use anything else here really
+        swapchainInfo.imageUsage = imageUsage;                          // The image will be used as a colour attachment, and copied from when reading frames back
         swapchainInfo.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE;     // Exclusive = 1 queue family will access the images, Concurrent = multiple queue families will access the images
         swapchainInfo.queueFamilyIndexCount = 0;                        // Only required when imageSharingMode is concurrent
         swapchainInfo.pQueueFamilyIndices = VK_NULL_HANDLE;             // Only required when imageSharingMode is concurrent
@@ -198,6 +215,14 @@ namespace pxl
         }
     }
 
+    void VulkanSwapchain::WaitForPreviousFrame()
+    {
+        PXL_PROFILE_SCOPE;
+
+        uint32_t previousFrameIndex = (m_CurrentFrameIndex + m_MaxFramesInFlight - 1) % m_MaxFramesInFlight;
+        VK_CHECK(vkWaitForFences(static_cast<VkDevice>(m_Device->GetLogical()), 1, &m_Frames[previousFrameIndex].InFlightFence, VK_TRUE, UINT64_MAX));
+    }
+
     void VulkanSwapchain::PrepareImages()
     {
         m_Images.resize(m_SwapchainSpecs.ImageCount);
@@ -214,14 +239,14 @@ namespace pxl
             return;
         }
 
-        std::vector<VkImage> images(swapchainImageCount);
+        m_SwapchainImages.resize(swapchainImageCount);
 
         // Get swapchain images
-        VK_CHECK(vkGetSwapchainImagesKHR(device, m_Swapchain, &swapchainImageCount, images.data()));
+        VK_CHECK(vkGetSwapchainImagesKHR(device, m_Swapchain, &swapchainImageCount, m_SwapchainImages.data()));
 
         // Create an imageless image object containing an image view for each swapchain image
         for (uint32_t i = 0; i < swapchainImageCount; i++)
-            m_Images[i] = std::make_shared<VulkanImage>(m_Device, m_SwapchainSpecs.Extent.width, m_SwapchainSpecs.Extent.height, m_SwapchainSpecs.Format, images[i]);
+            m_Images[i] = std::make_shared<VulkanImage>(m_Device, m_SwapchainSpecs.Extent.width, m_SwapchainSpecs.Extent.height, m_SwapchainSpecs.Format, m_SwapchainImages[i]);
     }
 
     void VulkanSwapchain::PrepareFramebuffers(const std::shared_ptr<VulkanRenderPass>& renderPass)
@@ -241,36 +266,24 @@ namespace pxl
 
     VkPresentModeKHR VulkanSwapchain::GetSuitablePresentMode()
     {
-        auto availablePresentModes = VulkanHelpers::GetSurfacePresentModes(static_cast<VkPhysicalDevice>(m_Device->GetPhysical()), m_Surface);
+        // FIFO is always supported, and is the only mode that never drops or tears frames
+        if (m_VSync && !m_PreferMailbox)
+            return VK_PRESENT_MODE_FIFO_KHR;
+
+        // Mailbox is low latency Vsync, the newest frame replaces any frame waiting to be presented
+        auto preferredPresentMode = m_VSync ? VK_PRESENT_MODE_MAILBOX_KHR : VK_PRESENT_MODE_IMMEDIATE_KHR;
 
-        VkPresentModeKHR suitablePresentMode = VK_PRESENT_MODE_FIFO_KHR;
-        bool foundSuitablePresentMode = false;
+        auto availablePresentModes = VulkanHelpers::GetSurfacePresentModes(static_cast<VkPhysicalDevice>(m_Device->GetPhysical()), m_Surface);
 
         for (const auto& presentMode : availablePresentModes)
         {
-            // Mailbox present mode is low latency Vsync, we prefer it if available
-            if (m_VSync && presentMode == VK_PRESENT_MODE_MAILBOX_KHR)
-            {
-                suitablePresentMode = presentMode;
-                foundSuitablePresentMode = true;
-                break;
-            }
-
-            if (!m_VSync && presentMode == VK_PRESENT_MODE_IMMEDIATE_KHR)
-            {
-                suitablePresentMode = VK_PRESENT_MODE_IMMEDIATE_KHR;
-                foundSuitablePresentMode = true;
-                break;
-            }
+            if (presentMode == preferredPresentMode)
+                return presentMode;
         }
 
-        if (!foundSuitablePresentMode)
-        {
-            PXL_LOG_WARN(LogArea::Vulkan, "Failed to find suitable swap chain present mode, defaulting to VK_PRESENT_MODE_FIFO_KHR");
-            suitablePresentMode = VK_PRESENT_MODE_FIFO_KHR;
-        }
+        PXL_LOG_WARN(LogArea::Vulkan, "Failed to find suitable swap chain present mode, defaulting to VK_PRESENT_MODE_FIFO_KHR");
 
-        return suitablePresentMode;
+        return VK_PRESENT_MODE_FIFO_KHR;
     }
 
     uint32_t VulkanSwapchain::GetSuitableImageCount()
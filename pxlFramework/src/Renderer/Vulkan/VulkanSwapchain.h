@@ -41,15 +41,24 @@ namespace pxl
 
         void QueuePresent();
 
+        // Blocks until the GPU has finished the most recently submitted frame
+        void WaitForPreviousFrame();
+
         VkSwapchainKHR GetVKSwapchain() const { return m_Swapchain; }
 
         VulkanSwapchainSpecs GetSwapchainSpecs() const { return m_SwapchainSpecs; }
 
         VkImageView GetImageView(uint32_t index) const { return m_Images[index]->GetImageView(); } // Get Current Frame Image?
+        VkImage GetImage(uint32_t index) const { return m_SwapchainImages[index]; }
+
+        // Whether the images can be copied from, which the surface doesn't have to support
+        bool SupportsReadback() const { return m_SupportsReadback; }
 
         std::shared_ptr<VulkanFramebuffer> GetFramebuffer(uint32_t index) const { return m_Framebuffers[index]; } // Get Current Frame Framebuffer?
 
         VulkanFrame GetCurrentFrame() const { return m_Frames[m_CurrentFrameIndex]; }
+        uint32_t GetCurrentFrameIndex() const { return m_CurrentFrameIndex; }
+        uint32_t GetMaxFramesInFlight() const { return m_MaxFramesInFlight; }
 
         void SetVSync(bool value) { m_VSync = value; }
         bool GetVSync() const { return m_VSync; }
@@ -80,10 +89,11 @@ namespace pxl
 
         uint32_t m_CurrentImageIndex = 0;                   // for VkSwapchain images
         std::vector<std::shared_ptr<VulkanImage>> m_Images; // holds the image views
+        std::vector<VkImage> m_SwapchainImages;            // owned by the swapchain
         std::vector<std::shared_ptr<VulkanFramebuffer>> m_Framebuffers;
 
         // Synchronization
-        uint32_t m_MaxFramesInFlight = 3; // should this always match swapchain image count?
+        uint32_t m_MaxFramesInFlight = 3; // Set from the latency mode, should this always match swapchain image count?
         uint32_t m_CurrentFrameIndex = 0; // for CPU side frame data
         std::vector<VulkanFrame> m_Frames;
 
@@ -92,7 +102,9 @@ namespace pxl
         VulkanSwapchainSpecs m_SwapchainSpecs = {};
 
         bool m_VSync = true;
+        bool m_PreferMailbox = false;
         bool m_Suspend = false;
+        bool m_SupportsReadback = false;
 
         bool m_Invalid = false;
     };
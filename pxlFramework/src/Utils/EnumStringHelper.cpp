@@ -9,6 +9,7 @@ namespace pxl
             case RendererAPIType::None:   return "None";
             case RendererAPIType::OpenGL: return "OpenGL";
             case RendererAPIType::Vulkan: return "Vulkan";
+            case RendererAPIType::Null:   return "Null";
         }
 
         return "Undefined";
@@ -112,6 +113,7 @@ namespace pxl
         {
             case QueueType::Graphics: return "Graphics";
             case QueueType::Compute:  return "Compute";
+            case QueueType::Transfer: return "Transfer";
         }
 
         return "Undefined";
@@ -203,4 +205,33 @@ namespace pxl
 
         return "Undefined";
     }
-}
\ No newline at end of file
+
+    std::string EnumStringHelper::ToString(LatencyMode mode)
+    {
+        switch (mode)
+        {
+            case LatencyMode::Default: return "Default";
+            case LatencyMode::Low:     return "Low";
+            case LatencyMode::Minimum: return "Minimum";
+        }
+
+        return "Undefined";
+    }
+
+    std::string EnumStringHelper::ToString(GPUTimerSection section)
+    {
+        switch (section)
+        {
+            case GPUTimerSection::Meshes:      return "Meshes";
+            case GPUTimerSection::StaticQuads: return "Static Quads";
+            case GPUTimerSection::StaticCubes: return "Static Cubes";
+            case GPUTimerSection::Quads:       return "Quads";
+            case GPUTimerSection::Cubes:       return "Cubes";
+            case GPUTimerSection::Lines:       return "Lines";
+            case GPUTimerSection::GUI:         return "GUI";
+            case GPUTimerSection::Count:       break;
+        }
+
+        return "Undefined";
+    }
+}
@@ -6,6 +6,8 @@
 #include "Renderer/BufferLayout.h"
 #include "Renderer/Camera.h"
 #include "Renderer/GPUBuffer.h"
+#include "Renderer/GPUTimer.h"
+#include "Renderer/LatencyMode.h"
 #include "Renderer/Pipeline.h"
 #include "Renderer/RendererAPIType.h"
 #include "Renderer/UniformLayout.h"
@@ -30,5 +32,7 @@ namespace pxl
         static std::string ToString(CullMode mode);
         static std::string ToString(FrontFace face);
         static std::string ToString(ShaderStage stage);
+        static std::string ToString(LatencyMode mode);
+        static std::string ToString(GPUTimerSection section);
     };
 }
\ No newline at end of file
@@ -149,40 +149,76 @@ namespace pxl
 
     bool FileSystem::WriteImageToFile(const std::filesystem::path& path, const std::shared_ptr<Image>& image, ImageFileFormat fileFormat, bool flipVertical)
     {
-        stbi_flip_vertically_on_write(!flipVertical);
+        ImageWriteOptions options = {};
+        options.FlipVertical = flipVertical;
+        options.PNGCompressionLevel = s_PNGCompressionLevel;
+        options.JPEGQuality = s_JPEGQuality;
 
-        auto size = image->Metadata.Size;
-        auto fileNameString = path.string();
-        int32_t channels = 0;
+        return WriteImageToFile(path, *image, fileFormat, options);
+    }
+
+    bool FileSystem::WriteImageToFile(const std::filesystem::path& path, const Image& image, ImageFileFormat fileFormat, const ImageWriteOptions& options)
+    {
+        PXL_PROFILE_SCOPE;
 
-        switch (image->Metadata.Format)
+        switch (fileFormat)
         {
-            case ImageFormat::RGB8:
-                channels = 3;
-                break;
-            case ImageFormat::RGBA8:
-                channels = 4;
+            case ImageFileFormat::PNG:
+                return WriteFile(path, ImageEncoder::EncodePNG(image, options));
+            case ImageFileFormat::QOI:
+                return WriteFile(path, ImageEncoder::EncodeQOI(image, options));
+            default:
                 break;
         }
 
+        auto size = image.Metadata.Size;
+        auto fileNameString = path.string();
+        auto channels = static_cast<int32_t>(ImageEncoder::GetChannelCount(image.Metadata.Format));
+
         // TODO: handle trying to write jpg as png (channels don't match)
 
+        // stb's flip on write setting is global, so flip a copy instead of touching it
+        const uint8_t* pixels = image.Buffer.data();
+        std::vector<uint8_t> flipped;
+
+        if (!options.FlipVertical)
+        {
+            size_t rowSize = static_cast<size_t>(size.Width) * channels;
+            flipped.resize(rowSize * size.Height);
+
+            for (int32_t y = 0; y < size.Height; y++)
+                memcpy(flipped.data() + y * rowSize, pixels + (size.Height - 1 - y) * rowSize, rowSize);
+
+            pixels = flipped.data();
+        }
+
         switch (fileFormat)
         {
-            case ImageFileFormat::PNG:
-                return stbi_write_png(fileNameString.c_str(), size.Width, size.Height, channels, image->Buffer.data(), 0);
             case ImageFileFormat::JPG:
-                return stbi_write_jpg(fileNameString.c_str(), size.Width, size.Height, channels, image->Buffer.data(), s_JPEGQuality);
+                return stbi_write_jpg(fileNameString.c_str(), size.Width, size.Height, channels, pixels, options.JPEGQuality);
             case ImageFileFormat::BMP:
-                return stbi_write_bmp(fileNameString.c_str(), size.Width, size.Height, channels, image->Buffer.data());
+                return stbi_write_bmp(fileNameString.c_str(), size.Width, size.Height, channels, pixels);
             default:
                 return false;
         }
     }
 
-    void FileSystem::SetPNGCompressionLevel(int32_t level)
+    bool FileSystem::WriteFile(const std::filesystem::path& path, const std::vector<uint8_t>& data)
     {
-        stbi_write_png_compression_level = level;
+        if (data.empty())
+            return false;
+
+        std::ofstream file(path, std::ios::binary);
+
+        if (!file.is_open())
+        {
+            PXL_LOG_ERROR(LogArea::FileSystem, "Failed to open file for writing '{}'", path.string());
+            return false;
+        }
+
+        file.write(reinterpret_cast<const char*>(data.data()), data.size());
+
+        return file.good();
     }
 
     // std::shared_ptr<AudioTrack> FileSystem::LoadAudioTrack(const std::string& filePath)
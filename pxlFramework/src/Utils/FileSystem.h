@@ -4,6 +4,7 @@
 #include "Renderer/RendererData.h"
 #include "Renderer/Shader.h"
 #include "Renderer/Texture.h"
+#include "ImageEncoder.h"
 //#include "Audio/AudioTrack.h"
 
 namespace pxl
@@ -30,15 +31,23 @@ namespace pxl
         //static std::shared_ptr<AudioTrack> LoadAudioTrack(const std::string& filePath);
 
         // Path may include directories but for the image to write the directory must already exist.
+        // Uses the PNG compression level and JPEG quality set below
         static bool WriteImageToFile(const std::filesystem::path& path, const std::shared_ptr<Image>& image, ImageFileFormat fileFormat, bool flipVertical = false);
 
+        // Same as above but with per-call options, so images can be written from several threads at once with different settings
+        static bool WriteImageToFile(const std::filesystem::path& path, const Image& image, ImageFileFormat fileFormat, const ImageWriteOptions& options);
+
         // Set the compression level for writing PNG images (higher = more compression). Default is 8.
-        static void SetPNGCompressionLevel(int32_t level);
+        static void SetPNGCompressionLevel(int32_t level) { s_PNGCompressionLevel = level; }
 
         // Set the quality level for writing JPEG images (must be from 1-100). Higher quality looks better but results in a larger image. Default is 50.
         static void SetJPEGQuality(int32_t qualityLevel) { s_JPEGQuality = qualityLevel; }
 
     private:
+        static bool WriteFile(const std::filesystem::path& path, const std::vector<uint8_t>& data);
+
+    private:
+        static inline int32_t s_PNGCompressionLevel = 8;
         static inline int32_t s_JPEGQuality = 50; // Valid values are between 1 - 100
     };
 }
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+namespace pxl
+{
+    class Hash
+    {
+    public:
+        static constexpr uint64_t k_FNV1aOffsetBasis = 0xcbf29ce484222325;
+        static constexpr uint64_t k_FNV1aPrime = 0x100000001b3;
+
+        // 64-bit FNV-1a. Pass a previous result as the seed to hash multiple values together
+        static uint64_t FNV1a(const void* data, size_t size, uint64_t seed = k_FNV1aOffsetBasis)
+        {
+            auto bytes = static_cast<const uint8_t*>(data);
+            uint64_t hash = seed;
+
+            for (size_t i = 0; i < size; i++)
+            {
+                hash ^= bytes[i];
+                hash *= k_FNV1aPrime;
+            }
+
+            return hash;
+        }
+
+        static uint64_t FNV1a(std::string_view str, uint64_t seed = k_FNV1aOffsetBasis)
+        {
+            return FNV1a(str.data(), str.size(), seed);
+        }
+
+        template<typename T>
+        static uint64_t FNV1aValue(const T& value, uint64_t seed = k_FNV1aOffsetBasis)
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be hashed by their bytes");
+            return FNV1a(&value, sizeof(T), seed);
+        }
+    };
+}
@@ -0,0 +1,632 @@
+#include "ImageEncoder.h"
+
+#include "Core/JobSystem.h"
+
+namespace pxl
+{
+    // Bands any smaller than this compress noticeably worse, since matches can't reach back into the band before
+    static constexpr uint32_t k_MinPNGBandRows = 32;
+
+    static constexpr uint32_t k_DeflateWindowSize = 32768;
+    static constexpr uint32_t k_DeflateMinMatch = 3;
+    static constexpr uint32_t k_DeflateMaxMatch = 258;
+    static constexpr uint32_t k_DeflateHashBits = 15;
+    static constexpr uint32_t k_MaxStoredBlockSize = 65535;
+
+    static constexpr std::array<uint16_t, 29> k_LengthBase = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    static constexpr std::array<uint8_t, 29> k_LengthExtraBits = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    static constexpr std::array<uint16_t, 30> k_DistanceBase = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    static constexpr std::array<uint8_t, 30> k_DistanceExtraBits = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+    static constexpr uint32_t ReverseBits(uint32_t value, uint32_t count)
+    {
+        uint32_t reversed = 0;
+
+        for (uint32_t i = 0; i < count; i++)
+            reversed |= ((value >> i) & 1) << (count - 1 - i);
+
+        return reversed;
+    }
+
+    struct HuffmanCode
+    {
+        uint16_t Code = 0; // Already reversed, since deflate writes Huffman codes starting from the most significant bit
+        uint8_t Length = 0;
+    };
+
+    // The fixed literal/length codes from RFC 1951 3.2.6
+    static constexpr auto k_FixedLiteralCodes = []()
+    {
+        std::array<HuffmanCode, 288> codes = {};
+
+        for (uint32_t symbol = 0; symbol < 288; symbol++)
+        {
+            if (symbol <= 143)
+                codes[symbol] = { static_cast<uint16_t>(ReverseBits(0x30 + symbol, 8)), 8 };
+            else if (symbol <= 255)
+                codes[symbol] = { static_cast<uint16_t>(ReverseBits(0x190 + symbol - 144, 9)), 9 };
+            else if (symbol <= 279)
+                codes[symbol] = { static_cast<uint16_t>(ReverseBits(symbol - 256, 7)), 7 };
+            else
+                codes[symbol] = { static_cast<uint16_t>(ReverseBits(0xC0 + symbol - 280, 8)), 8 };
+        }
+
+        return codes;
+    }();
+
+    static constexpr auto k_CRC32Table = []()
+    {
+        std::array<uint32_t, 256> table = {};
+
+        for (uint32_t i = 0; i < 256; i++)
+        {
+            uint32_t crc = i;
+
+            for (uint32_t bit = 0; bit < 8; bit++)
+                crc = (crc & 1) ? 0xEDB88320 ^ (crc >> 1) : crc >> 1;
+
+            table[i] = crc;
+        }
+
+        return table;
+    }();
+
+    // Deflate packs bits starting from the least significant bit of each byte
+    class BitWriter
+    {
+    public:
+        BitWriter(std::vector<uint8_t>& out)
+            : m_Out(out)
+        {
+        }
+
+        void Write(uint32_t value, uint32_t count)
+        {
+            m_Bits |= static_cast<uint64_t>(value) << m_Count;
+            m_Count += count;
+
+            while (m_Count >= 8)
+            {
+                m_Out.push_back(static_cast<uint8_t>(m_Bits));
+                m_Bits >>= 8;
+                m_Count -= 8;
+            }
+        }
+
+        void Write(HuffmanCode code) { Write(code.Code, code.Length); }
+
+        // Pads with zeros up to the next byte
+        void Align()
+        {
+            if (m_Count > 0)
+                Write(0, 8 - m_Count);
+        }
+
+    private:
+        std::vector<uint8_t>& m_Out;
+        uint64_t m_Bits = 0;
+        uint32_t m_Count = 0;
+    };
+
+    static void WriteBigEndian(std::vector<uint8_t>& out, uint32_t value)
+    {
+        out.push_back(static_cast<uint8_t>(value >> 24));
+        out.push_back(static_cast<uint8_t>(value >> 16));
+        out.push_back(static_cast<uint8_t>(value >> 8));
+        out.push_back(static_cast<uint8_t>(value));
+    }
+
+    static uint8_t PaethPredictor(int32_t left, int32_t up, int32_t upLeft)
+    {
+        int32_t estimate = left + up - upLeft;
+        int32_t leftDistance = std::abs(estimate - left);
+        int32_t upDistance = std::abs(estimate - up);
+        int32_t upLeftDistance = std::abs(estimate - upLeft);
+
+        if (leftDistance <= upDistance && leftDistance <= upLeftDistance)
+            return static_cast<uint8_t>(left);
+
+        if (upDistance <= upLeftDistance)
+            return static_cast<uint8_t>(up);
+
+        return static_cast<uint8_t>(upLeft);
+    }
+
+    std::vector<uint8_t> ImageEncoder::EncodePNG(const Image& image, const ImageWriteOptions& options)
+    {
+        PXL_PROFILE_SCOPE;
+
+        auto channels = GetChannelCount(image.Metadata.Format);
+        auto size = image.Metadata.Size;
+
+        if (channels == 0 || size.Width <= 0 || size.Height <= 0)
+        {
+            PXL_LOG_ERROR(LogArea::FileSystem, "Failed to encode PNG, the image has no pixels or an undefined format");
+            return {};
+        }
+
+        auto width = static_cast<uint32_t>(size.Width);
+        auto height = static_cast<uint32_t>(size.Height);
+        size_t rowSize = static_cast<size_t>(width) * channels;
+
+        PXL_ASSERT_MSG(image.Buffer.size() >= rowSize * height, "Image buffer is smaller than its size and format");
+
+        // PNG rows are top to bottom
+        auto getRow = [&](uint32_t y)
+        {
+            auto imageRow = options.FlipVertical ? y : height - 1 - y;
+            return image.Buffer.data() + imageRow * rowSize;
+        };
+
+        uint32_t bandCount = 1;
+
+        if (options.ParallelPNG && JobSystem::IsInitialized())
+            bandCount = std::clamp(height / k_MinPNGBandRows, 1u, JobSystem::GetThreadCount() * 2);
+
+        uint32_t rowsPerBand = (height + bandCount - 1) / bandCount;
+        bandCount = (height + rowsPerBand - 1) / rowsPerBand;
+
+        std::vector<PNGBand> bands(bandCount);
+        std::vector<uint8_t> emptyRow(rowSize, 0);
+
+        // Filters only look at the row above, and compression never reaches outside the band, so every band can be encoded on its own
+        JobSystem::ParallelFor(bandCount, [&](uint32_t begin, uint32_t end)
+        {
+            std::vector<uint8_t> filtered;
+            std::vector<uint8_t> scratch(rowSize);
+
+            for (uint32_t index = begin; index < end; index++)
+            {
+                auto& band = bands[index];
+                auto firstRow = index * rowsPerBand;
+                auto lastRow = std::min(firstRow + rowsPerBand, height);
+
+                filtered.resize((lastRow - firstRow) * (rowSize + 1));
+
+                for (uint32_t y = firstRow; y < lastRow; y++)
+                {
+                    auto previousRow = y > 0 ? getRow(y - 1) : emptyRow.data();
+                    FilterRow(getRow(y), previousRow, rowSize, channels, options.PNGCompressionLevel > 0, scratch.data(), filtered.data() + (y - firstRow) * (rowSize + 1));
+                }
+
+                // The zlib header goes in front of the first band, the checksum after the last is written once every band is done
+                if (index == 0)
+                    band.Data = { 0x78, 0x01 };
+
+                band.Data.reserve(filtered.size() / 2);
+
+                Deflate(filtered.data(), filtered.size(), options.PNGCompressionLevel, index == bandCount - 1, band.Data);
+
+                band.Adler = Adler32(filtered.data(), filtered.size());
+                band.FilteredSize = filtered.size();
+                band.CRC = CRC32(band.Data.data(), band.Data.size(), CRC32(reinterpret_cast<const uint8_t*>("IDAT"), 4));
+            }
+        }, 1);
+
+        std::vector<uint8_t> png = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+        size_t compressedSize = 0;
+        for (const auto& band : bands)
+            compressedSize += band.Data.size() + 12;
+
+        png.reserve(png.size() + compressedSize + 64);
+
+        std::vector<uint8_t> header;
+        WriteBigEndian(header, width);
+        WriteBigEndian(header, height);
+        header.push_back(8); // Bit depth
+
+        switch (channels)
+        {
+            case 1: header.push_back(0); break; // Greyscale
+            case 2: header.push_back(4); break; // Greyscale + alpha
+            case 3: header.push_back(2); break; // RGB
+            case 4: header.push_back(6); break; // RGBA
+        }
+
+        header.push_back(0); // Compression method
+        header.push_back(0); // Filter method
+        header.push_back(0); // No interlacing
+
+        AppendChunk(png, "IHDR", header.data(), header.size());
+
+        uint32_t adler = bands[0].Adler;
+
+        for (uint32_t i = 0; i < bandCount; i++)
+        {
+            AppendChunk(png, "IDAT", bands[i].Data.data(), bands[i].Data.size(), bands[i].CRC);
+
+            if (i > 0)
+                adler = CombineAdler32(adler, bands[i].Adler, bands[i].FilteredSize);
+        }
+
+        std::vector<uint8_t> checksum;
+        WriteBigEndian(checksum, adler);
+        AppendChunk(png, "IDAT", checksum.data(), checksum.size());
+
+        AppendChunk(png, "IEND", nullptr, 0);
+
+        return png;
+    }
+
+    std::vector<uint8_t> ImageEncoder::EncodeQOI(const Image& image, const ImageWriteOptions& options)
+    {
+        PXL_PROFILE_SCOPE;
+
+        auto channels = GetChannelCount(image.Metadata.Format);
+        auto size = image.Metadata.Size;
+
+        if ((channels != 3 && channels != 4) || size.Width <= 0 || size.Height <= 0)
+        {
+            PXL_LOG_ERROR(LogArea::FileSystem, "Failed to encode QOI, only RGB8 and RGBA8 images can be written as QOI");
+            return {};
+        }
+
+        auto width = static_cast<uint32_t>(size.Width);
+        auto height = static_cast<uint32_t>(size.Height);
+        size_t rowSize = static_cast<size_t>(width) * channels;
+
+        PXL_ASSERT_MSG(image.Buffer.size() >= rowSize * height, "Image buffer is smaller than its size and format");
+
+        struct Pixel
+        {
+            uint8_t R = 0, G = 0, B = 0, A = 255;
+
+            bool operator==(const Pixel&) const = default;
+        };
+
+        std::vector<uint8_t> qoi;
+        qoi.reserve(14 + static_cast<size_t>(width) * height * (channels + 1) + 8);
+
+        qoi.insert(qoi.end(), { 'q', 'o', 'i', 'f' });
+        WriteBigEndian(qoi, width);
+        WriteBigEndian(qoi, height);
+        qoi.push_back(static_cast<uint8_t>(channels));
+        qoi.push_back(0); // sRGB with linear alpha
+
+        std::array<Pixel, 64> seen = {};
+        for (auto& pixel : seen)
+            pixel.A = 0;
+
+        Pixel previous = {};
+        uint32_t run = 0;
+
+        for (uint32_t y = 0; y < height; y++)
+        {
+            // QOI rows are top to bottom
+            auto row = image.Buffer.data() + (options.FlipVertical ? y : height - 1 - y) * rowSize;
+
+            for (size_t x = 0; x < rowSize; x += channels)
+            {
+                Pixel pixel = { row[x], row[x + 1], row[x + 2], channels == 4 ? row[x + 3] : uint8_t(255) };
+
+                if (pixel == previous)
+                {
+                    // QOI_OP_RUN, the lengths 63 and 64 would clash with the RGB and RGBA tags
+                    if (++run == 62)
+                    {
+                        qoi.push_back(static_cast<uint8_t>(0xC0 | (run - 1)));
+                        run = 0;
+                    }
+
+                    continue;
+                }
+
+                if (run > 0)
+                {
+                    qoi.push_back(static_cast<uint8_t>(0xC0 | (run - 1)));
+                    run = 0;
+                }
+
+                auto hash = (pixel.R * 3 + pixel.G * 5 + pixel.B * 7 + pixel.A * 11) % 64;
+
+                if (seen[hash] == pixel)
+                {
+                    // QOI_OP_INDEX
+                    qoi.push_back(static_cast<uint8_t>(hash));
+                }
+                else if (pixel.A == previous.A)
+                {
+                    seen[hash] = pixel;
+
+                    auto dr = static_cast<int8_t>(pixel.R - previous.R);
+                    auto dg = static_cast<int8_t>(pixel.G - previous.G);
+                    auto db = static_cast<int8_t>(pixel.B - previous.B);
+                    auto drdg = dr - dg;
+                    auto dbdg = db - dg;
+
+                    if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1)
+                    {
+                        // QOI_OP_DIFF
+                        qoi.push_back(static_cast<uint8_t>(0x40 | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2)));
+                    }
+                    else if (dg >= -32 && dg <= 31 && drdg >= -8 && drdg <= 7 && dbdg >= -8 && dbdg <= 7)
+                    {
+                        // QOI_OP_LUMA
+                        qoi.push_back(static_cast<uint8_t>(0x80 | (dg + 32)));
+                        qoi.push_back(static_cast<uint8_t>((drdg + 8) << 4 | (dbdg + 8)));
+                    }
+                    else
+                    {
+                        qoi.insert(qoi.end(), { 0xFE, pixel.R, pixel.G, pixel.B });
+                    }
+                }
+                else
+                {
+                    seen[hash] = pixel;
+                    qoi.insert(qoi.end(), { 0xFF, pixel.R, pixel.G, pixel.B, pixel.A });
+                }
+
+                previous = pixel;
+            }
+        }
+
+        if (run > 0)
+            qoi.push_back(static_cast<uint8_t>(0xC0 | (run - 1)));
+
+        qoi.insert(qoi.end(), { 0, 0, 0, 0, 0, 0, 0, 1 });
+
+        return qoi;
+    }
+
+    uint32_t ImageEncoder::GetChannelCount(ImageFormat format)
+    {
+        switch (format)
+        {
+            case ImageFormat::RGB8:  return 3;
+            case ImageFormat::RGBA8: return 4;
+            default:                 return 0;
+        }
+    }
+
+    void ImageEncoder::FilterRow(const uint8_t* row, const uint8_t* previousRow, size_t rowSize, uint32_t channels, bool choose, uint8_t* scratch, uint8_t* out)
+    {
+        if (!choose)
+        {
+            out[0] = 0;
+            memcpy(out + 1, row, rowSize);
+            return;
+        }
+
+        // Pick the filter with the smallest sum of differences, the usual heuristic since small values compress better
+        uint64_t bestSum = UINT64_MAX;
+
+        for (uint8_t filter = 0; filter < 5; filter++)
+        {
+            uint64_t sum = 0;
+
+            for (size_t i = 0; i < rowSize; i++)
+            {
+                int32_t left = i >= channels ? row[i - channels] : 0;
+                int32_t up = previousRow[i];
+                int32_t upLeft = i >= channels ? previousRow[i - channels] : 0;
+
+                uint8_t predicted = 0;
+
+                switch (filter)
+                {
+                    case 1: predicted = static_cast<uint8_t>(left); break;
+                    case 2: predicted = static_cast<uint8_t>(up); break;
+                    case 3: predicted = static_cast<uint8_t>((left + up) / 2); break;
+                    case 4: predicted = PaethPredictor(left, up, upLeft); break;
+                }
+
+                scratch[i] = static_cast<uint8_t>(row[i] - predicted);
+                sum += std::abs(static_cast<int8_t>(scratch[i]));
+            }
+
+            if (sum < bestSum)
+            {
+                bestSum = sum;
+                out[0] = filter;
+                memcpy(out + 1, scratch, rowSize);
+            }
+        }
+    }
+
+    void ImageEncoder::Deflate(const uint8_t* data, size_t size, int32_t level, bool last, std::vector<uint8_t>& out)
+    {
+        PXL_PROFILE_SCOPE;
+
+        BitWriter writer(out);
+
+        if (level <= 0)
+        {
+            size_t offset = 0;
+
+            do
+            {
+                auto blockSize = std::min<size_t>(size - offset, k_MaxStoredBlockSize);
+                bool final = last && offset + blockSize == size;
+
+                writer.Write(final ? 1 : 0, 1);
+                writer.Write(0, 2); // Stored
+                writer.Align();
+
+                writer.Write(static_cast<uint32_t>(blockSize), 16);
+                writer.Write(static_cast<uint32_t>(~blockSize & 0xFFFF), 16);
+                out.insert(out.end(), data + offset, data + offset + blockSize);
+
+                offset += blockSize;
+            } while (offset < size);
+
+            return;
+        }
+
+        // Searching further back finds longer matches but takes longer
+        auto maxChainLength = static_cast<uint32_t>(std::clamp(level, 1, 9)) * 4;
+
+        std::vector<int32_t> head(1 << k_DeflateHashBits, -1);
+        std::vector<int32_t> previous(size);
+
+        auto hash = [data](size_t position)
+        {
+            uint32_t bytes = data[position] | data[position + 1] << 8 | data[position + 2] << 16;
+            return (bytes * 2654435761u) >> (32 - k_DeflateHashBits);
+        };
+
+        auto insert = [&](size_t position)
+        {
+            auto h = hash(position);
+            previous[position] = head[h];
+            head[h] = static_cast<int32_t>(position);
+        };
+
+        writer.Write(last ? 1 : 0, 1);
+        writer.Write(1, 2); // Fixed Huffman codes
+
+        size_t position = 0;
+
+        while (position < size)
+        {
+            uint32_t bestLength = 0;
+            uint32_t bestDistance = 0;
+
+            if (position + k_DeflateMinMatch <= size)
+            {
+                auto maxLength = static_cast<uint32_t>(std::min<size_t>(size - position, k_DeflateMaxMatch));
+                auto candidate = head[hash(position)];
+                auto chain = maxChainLength;
+
+                while (candidate >= 0 && position - candidate <= k_DeflateWindowSize && chain-- > 0)
+                {
+                    // Only worth comparing the rest if it could beat the best match so far
+                    if (data[candidate + bestLength] == data[position + bestLength])
+                    {
+                        uint32_t length = 0;
+                        while (length < maxLength && data[candidate + length] == data[position + length])
+                            length++;
+
+                        if (length > bestLength)
+                        {
+                            bestLength = length;
+                            bestDistance = static_cast<uint32_t>(position - candidate);
+
+                            if (length == maxLength)
+                                break;
+                        }
+                    }
+
+                    candidate = previous[candidate];
+                }
+
+                insert(position);
+            }
+
+            if (bestLength < k_DeflateMinMatch)
+            {
+                writer.Write(k_FixedLiteralCodes[data[position]]);
+                position++;
+                continue;
+            }
+
+            auto lengthCode = static_cast<uint32_t>(std::upper_bound(k_LengthBase.begin(), k_LengthBase.end(), bestLength) - k_LengthBase.begin()) - 1;
+            writer.Write(k_FixedLiteralCodes[257 + lengthCode]);
+            writer.Write(bestLength - k_LengthBase[lengthCode], k_LengthExtraBits[lengthCode]);
+
+            // Fixed distance codes are all 5 bits
+            auto distanceCode = static_cast<uint32_t>(std::upper_bound(k_DistanceBase.begin(), k_DistanceBase.end(), bestDistance) - k_DistanceBase.begin()) - 1;
+            writer.Write(ReverseBits(distanceCode, 5), 5);
+            writer.Write(bestDistance - k_DistanceBase[distanceCode], k_DistanceExtraBits[distanceCode]);
+
+            for (size_t i = position + 1; i < position + bestLength && i + k_DeflateMinMatch <= size; i++)
+                insert(i);
+
+            position += bestLength;
+        }
+
+        writer.Write(k_FixedLiteralCodes[256]); // End of block
+
+        if (last)
+        {
+            writer.Align();
+            return;
+        }
+
+        // An empty stored block leaves the stream on a byte boundary, so the next band's blocks can follow straight after
+        writer.Write(0, 1);
+        writer.Write(0, 2);
+        writer.Align();
+        writer.Write(0x0000, 16);
+        writer.Write(0xFFFF, 16);
+    }
+
+    uint32_t ImageEncoder::Adler32(const uint8_t* data, size_t size, uint32_t adler)
+    {
+        // The largest number of bytes that can be summed before the sums could overflow
+        constexpr size_t k_MaxRun = 5552;
+        constexpr uint32_t k_Modulus = 65521;
+
+        uint32_t a = adler & 0xFFFF;
+        uint32_t b = adler >> 16;
+
+        while (size > 0)
+        {
+            auto run = std::min(size, k_MaxRun);
+            size -= run;
+
+            for (size_t i = 0; i < run; i++)
+            {
+                a += data[i];
+                b += a;
+            }
+
+            data += run;
+            a %= k_Modulus;
+            b %= k_Modulus;
+        }
+
+        return (b << 16) | a;
+    }
+
+    uint32_t ImageEncoder::CombineAdler32(uint32_t first, uint32_t second, size_t secondSize)
+    {
+        // Same as zlib's adler32_combine()
+        constexpr uint32_t k_Modulus = 65521;
+
+        auto remainder = static_cast<uint32_t>(secondSize % k_Modulus);
+        uint32_t a = first & 0xFFFF;
+        uint32_t b = static_cast<uint32_t>((static_cast<uint64_t>(remainder) * a) % k_Modulus);
+
+        a += (second & 0xFFFF) + k_Modulus - 1;
+        b += (first >> 16) + (second >> 16) + k_Modulus - remainder;
+
+        if (a >= k_Modulus)
+            a -= k_Modulus;
+        if (a >= k_Modulus)
+            a -= k_Modulus;
+        if (b >= k_Modulus * 2)
+            b -= k_Modulus * 2;
+        if (b >= k_Modulus)
+            b -= k_Modulus;
+
+        return (b << 16) | a;
+    }
+
+    uint32_t ImageEncoder::CRC32(const uint8_t* data, size_t size, uint32_t crc)
+    {
+        crc = ~crc;
+
+        for (size_t i = 0; i < size; i++)
+            crc = k_CRC32Table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+
+        return ~crc;
+    }
+
+    void ImageEncoder::AppendChunk(std::vector<uint8_t>& png, const char* type, const uint8_t* data, size_t size)
+    {
+        auto typeBytes = reinterpret_cast<const uint8_t*>(type);
+        AppendChunk(png, type, data, size, CRC32(data, size, CRC32(typeBytes, 4)));
+    }
+
+    void ImageEncoder::AppendChunk(std::vector<uint8_t>& png, const char* type, const uint8_t* data, size_t size, uint32_t crc)
+    {
+        WriteBigEndian(png, static_cast<uint32_t>(size));
+        png.insert(png.end(), type, type + 4);
+
+        if (size > 0)
+            png.insert(png.end(), data, data + size);
+
+        WriteBigEndian(png, crc);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Core/Image.h"
+
+namespace pxl
+{
+    struct ImageWriteOptions
+    {
+        // Images are stored bottom to top, so rows are written in reverse unless this is set, the same as LoadImageFile's flipVertical
+        bool FlipVertical = false;
+
+        // Higher = more compression but slower. 0 stores the pixels without compressing them, which is the fastest
+        int32_t PNGCompressionLevel = 8;
+
+        // Splits the image into bands of rows which are filtered and compressed on the job system's threads
+        bool ParallelPNG = true;
+
+        int32_t JPEGQuality = 50; // Valid values are between 1 - 100
+    };
+
+    /// @brief Encodes images to PNG and QOI in memory without any global state, so multiple images can be encoded at once from any thread.
+    /// PNGs are compressed in bands of rows that each end on a byte boundary with an empty stored block (a zlib sync flush), so the bands can be
+    /// compressed in parallel and joined into one deflate stream. Each band is written as its own IDAT chunk so their CRCs can be computed in parallel too
+    class ImageEncoder
+    {
+    public:
+        // Returns an empty buffer if the image can't be encoded
+        static std::vector<uint8_t> EncodePNG(const Image& image, const ImageWriteOptions& options = {});
+
+        // QOI is lossless like PNG but many times faster to encode, at the cost of larger files
+        static std::vector<uint8_t> EncodeQOI(const Image& image, const ImageWriteOptions& options = {});
+
+        static uint32_t GetChannelCount(ImageFormat format);
+
+    private:
+        struct PNGBand
+        {
+            std::vector<uint8_t> Data; // Compressed
+            uint32_t Adler = 1;        // Of the uncompressed (filtered) rows
+            size_t FilteredSize = 0;
+            uint32_t CRC = 0;          // Of the IDAT chunk the band is written to
+        };
+
+        // Writes a row prefixed with the filter that's likely to compress best
+        static void FilterRow(const uint8_t* row, const uint8_t* previousRow, size_t rowSize, uint32_t channels, bool choose, uint8_t* scratch, uint8_t* out);
+
+        static void Deflate(const uint8_t* data, size_t size, int32_t level, bool last, std::vector<uint8_t>& out);
+
+        static uint32_t Adler32(const uint8_t* data, size_t size, uint32_t adler = 1);
+        static uint32_t CombineAdler32(uint32_t first, uint32_t second, size_t secondSize);
+        static uint32_t CRC32(const uint8_t* data, size_t size, uint32_t crc = 0);
+
+        static void AppendChunk(std::vector<uint8_t>& png, const char* type, const uint8_t* data, size_t size);
+        static void AppendChunk(std::vector<uint8_t>& png, const char* type, const uint8_t* data, size_t size, uint32_t crc);
+    };
+}
\ No newline at end of file